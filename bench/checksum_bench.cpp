@@ -0,0 +1,122 @@
+// Copyright 2025 xinchentechnote
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/checksum.hpp"
+
+namespace {
+
+ByteBuf MakePayload(size_t len) {
+  ByteBuf buf;
+  for (size_t i = 0; i < len; ++i) buf.write_u8(static_cast<uint8_t>(i * 131 + 7));
+  return buf;
+}
+
+// The per-byte loops the SSE_BIN / SZSE_BIN services used before byte_sum().
+uint32_t SseBinLoop(const ByteBuf& data) {
+  uint32_t checksum = 0;
+  const uint8_t* bytes = data.data();
+  for (size_t n = 0; n < data.size(); ++n) {
+    checksum = (checksum + bytes[n]) & 0xFF;
+  }
+  return checksum;
+}
+
+int32_t SzseBinLoop(const ByteBuf& data) {
+  int32_t checksum = 0;
+  const uint8_t* bytes = data.data();
+  for (size_t n = 0; n < data.size(); ++n) {
+    checksum += bytes[n];
+  }
+  return checksum % 256;
+}
+
+void BM_SseBinLoop(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(SseBinLoop(buf));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SseBinService(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  SseBinChecksumService service;
+  for (auto _ : state) benchmark::DoNotOptimize(service.calc(buf));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SzseBinLoop(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(SzseBinLoop(buf));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SzseBinService(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  SzseBinChecksumService service;
+  for (auto _ : state) benchmark::DoNotOptimize(service.calc(buf));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+uint16_t Crc16BitwiseLoop(const ByteBuf& data) {
+  uint16_t crc = 0xFFFF;
+  const uint8_t* bytes = data.data();
+  for (size_t n = 0; n < data.size(); ++n) {
+    crc ^= static_cast<uint16_t>(bytes[n]);
+    for (int i = 0; i < 8; i++) {
+      if (crc & 0x0001)
+        crc = (crc >> 1) ^ 0xA001;
+      else
+        crc >>= 1;
+    }
+  }
+  return crc;
+}
+
+void BM_Crc16BitwiseLoop(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(Crc16BitwiseLoop(buf));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Crc16Service(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  Crc16ChecksumService service;
+  for (auto _ : state) benchmark::DoNotOptimize(service.calc(buf));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Crc32Zlib(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(::crc32(0, buf.data(), buf.size()));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Crc32Service(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  Crc32ChecksumService service;
+  for (auto _ : state) benchmark::DoNotOptimize(service.calc(buf));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+#if defined(__SSE2__)
+void BM_ByteSumSse2(benchmark::State& state) {
+  ByteBuf buf = MakePayload(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(simd::detail::byte_sum_sse2(buf.data(), buf.size()));
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ByteSumSse2)->Arg(64)->Arg(1024)->Arg(64 << 10)->Arg(1 << 20);
+#endif
+
+}  // namespace
+
+BENCHMARK(BM_SseBinLoop)->Arg(64)->Arg(1024)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(BM_SseBinService)->Arg(64)->Arg(1024)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(BM_SzseBinLoop)->Arg(64)->Arg(1024)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(BM_SzseBinService)->Arg(64)->Arg(1024)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(BM_Crc16BitwiseLoop)->Arg(64)->Arg(1024)->Arg(64 << 10);
+BENCHMARK(BM_Crc16Service)->Arg(64)->Arg(1024)->Arg(64 << 10);
+BENCHMARK(BM_Crc32Zlib)->Arg(64)->Arg(1024)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(BM_Crc32Service)->Arg(64)->Arg(1024)->Arg(64 << 10)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
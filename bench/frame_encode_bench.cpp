@@ -0,0 +1,255 @@
+// Copyright 2025 xinchentechnote
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "include/frame_batch.hpp"
+#include "include/szse_binary.hpp"
+
+namespace {
+
+constexpr uint32_t kNewOrderMsgType = 100101;
+
+void FillNewOrder(NewOrder& order) {
+  auto applExtend = std::make_unique<Extend100101>();
+  applExtend->stopPx = 0;
+  applExtend->minQty = 100;
+  applExtend->maxPriceLevels = 1;
+  applExtend->timeInForce = "0";
+  applExtend->cashMargin = "1";
+
+  order.applId = "010";
+  order.submittingPbuid = "010000";
+  order.securityId = "000001";
+  order.securityIdsource = "102";
+  order.ownerType = 1;
+  order.clearingFirm = "01";
+  order.transactTime = 20250101093000000;
+  order.userInfo = "user";
+  order.clOrdId = "0000000001";
+  order.accountId = "0123456789";
+  order.branchId = "0001";
+  order.orderRestrictions = "";
+  order.side = "1";
+  order.ordType = "2";
+  order.orderQty = 10000;
+  order.price = 123400;
+  order.applExtend = std::move(applExtend);
+}
+
+void BM_SzseNewOrderEncodeVirtual(benchmark::State& state) {
+  SzseBinary frame;
+  frame.msgType = kNewOrderMsgType;
+  auto body = std::make_unique<NewOrder>();
+  FillNewOrder(*body);
+  frame.body = std::move(body);
+  frame.checksum = 0;
+  const codec::BinaryCodec& codec = frame;
+
+  ByteBuf buf(512);
+  for (auto _ : state) {
+    buf.reset();
+    codec.encode(buf);
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+void BM_SzseNewOrderEncodeStatic(benchmark::State& state) {
+  SzseBinaryFrame<NewOrder> frame;
+  frame.msgType = kNewOrderMsgType;
+  FillNewOrder(frame.body);
+  frame.checksum = 0;
+
+  ByteBuf buf(512);
+  for (auto _ : state) {
+    buf.reset();
+    frame.encode(buf);
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+// Body only, without the frame header and checksum.
+void BM_NewOrderBodyEncodeVirtual(benchmark::State& state) {
+  std::unique_ptr<codec::BinaryCodec> body = std::make_unique<NewOrder>();
+  FillNewOrder(static_cast<NewOrder&>(*body));
+
+  ByteBuf buf(512);
+  for (auto _ : state) {
+    buf.reset();
+    buf.ensure_writable(body->encodedSize());
+    body->encode(buf);
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+void BM_NewOrderBodyEncodeStatic(benchmark::State& state) {
+  NewOrder body;
+  FillNewOrder(body);
+
+  ByteBuf buf(512);
+  for (auto _ : state) {
+    buf.reset();
+    buf.ensure_writable(body.encodedSize());
+    body.encode(buf);
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+void BM_SzseNewOrderDecodeVirtual(benchmark::State& state) {
+  SzseBinaryFrame<NewOrder> original;
+  original.msgType = kNewOrderMsgType;
+  FillNewOrder(original.body);
+  ByteBuf buf;
+  original.encode(buf);
+
+  SzseBinary frame;
+  for (auto _ : state) {
+    ByteBufView view(buf.data(), buf.size());
+    frame.decode(view);
+    benchmark::DoNotOptimize(frame.body.get());
+  }
+}
+
+void BM_SzseNewOrderDecodeStatic(benchmark::State& state) {
+  SzseBinaryFrame<NewOrder> original;
+  original.msgType = kNewOrderMsgType;
+  FillNewOrder(original.body);
+  ByteBuf buf;
+  original.encode(buf);
+
+  SzseBinaryFrame<NewOrder> frame;
+  for (auto _ : state) {
+    ByteBufView view(buf.data(), buf.size());
+    frame.decode(view);
+    benchmark::DoNotOptimize(&frame.body);
+  }
+}
+
+// Send path with the order template: copy the pre-encoded frame, patch the per-order slots.
+void BM_SzseNewOrderStampTemplate(benchmark::State& state) {
+  SzseBinaryFrame<NewOrder> prototype;
+  prototype.msgType = kNewOrderMsgType;
+  FillNewOrder(prototype.body);
+  const codec::FrameTemplate tmpl = SzseBinaryWire::makeTemplate(prototype);
+
+  ByteBuf buf(512);
+  int64_t n = 0;
+  for (auto _ : state) {
+    buf.reset();
+    codec::FramePatcher order = tmpl.stamp(buf);
+    NewOrderWire::setClOrdId(order, "0000000002");
+    NewOrderWire::setPrice(order, 123400 + (n & 0xFF));
+    NewOrderWire::setOrderQty(order, 10000);
+    NewOrderWire::setTransactTime(order, 20250101093000000 + n);
+    ++n;
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+void BM_NewOrderBodyDecodeFull(benchmark::State& state) {
+  NewOrder original;
+  FillNewOrder(original);
+  ByteBuf buf;
+  original.encode(buf);
+
+  NewOrder order;
+  for (auto _ : state) {
+    ByteBufView view(buf.data(), buf.size());
+    order.decode(view);
+    benchmark::DoNotOptimize(&order);
+  }
+}
+
+// The fields a pre-trade risk check looks at; everything else is skipped over.
+void BM_NewOrderBodyDecodeMasked(benchmark::State& state) {
+  NewOrder original;
+  FillNewOrder(original);
+  ByteBuf buf;
+  original.encode(buf);
+
+  const codec::FieldMask<NewOrder::Field> mask{NewOrder::Field::securityId, NewOrder::Field::side,
+                                               NewOrder::Field::orderQty, NewOrder::Field::price};
+  NewOrder order;
+  for (auto _ : state) {
+    ByteBufView view(buf.data(), buf.size());
+    order.decode(view, mask);
+    benchmark::DoNotOptimize(&order);
+  }
+}
+
+std::vector<SzseBinaryFrame<OrderCancelRequest>> MakeCancels(size_t count) {
+  std::vector<SzseBinaryFrame<OrderCancelRequest>> cancels(count);
+  for (size_t i = 0; i < count; ++i) {
+    cancels[i].msgType = 190007;
+    cancels[i].body.applId = "010";
+    cancels[i].body.securityId = "000001";
+    cancels[i].body.clOrdId = "0000000001";
+    cancels[i].body.origClOrdId = "0000000002";
+    cancels[i].body.orderQty = 100;
+  }
+  return cancels;
+}
+
+// Mass cancel the old way: one encode into its own buffer per frame.
+void BM_SzseCancelBurstPerFrame(benchmark::State& state) {
+  auto cancels = MakeCancels(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (const auto& frame : cancels) {
+      ByteBuf buf;
+      frame.encode(buf);
+      benchmark::DoNotOptimize(buf.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SzseCancelBurstBatch(benchmark::State& state) {
+  auto cancels = MakeCancels(static_cast<size_t>(state.range(0)));
+  codec::FrameBatch batch;
+  for (auto _ : state) {
+    batch.clear();
+    batch.encode(cancels);
+    benchmark::DoNotOptimize(batch.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// A fresh buffer per frame, as a send path that encodes each admin message on the stack would.
+void BM_SzseHeartbeatEncodeHeapBuf(benchmark::State& state) {
+  SzseBinaryFrame<Heartbeat> frame;
+  frame.msgType = 3;
+  for (auto _ : state) {
+    ByteBuf buf;
+    frame.encode(buf);
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+void BM_SzseHeartbeatEncodeSmallBuf(benchmark::State& state) {
+  SzseBinaryFrame<Heartbeat> frame;
+  frame.msgType = 3;
+  for (auto _ : state) {
+    SmallByteBuf<64> buf;
+    frame.encode(buf);
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_SzseNewOrderEncodeVirtual);
+BENCHMARK(BM_SzseNewOrderEncodeStatic);
+BENCHMARK(BM_SzseNewOrderStampTemplate);
+BENCHMARK(BM_NewOrderBodyEncodeVirtual);
+BENCHMARK(BM_NewOrderBodyEncodeStatic);
+BENCHMARK(BM_SzseNewOrderDecodeVirtual);
+BENCHMARK(BM_SzseNewOrderDecodeStatic);
+BENCHMARK(BM_NewOrderBodyDecodeFull);
+BENCHMARK(BM_NewOrderBodyDecodeMasked);
+BENCHMARK(BM_SzseCancelBurstPerFrame)->Arg(16)->Arg(256);
+BENCHMARK(BM_SzseCancelBurstBatch)->Arg(16)->Arg(256);
+BENCHMARK(BM_SzseHeartbeatEncodeHeapBuf);
+BENCHMARK(BM_SzseHeartbeatEncodeSmallBuf);
+
+BENCHMARK_MAIN();
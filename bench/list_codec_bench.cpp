@@ -0,0 +1,93 @@
+// Copyright 2025 xinchentechnote
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/codec.hpp"
+
+namespace {
+
+std::vector<uint64_t> MakeList(size_t n) {
+  std::vector<uint64_t> list(n);
+  for (size_t i = 0; i < n; ++i) list[i] = i * 0x9E3779B97F4A7C15ULL;
+  return list;
+}
+
+// The element-by-element loop the list codecs used before the bulk paths, kept as a baseline.
+template <typename Order>
+void WritePerElement(ByteBuf& buf, const std::vector<uint64_t>& list) {
+  buf.write_as<Order, uint32_t>(static_cast<uint32_t>(list.size()));
+  for (const auto& v : list) buf.write_as<Order, uint64_t>(v);
+}
+
+template <typename Order>
+std::vector<uint64_t> ReadPerElement(ByteBufView& buf) {
+  uint32_t count = buf.read_as<Order, uint32_t>();
+  std::vector<uint64_t> result;
+  result.reserve(count);
+  for (size_t i = 0; i < count; ++i) result.push_back(buf.read_as<Order, uint64_t>());
+  return result;
+}
+
+template <typename Order>
+void BM_WriteU64ListBulk(benchmark::State& state) {
+  auto list = MakeList(state.range(0));
+  ByteBuf buf(list.size() * 8 + 4);
+  for (auto _ : state) {
+    buf.reset();
+    codec::write_basic_type_as<Order, uint32_t, uint64_t>(buf, list);
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetBytesProcessed(state.iterations() * list.size() * 8);
+}
+
+template <typename Order>
+void BM_WriteU64ListPerElement(benchmark::State& state) {
+  auto list = MakeList(state.range(0));
+  ByteBuf buf(list.size() * 8 + 4);
+  for (auto _ : state) {
+    buf.reset();
+    WritePerElement<Order>(buf, list);
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetBytesProcessed(state.iterations() * list.size() * 8);
+}
+
+template <typename Order>
+void BM_ReadU64ListBulk(benchmark::State& state) {
+  ByteBuf buf;
+  codec::write_basic_type_as<Order, uint32_t, uint64_t>(buf, MakeList(state.range(0)));
+  for (auto _ : state) {
+    ByteBufView view(buf.data(), buf.size());
+    auto list = codec::read_basic_type_as<Order, uint32_t, uint64_t>(view);
+    benchmark::DoNotOptimize(list.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+}
+
+template <typename Order>
+void BM_ReadU64ListPerElement(benchmark::State& state) {
+  ByteBuf buf;
+  codec::write_basic_type_as<Order, uint32_t, uint64_t>(buf, MakeList(state.range(0)));
+  for (auto _ : state) {
+    ByteBufView view(buf.data(), buf.size());
+    auto list = ReadPerElement<Order>(view);
+    benchmark::DoNotOptimize(list.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+}
+
+}  // namespace
+
+#define LIST_SIZES Arg(10)->Arg(1 << 10)->Arg(64 << 10)
+
+BENCHMARK_TEMPLATE(BM_WriteU64ListPerElement, LittleEndian)->LIST_SIZES;
+BENCHMARK_TEMPLATE(BM_WriteU64ListBulk, LittleEndian)->LIST_SIZES;
+BENCHMARK_TEMPLATE(BM_WriteU64ListPerElement, BigEndian)->LIST_SIZES;
+BENCHMARK_TEMPLATE(BM_WriteU64ListBulk, BigEndian)->LIST_SIZES;
+BENCHMARK_TEMPLATE(BM_ReadU64ListPerElement, LittleEndian)->LIST_SIZES;
+BENCHMARK_TEMPLATE(BM_ReadU64ListBulk, LittleEndian)->LIST_SIZES;
+BENCHMARK_TEMPLATE(BM_ReadU64ListPerElement, BigEndian)->LIST_SIZES;
+BENCHMARK_TEMPLATE(BM_ReadU64ListBulk, BigEndian)->LIST_SIZES;
+
+BENCHMARK_MAIN();
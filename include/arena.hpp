@@ -0,0 +1,143 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace codec {
+
+// ----------------------------
+// Decode arena
+// ----------------------------
+// Lets a whole frame decode into one bump allocator: open an ArenaScope on a DecodeArena, decode,
+// use the message, destroy it, then release() the arena in O(1). Outside a scope everything
+// allocates from the global heap exactly as before.
+//
+//   codec::DecodeArena arena;
+//   for (...) {
+//     {
+//       codec::ArenaScope scope(arena);
+//       SzseBinary frame;
+//       frame.decode(view);
+//       handle(frame);
+//     }
+//     arena.release();
+//   }
+//
+// The arena is opt-in at build time: generated list fields are codec::List<T> / codec::StringList,
+// which are plain std::vector<T> / std::vector<std::string> unless CODEC_DECODE_ARENA is defined.
+// With it they become ArenaVector<T> / ArenaVector<ArenaString>, so string elements come from the
+// arena too. The define changes the message layouts, so every translation unit of a program must
+// agree on it (set it with target_compile_definitions, not in a source file).
+//
+// Decoded memory belongs to the arena: a message (or any list moved out of it) must not outlive
+// the next release(). Copies are safe, they allocate from whatever is current when they are made.
+
+namespace detail {
+inline std::pmr::memory_resource*& current_resource_slot() {
+  static thread_local std::pmr::memory_resource* resource = std::pmr::new_delete_resource();
+  return resource;
+}
+}  // namespace detail
+
+// Resource that ArenaAllocators created on this thread draw from.
+inline std::pmr::memory_resource* current_resource() { return detail::current_resource_slot(); }
+
+class DecodeArena {
+ public:
+  static constexpr size_t kDefaultInitialSize = 64 * 1024;
+
+  explicit DecodeArena(size_t initialSize = kDefaultInitialSize)
+      : buffer_(new std::byte[initialSize]), resource_(buffer_.get(), initialSize) {}
+
+  DecodeArena(const DecodeArena&) = delete;
+  DecodeArena& operator=(const DecodeArena&) = delete;
+
+  std::pmr::memory_resource* resource() { return &resource_; }
+
+  // Drops everything allocated since the last release; the initial block is reused, and blocks
+  // that overflowed it go back to the heap.
+  void release() { resource_.release(); }
+
+ private:
+  std::unique_ptr<std::byte[]> buffer_;
+  std::pmr::monotonic_buffer_resource resource_;
+};
+
+// Makes `arena` (or any memory_resource) current on this thread for the life of the scope.
+class ArenaScope {
+ public:
+  explicit ArenaScope(DecodeArena& arena) : ArenaScope(arena.resource()) {}
+  explicit ArenaScope(std::pmr::memory_resource* resource)
+      : previous_(detail::current_resource_slot()) {
+    detail::current_resource_slot() = resource;
+  }
+  ~ArenaScope() { detail::current_resource_slot() = previous_; }
+
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+
+ private:
+  std::pmr::memory_resource* previous_;
+};
+
+// Stateful allocator that binds to current_resource() when it is created. Moves carry the
+// binding along (so a list decoded in a scope keeps its arena storage when assigned into a
+// message); copies rebind to whatever is current at the time of the copy.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_swap = std::true_type;
+
+  ArenaAllocator() noexcept : resource_(current_resource()) {}
+  explicit ArenaAllocator(std::pmr::memory_resource* resource) noexcept : resource_(resource) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept : resource_(other.resource()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T* p, size_t n) { resource_->deallocate(p, n * sizeof(T), alignof(T)); }
+
+  ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+  std::pmr::memory_resource* resource() const { return resource_; }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return resource_ == other.resource() || resource_->is_equal(*other.resource());
+  }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  std::pmr::memory_resource* resource_;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+// List types of the generated message fields.
+#if defined(CODEC_DECODE_ARENA)
+template <typename T>
+using List = ArenaVector<T>;
+using ListString = ArenaString;
+#else
+template <typename T>
+using List = std::vector<T>;
+using ListString = std::string;
+#endif
+using StringList = List<ListString>;
+
+}  // namespace codec
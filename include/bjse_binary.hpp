@@ -6,42 +6,78 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 #include <iostream>
 #include "include/codec.hpp"
 #include "include/bytebuf.hpp"
 #include "include/checksum.hpp"
+#include "include/frame_patcher.hpp"
+#include "include/stream_framer.hpp"
 #include "message_factory.hpp"
 
-struct Logon : public codec::BinaryCodec {
-    std::string senderCompId;
-    std::string targetCompId;
+struct Logon final : public codec::BinaryCodec {
+    codec::FixedString<20> senderCompId;
+    codec::FixedString<20> targetCompId;
     int32_t heartBtInt;
-    std::string password;
-    std::string defaultApplVerId;
+    codec::FixedString<16> password;
+    codec::FixedString<32> defaultApplVerId;
+
+    enum class Field : uint8_t {
+        senderCompId,
+        targetCompId,
+        heartBtInt,
+        password,
+        defaultApplVerId,
+    };
+
+    static constexpr size_t kWireSize = 92;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, senderCompId, 20);
-        codec::write_fixed_string(buf, targetCompId, 20);
-        buf.write_i32_le(heartBtInt);
-        codec::write_fixed_string(buf, password, 16);
-        codec::write_fixed_string(buf, defaultApplVerId, 32);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, senderCompId, 20);
+        codec::write_fixed_string(out, targetCompId, 20);
+        out.write_i32_le(heartBtInt);
+        codec::write_fixed_string(out, password, 16);
+        codec::write_fixed_string(out, defaultApplVerId, 32);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        senderCompId = codec::read_fixed_string(buf, 20);
-        targetCompId = codec::read_fixed_string(buf, 20);
+    void decode(ByteBufView& buf) override {
+        senderCompId = codec::read_fixed_string<20>(buf);
+        targetCompId = codec::read_fixed_string<20>(buf);
         heartBtInt = buf.read_i32_le();
-        password = codec::read_fixed_string(buf, 16);
-        defaultApplVerId = codec::read_fixed_string(buf, 32);
+        password = codec::read_fixed_string<16>(buf);
+        defaultApplVerId = codec::read_fixed_string<32>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::senderCompId)) senderCompId = codec::read_fixed_string<20>(buf);
+        else buf.skip_bytes(20);
+        if(mask.has(Field::targetCompId)) targetCompId = codec::read_fixed_string<20>(buf);
+        else buf.skip_bytes(20);
+        if(mask.has(Field::heartBtInt)) heartBtInt = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::password)) password = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::defaultApplVerId)) defaultApplVerId = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Logon*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Logon)) return false;
+        const auto* checkType = static_cast<const Logon*>(&other);
         return senderCompId == checkType->senderCompId
                && targetCompId == checkType->targetCompId
                && heartBtInt == checkType->heartBtInt
@@ -71,26 +107,78 @@ inline std::ostream& operator<<(std::ostream& os, const Logon& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Logon: each accessor decodes one field in place from the
+// wire bytes. Covers the first 92 bytes, the part of the layout with fixed offsets.
+class LogonView {
+public:
+    static constexpr size_t kFixedSize = 92;
+
+    explicit LogonView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view senderCompId() const { return codec::fixed_string_view(data_ + 0, 20); }
+    std::string_view targetCompId() const { return codec::fixed_string_view(data_ + 20, 20); }
+    int32_t heartBtInt() const { return LittleEndian::load<int32_t>(data_ + 40); }
+    std::string_view password() const { return codec::fixed_string_view(data_ + 44, 16); }
+    std::string_view defaultApplVerId() const { return codec::fixed_string_view(data_ + 60, 32); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a Logon.
+struct LogonWire {
+    static void setSenderCompId(codec::FramePatcher& frame, std::string_view senderCompId) { frame.put_fixed_string(frame.spec().headerSize + 0, senderCompId, 20); }
+    static void setTargetCompId(codec::FramePatcher& frame, std::string_view targetCompId) { frame.put_fixed_string(frame.spec().headerSize + 20, targetCompId, 20); }
+    static void setHeartBtInt(codec::FramePatcher& frame, int32_t heartBtInt) { frame.put<LittleEndian>(frame.spec().headerSize + 40, heartBtInt); }
+    static void setPassword(codec::FramePatcher& frame, std::string_view password) { frame.put_fixed_string(frame.spec().headerSize + 44, password, 16); }
+    static void setDefaultApplVerId(codec::FramePatcher& frame, std::string_view defaultApplVerId) { frame.put_fixed_string(frame.spec().headerSize + 60, defaultApplVerId, 32); }
+};
+
 
-struct Logout : public codec::BinaryCodec {
+struct Logout final : public codec::BinaryCodec {
     int32_t sessionStatus;
-    std::string text;
+    codec::FixedString<200> text;
+
+    enum class Field : uint8_t {
+        sessionStatus,
+        text,
+    };
+
+    static constexpr size_t kWireSize = 204;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(sessionStatus);
-        codec::write_fixed_string(buf, text, 200);
+        auto out = buf.claim(kWireSize);
+        out.write_i32_le(sessionStatus);
+        codec::write_fixed_string(out, text, 200);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         sessionStatus = buf.read_i32_le();
-        text = codec::read_fixed_string(buf, 200);
+        text = codec::read_fixed_string<200>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::sessionStatus)) sessionStatus = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::text)) text = codec::read_fixed_string<200>(buf);
+        else buf.skip_bytes(200);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Logout*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Logout)) return false;
+        const auto* checkType = static_cast<const Logout*>(&other);
         return sessionStatus == checkType->sessionStatus
                && text == checkType->text;
     }
@@ -111,21 +199,54 @@ inline std::ostream& operator<<(std::ostream& os, const Logout& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Logout: each accessor decodes one field in place from the
+// wire bytes. Covers the first 204 bytes, the part of the layout with fixed offsets.
+class LogoutView {
+public:
+    static constexpr size_t kFixedSize = 204;
+
+    explicit LogoutView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t sessionStatus() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    std::string_view text() const { return codec::fixed_string_view(data_ + 4, 200); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a Logout.
+struct LogoutWire {
+    static void setSessionStatus(codec::FramePatcher& frame, int32_t sessionStatus) { frame.put<LittleEndian>(frame.spec().headerSize + 0, sessionStatus); }
+    static void setText(codec::FramePatcher& frame, std::string_view text) { frame.put_fixed_string(frame.spec().headerSize + 4, text, 200); }
+};
+
 
-struct Heartbeat : public codec::BinaryCodec {
+struct Heartbeat final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Heartbeat*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(Heartbeat);
     }
     
     std::string toString() const override {
@@ -142,40 +263,78 @@ inline std::ostream& operator<<(std::ostream& os, const Heartbeat& pkt) {
 }
 
 
-struct ExtendNewOrder010 : public codec::BinaryCodec {
+struct ExtendNewOrder010 final : public codec::BinaryCodec {
     int64_t stopPx;
     int64_t minQty;
     uint16_t maxPriceLevels;
-    std::string timeInForce;
-    std::string cashMargin;
-    std::string settlType;
-    std::string settlPeriod;
+    codec::FixedString<1> timeInForce;
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<1> settlType;
+    codec::FixedString<1> settlPeriod;
+
+    enum class Field : uint8_t {
+        stopPx,
+        minQty,
+        maxPriceLevels,
+        timeInForce,
+        cashMargin,
+        settlType,
+        settlPeriod,
+    };
+
+    static constexpr size_t kWireSize = 22;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i64_le(stopPx);
-        buf.write_i64_le(minQty);
-        buf.write_u16_le(maxPriceLevels);
-        codec::write_fixed_string(buf, timeInForce, 1);
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, settlType, 1);
-        codec::write_fixed_string(buf, settlPeriod, 1);
+        auto out = buf.claim(kWireSize);
+        out.write_i64_le(stopPx);
+        out.write_i64_le(minQty);
+        out.write_u16_le(maxPriceLevels);
+        codec::write_fixed_string(out, timeInForce, 1);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, settlType, 1);
+        codec::write_fixed_string(out, settlPeriod, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         stopPx = buf.read_i64_le();
         minQty = buf.read_i64_le();
         maxPriceLevels = buf.read_u16_le();
-        timeInForce = codec::read_fixed_string(buf, 1);
-        cashMargin = codec::read_fixed_string(buf, 1);
-        settlType = codec::read_fixed_string(buf, 1);
-        settlPeriod = codec::read_fixed_string(buf, 1);
+        timeInForce = codec::read_fixed_string<1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+        settlType = codec::read_fixed_string<1>(buf);
+        settlPeriod = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::stopPx)) stopPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::minQty)) minQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::maxPriceLevels)) maxPriceLevels = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::timeInForce)) timeInForce = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::settlType)) settlType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::settlPeriod)) settlPeriod = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder010*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExtendNewOrder010)) return false;
+        const auto* checkType = static_cast<const ExtendNewOrder010*>(&other);
         return stopPx == checkType->stopPx
                && minQty == checkType->minQty
                && maxPriceLevels == checkType->maxPriceLevels
@@ -211,35 +370,89 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder010& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ExtendNewOrder010: each accessor decodes one field in place from the
+// wire bytes. Covers the first 22 bytes, the part of the layout with fixed offsets.
+class ExtendNewOrder010View {
+public:
+    static constexpr size_t kFixedSize = 22;
+
+    explicit ExtendNewOrder010View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int64_t stopPx() const { return LittleEndian::load<int64_t>(data_ + 0); }
+    int64_t minQty() const { return LittleEndian::load<int64_t>(data_ + 8); }
+    uint16_t maxPriceLevels() const { return LittleEndian::load<uint16_t>(data_ + 16); }
+    std::string_view timeInForce() const { return codec::fixed_string_view(data_ + 18, 1); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 19, 1); }
+    std::string_view settlType() const { return codec::fixed_string_view(data_ + 20, 1); }
+    std::string_view settlPeriod() const { return codec::fixed_string_view(data_ + 21, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct ExtendNewOrder040 : public codec::BinaryCodec {
+struct ExtendNewOrder040 final : public codec::BinaryCodec {
     int64_t stopPx;
     int64_t minQty;
     uint16_t maxPriceLevels;
-    std::string timeInForce;
-    std::string cashMargin;
+    codec::FixedString<1> timeInForce;
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        stopPx,
+        minQty,
+        maxPriceLevels,
+        timeInForce,
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 20;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i64_le(stopPx);
-        buf.write_i64_le(minQty);
-        buf.write_u16_le(maxPriceLevels);
-        codec::write_fixed_string(buf, timeInForce, 1);
-        codec::write_fixed_string(buf, cashMargin, 1);
+        auto out = buf.claim(kWireSize);
+        out.write_i64_le(stopPx);
+        out.write_i64_le(minQty);
+        out.write_u16_le(maxPriceLevels);
+        codec::write_fixed_string(out, timeInForce, 1);
+        codec::write_fixed_string(out, cashMargin, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         stopPx = buf.read_i64_le();
         minQty = buf.read_i64_le();
         maxPriceLevels = buf.read_u16_le();
-        timeInForce = codec::read_fixed_string(buf, 1);
-        cashMargin = codec::read_fixed_string(buf, 1);
+        timeInForce = codec::read_fixed_string<1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::stopPx)) stopPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::minQty)) minQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::maxPriceLevels)) maxPriceLevels = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::timeInForce)) timeInForce = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder040*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExtendNewOrder040)) return false;
+        const auto* checkType = static_cast<const ExtendNewOrder040*>(&other);
         return stopPx == checkType->stopPx
                && minQty == checkType->minQty
                && maxPriceLevels == checkType->maxPriceLevels
@@ -269,21 +482,51 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder040& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ExtendNewOrder040: each accessor decodes one field in place from the
+// wire bytes. Covers the first 20 bytes, the part of the layout with fixed offsets.
+class ExtendNewOrder040View {
+public:
+    static constexpr size_t kFixedSize = 20;
+
+    explicit ExtendNewOrder040View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int64_t stopPx() const { return LittleEndian::load<int64_t>(data_ + 0); }
+    int64_t minQty() const { return LittleEndian::load<int64_t>(data_ + 8); }
+    uint16_t maxPriceLevels() const { return LittleEndian::load<uint16_t>(data_ + 16); }
+    std::string_view timeInForce() const { return codec::fixed_string_view(data_ + 18, 1); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 19, 1); }
 
-struct ExtendNewOrder041 : public codec::BinaryCodec {
+private:
+    const uint8_t* data_;
+};
+
+
+struct ExtendNewOrder041 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder041*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ExtendNewOrder041);
     }
     
     std::string toString() const override {
@@ -300,20 +543,30 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder041& pkt)
 }
 
 
-struct ExtendNewOrder042 : public codec::BinaryCodec {
+struct ExtendNewOrder042 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder042*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ExtendNewOrder042);
     }
     
     std::string toString() const override {
@@ -330,20 +583,30 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder042& pkt)
 }
 
 
-struct ExtendNewOrder043 : public codec::BinaryCodec {
+struct ExtendNewOrder043 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder043*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ExtendNewOrder043);
     }
     
     std::string toString() const override {
@@ -360,20 +623,30 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder043& pkt)
 }
 
 
-struct ExtendNewOrder044 : public codec::BinaryCodec {
+struct ExtendNewOrder044 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder044*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ExtendNewOrder044);
     }
     
     std::string toString() const override {
@@ -390,20 +663,30 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder044& pkt)
 }
 
 
-struct ExtendNewOrder045 : public codec::BinaryCodec {
+struct ExtendNewOrder045 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder045*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ExtendNewOrder045);
     }
     
     std::string toString() const override {
@@ -420,28 +703,54 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder045& pkt)
 }
 
 
-struct ExtendNewOrder050 : public codec::BinaryCodec {
+struct ExtendNewOrder050 final : public codec::BinaryCodec {
     uint16_t expirationDays;
     uint8_t expirationType;
-    std::string shareProperty;
+    codec::FixedString<2> shareProperty;
+
+    enum class Field : uint8_t {
+        expirationDays,
+        expirationType,
+        shareProperty,
+    };
+
+    static constexpr size_t kWireSize = 5;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(expirationDays);
-        buf.write_u8(expirationType);
-        codec::write_fixed_string(buf, shareProperty, 2);
+        auto out = buf.claim(kWireSize);
+        out.write_u16_le(expirationDays);
+        out.write_u8(expirationType);
+        codec::write_fixed_string(out, shareProperty, 2);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         expirationDays = buf.read_u16_le();
         expirationType = buf.read_u8();
-        shareProperty = codec::read_fixed_string(buf, 2);
+        shareProperty = codec::read_fixed_string<2>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::expirationDays)) expirationDays = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::expirationType)) expirationType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::shareProperty)) shareProperty = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExtendNewOrder050*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExtendNewOrder050)) return false;
+        const auto* checkType = static_cast<const ExtendNewOrder050*>(&other);
         return expirationDays == checkType->expirationDays
                && expirationType == checkType->expirationType
                && shareProperty == checkType->shareProperty;
@@ -465,84 +774,267 @@ inline std::ostream& operator<<(std::ostream& os, const ExtendNewOrder050& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ExtendNewOrder050: each accessor decodes one field in place from the
+// wire bytes. Covers the first 5 bytes, the part of the layout with fixed offsets.
+class ExtendNewOrder050View {
+public:
+    static constexpr size_t kFixedSize = 5;
+
+    explicit ExtendNewOrder050View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t expirationDays() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint8_t expirationType() const { return DefaultByteOrder::load<uint8_t>(data_ + 2); }
+    std::string_view shareProperty() const { return codec::fixed_string_view(data_ + 3, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct NewOrderTag{};
 using NewOrderMessageFactory = MessageFactory<std::string, codec::BinaryCodec, NewOrderTag>;
-REGISTER_MESSAGE(NewOrderMessageFactory, "010", ExtendNewOrder010);
-REGISTER_MESSAGE(NewOrderMessageFactory, "040", ExtendNewOrder040);
-REGISTER_MESSAGE(NewOrderMessageFactory, "041", ExtendNewOrder041);
-REGISTER_MESSAGE(NewOrderMessageFactory, "042", ExtendNewOrder042);
-REGISTER_MESSAGE(NewOrderMessageFactory, "043", ExtendNewOrder043);
-REGISTER_MESSAGE(NewOrderMessageFactory, "044", ExtendNewOrder044);
-REGISTER_MESSAGE(NewOrderMessageFactory, "045", ExtendNewOrder045);
-REGISTER_MESSAGE(NewOrderMessageFactory, "050", ExtendNewOrder050);
-
-
-struct NewOrder : public codec::BinaryCodec {
-    std::string applId;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+template <>
+struct GeneratedMessages<NewOrderTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("010"):
+                return std::make_unique<ExtendNewOrder010>();
+            case codec::pack_key("040"):
+                return std::make_unique<ExtendNewOrder040>();
+            case codec::pack_key("041"):
+                return std::make_unique<ExtendNewOrder041>();
+            case codec::pack_key("042"):
+                return std::make_unique<ExtendNewOrder042>();
+            case codec::pack_key("043"):
+                return std::make_unique<ExtendNewOrder043>();
+            case codec::pack_key("044"):
+                return std::make_unique<ExtendNewOrder044>();
+            case codec::pack_key("045"):
+                return std::make_unique<ExtendNewOrder045>();
+            case codec::pack_key("050"):
+                return std::make_unique<ExtendNewOrder050>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using NewOrderApplExtend = codec::InlineMessage<ExtendNewOrder010, ExtendNewOrder040, ExtendNewOrder041, ExtendNewOrder042, ExtendNewOrder043, ExtendNewOrder044, ExtendNewOrder045, ExtendNewOrder050>;
+
+
+struct NewOrder final : public codec::BinaryCodec {
+    codec::FixedString<3> applId;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string clOrdId;
-    std::string accountId;
-    std::string branchId;
-    std::string orderRestrictions;
-    std::string side;
-    std::string ordType;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<4> orderRestrictions;
+    codec::FixedString<1> side;
+    codec::FixedString<1> ordType;
     int64_t orderQty;
     int64_t price;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    NewOrderApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        applId,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        clOrdId,
+        accountId,
+        branchId,
+        orderRestrictions,
+        side,
+        ordType,
+        orderQty,
+        price,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, orderRestrictions, 4);
-        codec::write_fixed_string(buf, side, 1);
-        codec::write_fixed_string(buf, ordType, 1);
-        buf.write_i64_le(orderQty);
-        buf.write_i64_le(price);
+        auto out = buf.claim(109);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, orderRestrictions, 4);
+        codec::write_fixed_string(out, side, 1);
+        codec::write_fixed_string(out, ordType, 1);
+        out.write_i64_le(orderQty);
+        out.write_i64_le(price);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        applId = codec::read_fixed_string(buf, 3);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
+        applId = codec::read_fixed_string<3>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        orderRestrictions = codec::read_fixed_string(buf, 4);
-        side = codec::read_fixed_string(buf, 1);
-        ordType = codec::read_fixed_string(buf, 1);
+        userInfo = codec::read_fixed_string<32>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        orderRestrictions = codec::read_fixed_string<4>(buf);
+        side = codec::read_fixed_string<1>(buf);
+        ordType = codec::read_fixed_string<1>(buf);
         orderQty = buf.read_i64_le();
         price = buf.read_i64_le();
-        applExtend = NewOrderMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("010"):
+                applExtend.emplace<ExtendNewOrder010>().decode(buf);
+                break;
+            case codec::pack_key("040"):
+                applExtend.emplace<ExtendNewOrder040>().decode(buf);
+                break;
+            case codec::pack_key("041"):
+                applExtend.emplace<ExtendNewOrder041>().decode(buf);
+                break;
+            case codec::pack_key("042"):
+                applExtend.emplace<ExtendNewOrder042>().decode(buf);
+                break;
+            case codec::pack_key("043"):
+                applExtend.emplace<ExtendNewOrder043>().decode(buf);
+                break;
+            case codec::pack_key("044"):
+                applExtend.emplace<ExtendNewOrder044>().decode(buf);
+                break;
+            case codec::pack_key("045"):
+                applExtend.emplace<ExtendNewOrder045>().decode(buf);
+                break;
+            case codec::pack_key("050"):
+                applExtend.emplace<ExtendNewOrder050>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::orderRestrictions)) orderRestrictions = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::ordType)) ordType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::price)) price = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("010"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder010>().decode(buf);
+                else ExtendNewOrder010().decode(buf, codec::FieldMask<ExtendNewOrder010::Field>());
+                break;
+            case codec::pack_key("040"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder040>().decode(buf);
+                else ExtendNewOrder040().decode(buf, codec::FieldMask<ExtendNewOrder040::Field>());
+                break;
+            case codec::pack_key("041"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder041>().decode(buf);
+                else ExtendNewOrder041().decode(buf, codec::FieldMask<ExtendNewOrder041::Field>());
+                break;
+            case codec::pack_key("042"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder042>().decode(buf);
+                else ExtendNewOrder042().decode(buf, codec::FieldMask<ExtendNewOrder042::Field>());
+                break;
+            case codec::pack_key("043"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder043>().decode(buf);
+                else ExtendNewOrder043().decode(buf, codec::FieldMask<ExtendNewOrder043::Field>());
+                break;
+            case codec::pack_key("044"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder044>().decode(buf);
+                else ExtendNewOrder044().decode(buf, codec::FieldMask<ExtendNewOrder044::Field>());
+                break;
+            case codec::pack_key("045"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder045>().decode(buf);
+                else ExtendNewOrder045().decode(buf, codec::FieldMask<ExtendNewOrder045::Field>());
+                break;
+            case codec::pack_key("050"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ExtendNewOrder050>().decode(buf);
+                else ExtendNewOrder050().decode(buf, codec::FieldMask<ExtendNewOrder050::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 109
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const NewOrder*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(NewOrder)) return false;
+        const auto* checkType = static_cast<const NewOrder*>(&other);
         return applId == checkType->applId
                && submittingPbuid == checkType->submittingPbuid
                && securityId == checkType->securityId
@@ -608,6 +1100,56 @@ inline std::ostream& operator<<(std::ostream& os, const NewOrder& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded NewOrder: each accessor decodes one field in place from the
+// wire bytes. Covers the first 109 bytes, the part of the layout with fixed offsets.
+class NewOrderView {
+public:
+    static constexpr size_t kFixedSize = 109;
+
+    explicit NewOrderView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 0, 3); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 3, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 9, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 17, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 21); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 23, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 25); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 33, 32); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 65, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 75, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 85, 2); }
+    std::string_view orderRestrictions() const { return codec::fixed_string_view(data_ + 87, 4); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 91, 1); }
+    std::string_view ordType() const { return codec::fixed_string_view(data_ + 92, 1); }
+    int64_t orderQty() const { return LittleEndian::load<int64_t>(data_ + 93); }
+    int64_t price() const { return LittleEndian::load<int64_t>(data_ + 101); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a NewOrder.
+struct NewOrderWire {
+    static void setSubmittingPbuid(codec::FramePatcher& frame, std::string_view submittingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 3, submittingPbuid, 6); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 9, securityId, 8); }
+    static void setSecurityIdsource(codec::FramePatcher& frame, std::string_view securityIdsource) { frame.put_fixed_string(frame.spec().headerSize + 17, securityIdsource, 4); }
+    static void setOwnerType(codec::FramePatcher& frame, uint16_t ownerType) { frame.put<LittleEndian>(frame.spec().headerSize + 21, ownerType); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 23, clearingFirm, 2); }
+    static void setTransactTime(codec::FramePatcher& frame, int64_t transactTime) { frame.put<LittleEndian>(frame.spec().headerSize + 25, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 33, userInfo, 32); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 65, clOrdId, 10); }
+    static void setAccountId(codec::FramePatcher& frame, std::string_view accountId) { frame.put_fixed_string(frame.spec().headerSize + 75, accountId, 10); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 85, branchId, 2); }
+    static void setOrderRestrictions(codec::FramePatcher& frame, std::string_view orderRestrictions) { frame.put_fixed_string(frame.spec().headerSize + 87, orderRestrictions, 4); }
+    static void setSide(codec::FramePatcher& frame, std::string_view side) { frame.put_fixed_string(frame.spec().headerSize + 91, side, 1); }
+    static void setOrdType(codec::FramePatcher& frame, std::string_view ordType) { frame.put_fixed_string(frame.spec().headerSize + 92, ordType, 1); }
+    static void setOrderQty(codec::FramePatcher& frame, int64_t orderQty) { frame.put<LittleEndian>(frame.spec().headerSize + 93, orderQty); }
+    static void setPrice(codec::FramePatcher& frame, int64_t price) { frame.put<LittleEndian>(frame.spec().headerSize + 101, price); }
+};
+
 
 
 
@@ -617,61 +1159,120 @@ inline std::ostream& operator<<(std::ostream& os, const NewOrder& pkt) {
 
 
 
-struct OrderCancelRequest : public codec::BinaryCodec {
-    std::string applId;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+struct OrderCancelRequest final : public codec::BinaryCodec {
+    codec::FixedString<3> applId;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string clOrdId;
-    std::string origClOrdId;
-    std::string accountId;
-    std::string branchId;
-    std::string orderId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<10> origClOrdId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<16> orderId;
     int64_t orderQty;
 
+    enum class Field : uint8_t {
+        applId,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        clOrdId,
+        origClOrdId,
+        accountId,
+        branchId,
+        orderId,
+        orderQty,
+    };
+
+    static constexpr size_t kWireSize = 121;
+
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, origClOrdId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, orderId, 16);
-        buf.write_i64_le(orderQty);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
-        applId = codec::read_fixed_string(buf, 3);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, origClOrdId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, orderId, 16);
+        out.write_i64_le(orderQty);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        applId = codec::read_fixed_string<3>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        origClOrdId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        orderId = codec::read_fixed_string(buf, 16);
+        userInfo = codec::read_fixed_string<32>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        origClOrdId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        orderId = codec::read_fixed_string<16>(buf);
         orderQty = buf.read_i64_le();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::applId)) applId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::orderId)) orderId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const OrderCancelRequest*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(OrderCancelRequest)) return false;
+        const auto* checkType = static_cast<const OrderCancelRequest*>(&other);
         return applId == checkType->applId
                && submittingPbuid == checkType->submittingPbuid
                && securityId == checkType->securityId
@@ -728,77 +1329,197 @@ inline std::ostream& operator<<(std::ostream& os, const OrderCancelRequest& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded OrderCancelRequest: each accessor decodes one field in place from the
+// wire bytes. Covers the first 121 bytes, the part of the layout with fixed offsets.
+class OrderCancelRequestView {
+public:
+    static constexpr size_t kFixedSize = 121;
+
+    explicit OrderCancelRequestView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 0, 3); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 3, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 9, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 17, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 21); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 23, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 25); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 33, 32); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 65, 10); }
+    std::string_view origClOrdId() const { return codec::fixed_string_view(data_ + 75, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 85, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 95, 2); }
+    std::string_view orderId() const { return codec::fixed_string_view(data_ + 97, 16); }
+    int64_t orderQty() const { return LittleEndian::load<int64_t>(data_ + 113); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a OrderCancelRequest.
+struct OrderCancelRequestWire {
+    static void setSubmittingPbuid(codec::FramePatcher& frame, std::string_view submittingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 3, submittingPbuid, 6); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 9, securityId, 8); }
+    static void setSecurityIdsource(codec::FramePatcher& frame, std::string_view securityIdsource) { frame.put_fixed_string(frame.spec().headerSize + 17, securityIdsource, 4); }
+    static void setOwnerType(codec::FramePatcher& frame, uint16_t ownerType) { frame.put<LittleEndian>(frame.spec().headerSize + 21, ownerType); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 23, clearingFirm, 2); }
+    static void setTransactTime(codec::FramePatcher& frame, int64_t transactTime) { frame.put<LittleEndian>(frame.spec().headerSize + 25, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 33, userInfo, 32); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 65, clOrdId, 10); }
+    static void setOrigClOrdId(codec::FramePatcher& frame, std::string_view origClOrdId) { frame.put_fixed_string(frame.spec().headerSize + 75, origClOrdId, 10); }
+    static void setAccountId(codec::FramePatcher& frame, std::string_view accountId) { frame.put_fixed_string(frame.spec().headerSize + 85, accountId, 10); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 95, branchId, 2); }
+    static void setOrderId(codec::FramePatcher& frame, std::string_view orderId) { frame.put_fixed_string(frame.spec().headerSize + 97, orderId, 16); }
+    static void setOrderQty(codec::FramePatcher& frame, int64_t orderQty) { frame.put<LittleEndian>(frame.spec().headerSize + 113, orderQty); }
+};
+
 
-struct CancelReject : public codec::BinaryCodec {
+struct CancelReject final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string clOrdId;
-    std::string origClOrdId;
-    std::string accountId;
-    std::string branchId;
-    std::string ordStatus;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<10> origClOrdId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<1> ordStatus;
     uint16_t cxlRejReason;
-    std::string rejectText;
-    std::string orderId;
+    codec::FixedString<16> rejectText;
+    codec::FixedString<16> orderId;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        clOrdId,
+        origClOrdId,
+        accountId,
+        branchId,
+        ordStatus,
+        cxlRejReason,
+        rejectText,
+        orderId,
+    };
+
+    static constexpr size_t kWireSize = 150;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, origClOrdId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, ordStatus, 1);
-        buf.write_u16_le(cxlRejReason);
-        codec::write_fixed_string(buf, rejectText, 16);
-        codec::write_fixed_string(buf, orderId, 16);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
+        auto out = buf.claim(kWireSize);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, origClOrdId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, ordStatus, 1);
+        out.write_u16_le(cxlRejReason);
+        codec::write_fixed_string(out, rejectText, 16);
+        codec::write_fixed_string(out, orderId, 16);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        origClOrdId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        ordStatus = codec::read_fixed_string(buf, 1);
+        userInfo = codec::read_fixed_string<32>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        origClOrdId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        ordStatus = codec::read_fixed_string<1>(buf);
         cxlRejReason = buf.read_u16_le();
-        rejectText = codec::read_fixed_string(buf, 16);
-        orderId = codec::read_fixed_string(buf, 16);
+        rejectText = codec::read_fixed_string<16>(buf);
+        orderId = codec::read_fixed_string<16>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::applId)) applId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::ordStatus)) ordStatus = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cxlRejReason)) cxlRejReason = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::rejectText)) rejectText = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::orderId)) orderId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const CancelReject*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(CancelReject)) return false;
+        const auto* checkType = static_cast<const CancelReject*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -870,35 +1591,123 @@ inline std::ostream& operator<<(std::ostream& os, const CancelReject& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded CancelReject: each accessor decodes one field in place from the
+// wire bytes. Covers the first 150 bytes, the part of the layout with fixed offsets.
+class CancelRejectView {
+public:
+    static constexpr size_t kFixedSize = 150;
+
+    explicit CancelRejectView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 83, 10); }
+    std::string_view origClOrdId() const { return codec::fixed_string_view(data_ + 93, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 103, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 113, 2); }
+    std::string_view ordStatus() const { return codec::fixed_string_view(data_ + 115, 1); }
+    uint16_t cxlRejReason() const { return LittleEndian::load<uint16_t>(data_ + 116); }
+    std::string_view rejectText() const { return codec::fixed_string_view(data_ + 118, 16); }
+    std::string_view orderId() const { return codec::fixed_string_view(data_ + 134, 16); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a CancelReject.
+struct CancelRejectWire {
+    static void setPartitionNo(codec::FramePatcher& frame, int32_t partitionNo) { frame.put<LittleEndian>(frame.spec().headerSize + 0, partitionNo); }
+    static void setReportIndex(codec::FramePatcher& frame, int64_t reportIndex) { frame.put<LittleEndian>(frame.spec().headerSize + 4, reportIndex); }
+    static void setReportingPbuid(codec::FramePatcher& frame, std::string_view reportingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 15, reportingPbuid, 6); }
+    static void setSubmittingPbuid(codec::FramePatcher& frame, std::string_view submittingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 21, submittingPbuid, 6); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 27, securityId, 8); }
+    static void setSecurityIdsource(codec::FramePatcher& frame, std::string_view securityIdsource) { frame.put_fixed_string(frame.spec().headerSize + 35, securityIdsource, 4); }
+    static void setOwnerType(codec::FramePatcher& frame, uint16_t ownerType) { frame.put<LittleEndian>(frame.spec().headerSize + 39, ownerType); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 41, clearingFirm, 2); }
+    static void setTransactTime(codec::FramePatcher& frame, int64_t transactTime) { frame.put<LittleEndian>(frame.spec().headerSize + 43, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 51, userInfo, 32); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 83, clOrdId, 10); }
+    static void setOrigClOrdId(codec::FramePatcher& frame, std::string_view origClOrdId) { frame.put_fixed_string(frame.spec().headerSize + 93, origClOrdId, 10); }
+    static void setAccountId(codec::FramePatcher& frame, std::string_view accountId) { frame.put_fixed_string(frame.spec().headerSize + 103, accountId, 10); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 113, branchId, 2); }
+    static void setOrdStatus(codec::FramePatcher& frame, std::string_view ordStatus) { frame.put_fixed_string(frame.spec().headerSize + 115, ordStatus, 1); }
+    static void setCxlRejReason(codec::FramePatcher& frame, uint16_t cxlRejReason) { frame.put<LittleEndian>(frame.spec().headerSize + 116, cxlRejReason); }
+    static void setRejectText(codec::FramePatcher& frame, std::string_view rejectText) { frame.put_fixed_string(frame.spec().headerSize + 118, rejectText, 16); }
+    static void setOrderId(codec::FramePatcher& frame, std::string_view orderId) { frame.put_fixed_string(frame.spec().headerSize + 134, orderId, 16); }
+};
+
 
-struct ConfirmExtend010 : public codec::BinaryCodec {
+struct ConfirmExtend010 final : public codec::BinaryCodec {
     int64_t stopPx;
     int64_t minQty;
     uint16_t maxPriceLevels;
-    std::string timeInForce;
-    std::string cashMargin;
+    codec::FixedString<1> timeInForce;
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        stopPx,
+        minQty,
+        maxPriceLevels,
+        timeInForce,
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 20;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i64_le(stopPx);
-        buf.write_i64_le(minQty);
-        buf.write_u16_le(maxPriceLevels);
-        codec::write_fixed_string(buf, timeInForce, 1);
-        codec::write_fixed_string(buf, cashMargin, 1);
+        auto out = buf.claim(kWireSize);
+        out.write_i64_le(stopPx);
+        out.write_i64_le(minQty);
+        out.write_u16_le(maxPriceLevels);
+        codec::write_fixed_string(out, timeInForce, 1);
+        codec::write_fixed_string(out, cashMargin, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         stopPx = buf.read_i64_le();
         minQty = buf.read_i64_le();
         maxPriceLevels = buf.read_u16_le();
-        timeInForce = codec::read_fixed_string(buf, 1);
-        cashMargin = codec::read_fixed_string(buf, 1);
+        timeInForce = codec::read_fixed_string<1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::stopPx)) stopPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::minQty)) minQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::maxPriceLevels)) maxPriceLevels = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::timeInForce)) timeInForce = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend010*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ConfirmExtend010)) return false;
+        const auto* checkType = static_cast<const ConfirmExtend010*>(&other);
         return stopPx == checkType->stopPx
                && minQty == checkType->minQty
                && maxPriceLevels == checkType->maxPriceLevels
@@ -928,35 +1737,87 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend010& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ConfirmExtend010: each accessor decodes one field in place from the
+// wire bytes. Covers the first 20 bytes, the part of the layout with fixed offsets.
+class ConfirmExtend010View {
+public:
+    static constexpr size_t kFixedSize = 20;
+
+    explicit ConfirmExtend010View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int64_t stopPx() const { return LittleEndian::load<int64_t>(data_ + 0); }
+    int64_t minQty() const { return LittleEndian::load<int64_t>(data_ + 8); }
+    uint16_t maxPriceLevels() const { return LittleEndian::load<uint16_t>(data_ + 16); }
+    std::string_view timeInForce() const { return codec::fixed_string_view(data_ + 18, 1); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 19, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct ConfirmExtend040 : public codec::BinaryCodec {
+struct ConfirmExtend040 final : public codec::BinaryCodec {
     int64_t stopPx;
     int64_t minQty;
     uint16_t maxPriceLevels;
-    std::string timeInForce;
-    std::string cashMargin;
+    codec::FixedString<1> timeInForce;
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        stopPx,
+        minQty,
+        maxPriceLevels,
+        timeInForce,
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 20;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i64_le(stopPx);
-        buf.write_i64_le(minQty);
-        buf.write_u16_le(maxPriceLevels);
-        codec::write_fixed_string(buf, timeInForce, 1);
-        codec::write_fixed_string(buf, cashMargin, 1);
+        auto out = buf.claim(kWireSize);
+        out.write_i64_le(stopPx);
+        out.write_i64_le(minQty);
+        out.write_u16_le(maxPriceLevels);
+        codec::write_fixed_string(out, timeInForce, 1);
+        codec::write_fixed_string(out, cashMargin, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         stopPx = buf.read_i64_le();
         minQty = buf.read_i64_le();
         maxPriceLevels = buf.read_u16_le();
-        timeInForce = codec::read_fixed_string(buf, 1);
-        cashMargin = codec::read_fixed_string(buf, 1);
+        timeInForce = codec::read_fixed_string<1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::stopPx)) stopPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::minQty)) minQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::maxPriceLevels)) maxPriceLevels = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::timeInForce)) timeInForce = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend040*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ConfirmExtend040)) return false;
+        const auto* checkType = static_cast<const ConfirmExtend040*>(&other);
         return stopPx == checkType->stopPx
                && minQty == checkType->minQty
                && maxPriceLevels == checkType->maxPriceLevels
@@ -986,21 +1847,51 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend040& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ConfirmExtend040: each accessor decodes one field in place from the
+// wire bytes. Covers the first 20 bytes, the part of the layout with fixed offsets.
+class ConfirmExtend040View {
+public:
+    static constexpr size_t kFixedSize = 20;
+
+    explicit ConfirmExtend040View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int64_t stopPx() const { return LittleEndian::load<int64_t>(data_ + 0); }
+    int64_t minQty() const { return LittleEndian::load<int64_t>(data_ + 8); }
+    uint16_t maxPriceLevels() const { return LittleEndian::load<uint16_t>(data_ + 16); }
+    std::string_view timeInForce() const { return codec::fixed_string_view(data_ + 18, 1); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 19, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct ConfirmExtend041 final : public codec::BinaryCodec {
 
-struct ConfirmExtend041 : public codec::BinaryCodec {
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend041*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ConfirmExtend041);
     }
     
     std::string toString() const override {
@@ -1017,20 +1908,30 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend041& pkt) {
 }
 
 
-struct ConfirmExtend042 : public codec::BinaryCodec {
+struct ConfirmExtend042 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend042*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ConfirmExtend042);
     }
     
     std::string toString() const override {
@@ -1047,20 +1948,30 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend042& pkt) {
 }
 
 
-struct ConfirmExtend043 : public codec::BinaryCodec {
+struct ConfirmExtend043 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend043*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ConfirmExtend043);
     }
     
     std::string toString() const override {
@@ -1077,20 +1988,30 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend043& pkt) {
 }
 
 
-struct ConfirmExtend044 : public codec::BinaryCodec {
+struct ConfirmExtend044 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend044*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ConfirmExtend044);
     }
     
     std::string toString() const override {
@@ -1107,20 +2028,30 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend044& pkt) {
 }
 
 
-struct ConfirmExtend045 : public codec::BinaryCodec {
+struct ConfirmExtend045 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend045*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(ConfirmExtend045);
     }
     
     std::string toString() const override {
@@ -1137,28 +2068,54 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend045& pkt) {
 }
 
 
-struct ConfirmExtend050 : public codec::BinaryCodec {
+struct ConfirmExtend050 final : public codec::BinaryCodec {
     uint16_t expirationDays;
     uint8_t expirationType;
-    std::string shareProperty;
+    codec::FixedString<2> shareProperty;
+
+    enum class Field : uint8_t {
+        expirationDays,
+        expirationType,
+        shareProperty,
+    };
+
+    static constexpr size_t kWireSize = 5;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(expirationDays);
-        buf.write_u8(expirationType);
-        codec::write_fixed_string(buf, shareProperty, 2);
+        auto out = buf.claim(kWireSize);
+        out.write_u16_le(expirationDays);
+        out.write_u8(expirationType);
+        codec::write_fixed_string(out, shareProperty, 2);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         expirationDays = buf.read_u16_le();
         expirationType = buf.read_u8();
-        shareProperty = codec::read_fixed_string(buf, 2);
+        shareProperty = codec::read_fixed_string<2>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::expirationDays)) expirationDays = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::expirationType)) expirationType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::shareProperty)) shareProperty = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ConfirmExtend050*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ConfirmExtend050)) return false;
+        const auto* checkType = static_cast<const ConfirmExtend050*>(&other);
         return expirationDays == checkType->expirationDays
                && expirationType == checkType->expirationType
                && shareProperty == checkType->shareProperty;
@@ -1182,117 +2139,333 @@ inline std::ostream& operator<<(std::ostream& os, const ConfirmExtend050& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ConfirmExtend050: each accessor decodes one field in place from the
+// wire bytes. Covers the first 5 bytes, the part of the layout with fixed offsets.
+class ConfirmExtend050View {
+public:
+    static constexpr size_t kFixedSize = 5;
+
+    explicit ConfirmExtend050View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t expirationDays() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint8_t expirationType() const { return DefaultByteOrder::load<uint8_t>(data_ + 2); }
+    std::string_view shareProperty() const { return codec::fixed_string_view(data_ + 3, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct ExecutionConfirmTag{};
 using ExecutionConfirmMessageFactory = MessageFactory<std::string, codec::BinaryCodec, ExecutionConfirmTag>;
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "010", ConfirmExtend010);
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "040", ConfirmExtend040);
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "041", ConfirmExtend041);
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "042", ConfirmExtend042);
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "043", ConfirmExtend043);
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "044", ConfirmExtend044);
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "045", ConfirmExtend045);
-REGISTER_MESSAGE(ExecutionConfirmMessageFactory, "050", ConfirmExtend050);
+template <>
+struct GeneratedMessages<ExecutionConfirmTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("010"):
+                return std::make_unique<ConfirmExtend010>();
+            case codec::pack_key("040"):
+                return std::make_unique<ConfirmExtend040>();
+            case codec::pack_key("041"):
+                return std::make_unique<ConfirmExtend041>();
+            case codec::pack_key("042"):
+                return std::make_unique<ConfirmExtend042>();
+            case codec::pack_key("043"):
+                return std::make_unique<ConfirmExtend043>();
+            case codec::pack_key("044"):
+                return std::make_unique<ConfirmExtend044>();
+            case codec::pack_key("045"):
+                return std::make_unique<ConfirmExtend045>();
+            case codec::pack_key("050"):
+                return std::make_unique<ConfirmExtend050>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using ExecutionConfirmApplExtend = codec::InlineMessage<ConfirmExtend010, ConfirmExtend040, ConfirmExtend041, ConfirmExtend042, ConfirmExtend043, ConfirmExtend044, ConfirmExtend045, ConfirmExtend050>;
 
 
-struct ExecutionConfirm : public codec::BinaryCodec {
+struct ExecutionConfirm final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string orderId;
-    std::string clOrdId;
-    std::string origClOrdId;
-    std::string execId;
-    std::string execType;
-    std::string ordStatus;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<16> orderId;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<10> origClOrdId;
+    codec::FixedString<16> execId;
+    codec::FixedString<1> execType;
+    codec::FixedString<1> ordStatus;
     uint16_t ordRejReason;
     int64_t leavesQty;
     int64_t cumQty;
-    std::string side;
-    std::string ordType;
+    codec::FixedString<1> side;
+    codec::FixedString<1> ordType;
     int64_t orderQty;
     int64_t price;
-    std::string accountId;
-    std::string branchId;
-    std::string orderRestrictions;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<4> orderRestrictions;
+    ExecutionConfirmApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        orderId,
+        clOrdId,
+        origClOrdId,
+        execId,
+        execType,
+        ordStatus,
+        ordRejReason,
+        leavesQty,
+        cumQty,
+        side,
+        ordType,
+        orderQty,
+        price,
+        accountId,
+        branchId,
+        orderRestrictions,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, orderId, 16);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, origClOrdId, 10);
-        codec::write_fixed_string(buf, execId, 16);
-        codec::write_fixed_string(buf, execType, 1);
-        codec::write_fixed_string(buf, ordStatus, 1);
-        buf.write_u16_le(ordRejReason);
-        buf.write_i64_le(leavesQty);
-        buf.write_i64_le(cumQty);
-        codec::write_fixed_string(buf, side, 1);
-        codec::write_fixed_string(buf, ordType, 1);
-        buf.write_i64_le(orderQty);
-        buf.write_i64_le(price);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, orderRestrictions, 4);
+        auto out = buf.claim(189);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, orderId, 16);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, origClOrdId, 10);
+        codec::write_fixed_string(out, execId, 16);
+        codec::write_fixed_string(out, execType, 1);
+        codec::write_fixed_string(out, ordStatus, 1);
+        out.write_u16_le(ordRejReason);
+        out.write_i64_le(leavesQty);
+        out.write_i64_le(cumQty);
+        codec::write_fixed_string(out, side, 1);
+        codec::write_fixed_string(out, ordType, 1);
+        out.write_i64_le(orderQty);
+        out.write_i64_le(price);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, orderRestrictions, 4);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        orderId = codec::read_fixed_string(buf, 16);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        origClOrdId = codec::read_fixed_string(buf, 10);
-        execId = codec::read_fixed_string(buf, 16);
-        execType = codec::read_fixed_string(buf, 1);
-        ordStatus = codec::read_fixed_string(buf, 1);
+        userInfo = codec::read_fixed_string<32>(buf);
+        orderId = codec::read_fixed_string<16>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        origClOrdId = codec::read_fixed_string<10>(buf);
+        execId = codec::read_fixed_string<16>(buf);
+        execType = codec::read_fixed_string<1>(buf);
+        ordStatus = codec::read_fixed_string<1>(buf);
         ordRejReason = buf.read_u16_le();
         leavesQty = buf.read_i64_le();
         cumQty = buf.read_i64_le();
-        side = codec::read_fixed_string(buf, 1);
-        ordType = codec::read_fixed_string(buf, 1);
+        side = codec::read_fixed_string<1>(buf);
+        ordType = codec::read_fixed_string<1>(buf);
         orderQty = buf.read_i64_le();
         price = buf.read_i64_le();
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        orderRestrictions = codec::read_fixed_string(buf, 4);
-        applExtend = ExecutionConfirmMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        orderRestrictions = codec::read_fixed_string<4>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("010"):
+                applExtend.emplace<ConfirmExtend010>().decode(buf);
+                break;
+            case codec::pack_key("040"):
+                applExtend.emplace<ConfirmExtend040>().decode(buf);
+                break;
+            case codec::pack_key("041"):
+                applExtend.emplace<ConfirmExtend041>().decode(buf);
+                break;
+            case codec::pack_key("042"):
+                applExtend.emplace<ConfirmExtend042>().decode(buf);
+                break;
+            case codec::pack_key("043"):
+                applExtend.emplace<ConfirmExtend043>().decode(buf);
+                break;
+            case codec::pack_key("044"):
+                applExtend.emplace<ConfirmExtend044>().decode(buf);
+                break;
+            case codec::pack_key("045"):
+                applExtend.emplace<ConfirmExtend045>().decode(buf);
+                break;
+            case codec::pack_key("050"):
+                applExtend.emplace<ConfirmExtend050>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::orderId)) orderId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::execId)) execId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::execType)) execType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::ordStatus)) ordStatus = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::ordRejReason)) ordRejReason = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::leavesQty)) leavesQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::cumQty)) cumQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::ordType)) ordType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::price)) price = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::orderRestrictions)) orderRestrictions = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("010"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend010>().decode(buf);
+                else ConfirmExtend010().decode(buf, codec::FieldMask<ConfirmExtend010::Field>());
+                break;
+            case codec::pack_key("040"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend040>().decode(buf);
+                else ConfirmExtend040().decode(buf, codec::FieldMask<ConfirmExtend040::Field>());
+                break;
+            case codec::pack_key("041"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend041>().decode(buf);
+                else ConfirmExtend041().decode(buf, codec::FieldMask<ConfirmExtend041::Field>());
+                break;
+            case codec::pack_key("042"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend042>().decode(buf);
+                else ConfirmExtend042().decode(buf, codec::FieldMask<ConfirmExtend042::Field>());
+                break;
+            case codec::pack_key("043"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend043>().decode(buf);
+                else ConfirmExtend043().decode(buf, codec::FieldMask<ConfirmExtend043::Field>());
+                break;
+            case codec::pack_key("044"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend044>().decode(buf);
+                else ConfirmExtend044().decode(buf, codec::FieldMask<ConfirmExtend044::Field>());
+                break;
+            case codec::pack_key("045"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend045>().decode(buf);
+                else ConfirmExtend045().decode(buf, codec::FieldMask<ConfirmExtend045::Field>());
+                break;
+            case codec::pack_key("050"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ConfirmExtend050>().decode(buf);
+                else ConfirmExtend050().decode(buf, codec::FieldMask<ConfirmExtend050::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 189
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExecutionConfirm*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExecutionConfirm)) return false;
+        const auto* checkType = static_cast<const ExecutionConfirm*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -1391,6 +2564,79 @@ inline std::ostream& operator<<(std::ostream& os, const ExecutionConfirm& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ExecutionConfirm: each accessor decodes one field in place from the
+// wire bytes. Covers the first 189 bytes, the part of the layout with fixed offsets.
+class ExecutionConfirmView {
+public:
+    static constexpr size_t kFixedSize = 189;
+
+    explicit ExecutionConfirmView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view orderId() const { return codec::fixed_string_view(data_ + 83, 16); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 99, 10); }
+    std::string_view origClOrdId() const { return codec::fixed_string_view(data_ + 109, 10); }
+    std::string_view execId() const { return codec::fixed_string_view(data_ + 119, 16); }
+    std::string_view execType() const { return codec::fixed_string_view(data_ + 135, 1); }
+    std::string_view ordStatus() const { return codec::fixed_string_view(data_ + 136, 1); }
+    uint16_t ordRejReason() const { return LittleEndian::load<uint16_t>(data_ + 137); }
+    int64_t leavesQty() const { return LittleEndian::load<int64_t>(data_ + 139); }
+    int64_t cumQty() const { return LittleEndian::load<int64_t>(data_ + 147); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 155, 1); }
+    std::string_view ordType() const { return codec::fixed_string_view(data_ + 156, 1); }
+    int64_t orderQty() const { return LittleEndian::load<int64_t>(data_ + 157); }
+    int64_t price() const { return LittleEndian::load<int64_t>(data_ + 165); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 173, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 183, 2); }
+    std::string_view orderRestrictions() const { return codec::fixed_string_view(data_ + 185, 4); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a ExecutionConfirm.
+struct ExecutionConfirmWire {
+    static void setPartitionNo(codec::FramePatcher& frame, int32_t partitionNo) { frame.put<LittleEndian>(frame.spec().headerSize + 0, partitionNo); }
+    static void setReportIndex(codec::FramePatcher& frame, int64_t reportIndex) { frame.put<LittleEndian>(frame.spec().headerSize + 4, reportIndex); }
+    static void setReportingPbuid(codec::FramePatcher& frame, std::string_view reportingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 15, reportingPbuid, 6); }
+    static void setSubmittingPbuid(codec::FramePatcher& frame, std::string_view submittingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 21, submittingPbuid, 6); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 27, securityId, 8); }
+    static void setSecurityIdsource(codec::FramePatcher& frame, std::string_view securityIdsource) { frame.put_fixed_string(frame.spec().headerSize + 35, securityIdsource, 4); }
+    static void setOwnerType(codec::FramePatcher& frame, uint16_t ownerType) { frame.put<LittleEndian>(frame.spec().headerSize + 39, ownerType); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 41, clearingFirm, 2); }
+    static void setTransactTime(codec::FramePatcher& frame, int64_t transactTime) { frame.put<LittleEndian>(frame.spec().headerSize + 43, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 51, userInfo, 32); }
+    static void setOrderId(codec::FramePatcher& frame, std::string_view orderId) { frame.put_fixed_string(frame.spec().headerSize + 83, orderId, 16); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 99, clOrdId, 10); }
+    static void setOrigClOrdId(codec::FramePatcher& frame, std::string_view origClOrdId) { frame.put_fixed_string(frame.spec().headerSize + 109, origClOrdId, 10); }
+    static void setExecId(codec::FramePatcher& frame, std::string_view execId) { frame.put_fixed_string(frame.spec().headerSize + 119, execId, 16); }
+    static void setExecType(codec::FramePatcher& frame, std::string_view execType) { frame.put_fixed_string(frame.spec().headerSize + 135, execType, 1); }
+    static void setOrdStatus(codec::FramePatcher& frame, std::string_view ordStatus) { frame.put_fixed_string(frame.spec().headerSize + 136, ordStatus, 1); }
+    static void setOrdRejReason(codec::FramePatcher& frame, uint16_t ordRejReason) { frame.put<LittleEndian>(frame.spec().headerSize + 137, ordRejReason); }
+    static void setLeavesQty(codec::FramePatcher& frame, int64_t leavesQty) { frame.put<LittleEndian>(frame.spec().headerSize + 139, leavesQty); }
+    static void setCumQty(codec::FramePatcher& frame, int64_t cumQty) { frame.put<LittleEndian>(frame.spec().headerSize + 147, cumQty); }
+    static void setSide(codec::FramePatcher& frame, std::string_view side) { frame.put_fixed_string(frame.spec().headerSize + 155, side, 1); }
+    static void setOrdType(codec::FramePatcher& frame, std::string_view ordType) { frame.put_fixed_string(frame.spec().headerSize + 156, ordType, 1); }
+    static void setOrderQty(codec::FramePatcher& frame, int64_t orderQty) { frame.put<LittleEndian>(frame.spec().headerSize + 157, orderQty); }
+    static void setPrice(codec::FramePatcher& frame, int64_t price) { frame.put<LittleEndian>(frame.spec().headerSize + 165, price); }
+    static void setAccountId(codec::FramePatcher& frame, std::string_view accountId) { frame.put_fixed_string(frame.spec().headerSize + 173, accountId, 10); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 183, branchId, 2); }
+    static void setOrderRestrictions(codec::FramePatcher& frame, std::string_view orderRestrictions) { frame.put_fixed_string(frame.spec().headerSize + 185, orderRestrictions, 4); }
+};
+
+
 
 
 
@@ -1399,29 +2645,54 @@ inline std::ostream& operator<<(std::ostream& os, const ExecutionConfirm& pkt) {
 
 
 
+struct ReportExtend010 final : public codec::BinaryCodec {
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<1> settlType;
+    codec::FixedString<1> settlPeriod;
 
-struct ReportExtend010 : public codec::BinaryCodec {
-    std::string cashMargin;
-    std::string settlType;
-    std::string settlPeriod;
+    enum class Field : uint8_t {
+        cashMargin,
+        settlType,
+        settlPeriod,
+    };
+
+    static constexpr size_t kWireSize = 3;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, settlType, 1);
-        codec::write_fixed_string(buf, settlPeriod, 1);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, settlType, 1);
+        codec::write_fixed_string(out, settlPeriod, 1);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        cashMargin = codec::read_fixed_string<1>(buf);
+        settlType = codec::read_fixed_string<1>(buf);
+        settlPeriod = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::settlType)) settlType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::settlPeriod)) settlPeriod = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        cashMargin = codec::read_fixed_string(buf, 1);
-        settlType = codec::read_fixed_string(buf, 1);
-        settlPeriod = codec::read_fixed_string(buf, 1);
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ReportExtend010*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ReportExtend010)) return false;
+        const auto* checkType = static_cast<const ReportExtend010*>(&other);
         return cashMargin == checkType->cashMargin
                && settlType == checkType->settlType
                && settlPeriod == checkType->settlPeriod;
@@ -1445,23 +2716,60 @@ inline std::ostream& operator<<(std::ostream& os, const ReportExtend010& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ReportExtend010: each accessor decodes one field in place from the
+// wire bytes. Covers the first 3 bytes, the part of the layout with fixed offsets.
+class ReportExtend010View {
+public:
+    static constexpr size_t kFixedSize = 3;
 
-struct ReportExtend040 : public codec::BinaryCodec {
-    std::string cashMargin;
-
-    void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, cashMargin, 1);
+    explicit ReportExtend010View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
     }
-    
 
-    void decode(ByteBuf& buf) override {
-        cashMargin = codec::read_fixed_string(buf, 1);
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 0, 1); }
+    std::string_view settlType() const { return codec::fixed_string_view(data_ + 1, 1); }
+    std::string_view settlPeriod() const { return codec::fixed_string_view(data_ + 2, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct ReportExtend040 final : public codec::BinaryCodec {
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 1;
+
+    void encode(ByteBuf& buf) const override {
+        codec::write_fixed_string(buf, cashMargin, 1);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ReportExtend040*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ReportExtend040)) return false;
+        const auto* checkType = static_cast<const ReportExtend040*>(&other);
         return cashMargin == checkType->cashMargin;
     }
     
@@ -1479,32 +2787,77 @@ inline std::ostream& operator<<(std::ostream& os, const ReportExtend040& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ReportExtend040: each accessor decodes one field in place from the
+// wire bytes. Covers the first 1 bytes, the part of the layout with fixed offsets.
+class ReportExtend040View {
+public:
+    static constexpr size_t kFixedSize = 1;
+
+    explicit ReportExtend040View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 0, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct ReportExtend050 : public codec::BinaryCodec {
+struct ReportExtend050 final : public codec::BinaryCodec {
     uint16_t expirationDays;
     uint8_t expirationType;
     uint32_t maturityDate;
-    std::string shareProperty;
+    codec::FixedString<2> shareProperty;
+
+    enum class Field : uint8_t {
+        expirationDays,
+        expirationType,
+        maturityDate,
+        shareProperty,
+    };
+
+    static constexpr size_t kWireSize = 9;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(expirationDays);
-        buf.write_u8(expirationType);
-        buf.write_u32_le(maturityDate);
-        codec::write_fixed_string(buf, shareProperty, 2);
+        auto out = buf.claim(kWireSize);
+        out.write_u16_le(expirationDays);
+        out.write_u8(expirationType);
+        out.write_u32_le(maturityDate);
+        codec::write_fixed_string(out, shareProperty, 2);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         expirationDays = buf.read_u16_le();
         expirationType = buf.read_u8();
         maturityDate = buf.read_u32_le();
-        shareProperty = codec::read_fixed_string(buf, 2);
+        shareProperty = codec::read_fixed_string<2>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::expirationDays)) expirationDays = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::expirationType)) expirationType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::maturityDate)) maturityDate = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::shareProperty)) shareProperty = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ReportExtend050*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ReportExtend050)) return false;
+        const auto* checkType = static_cast<const ReportExtend050*>(&other);
         return expirationDays == checkType->expirationDays
                && expirationType == checkType->expirationType
                && maturityDate == checkType->maturityDate
@@ -1531,100 +2884,265 @@ inline std::ostream& operator<<(std::ostream& os, const ReportExtend050& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ReportExtend050: each accessor decodes one field in place from the
+// wire bytes. Covers the first 9 bytes, the part of the layout with fixed offsets.
+class ReportExtend050View {
+public:
+    static constexpr size_t kFixedSize = 9;
+
+    explicit ReportExtend050View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t expirationDays() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint8_t expirationType() const { return DefaultByteOrder::load<uint8_t>(data_ + 2); }
+    uint32_t maturityDate() const { return LittleEndian::load<uint32_t>(data_ + 3); }
+    std::string_view shareProperty() const { return codec::fixed_string_view(data_ + 7, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct ExecutionReportTag{};
 using ExecutionReportMessageFactory = MessageFactory<std::string, codec::BinaryCodec, ExecutionReportTag>;
-REGISTER_MESSAGE(ExecutionReportMessageFactory, "010", ReportExtend010);
-REGISTER_MESSAGE(ExecutionReportMessageFactory, "040", ReportExtend040);
-REGISTER_MESSAGE(ExecutionReportMessageFactory, "050", ReportExtend050);
+template <>
+struct GeneratedMessages<ExecutionReportTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("010"):
+                return std::make_unique<ReportExtend010>();
+            case codec::pack_key("040"):
+                return std::make_unique<ReportExtend040>();
+            case codec::pack_key("050"):
+                return std::make_unique<ReportExtend050>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using ExecutionReportApplExtend = codec::InlineMessage<ReportExtend010, ReportExtend040, ReportExtend050>;
 
 
-struct ExecutionReport : public codec::BinaryCodec {
+struct ExecutionReport final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string orderId;
-    std::string clOrdId;
-    std::string execId;
-    std::string execType;
-    std::string ordStatus;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<16> orderId;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<16> execId;
+    codec::FixedString<1> execType;
+    codec::FixedString<1> ordStatus;
     int64_t lastPx;
     int64_t lastQty;
     int64_t leavesQty;
     int64_t cumQty;
-    std::string side;
-    std::string accountId;
-    std::string branchId;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    codec::FixedString<1> side;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    ExecutionReportApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        orderId,
+        clOrdId,
+        execId,
+        execType,
+        ordStatus,
+        lastPx,
+        lastQty,
+        leavesQty,
+        cumQty,
+        side,
+        accountId,
+        branchId,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, orderId, 16);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, execId, 16);
-        codec::write_fixed_string(buf, execType, 1);
-        codec::write_fixed_string(buf, ordStatus, 1);
-        buf.write_i64_le(lastPx);
-        buf.write_i64_le(lastQty);
-        buf.write_i64_le(leavesQty);
-        buf.write_i64_le(cumQty);
-        codec::write_fixed_string(buf, side, 1);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
+        auto out = buf.claim(172);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, orderId, 16);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, execId, 16);
+        codec::write_fixed_string(out, execType, 1);
+        codec::write_fixed_string(out, ordStatus, 1);
+        out.write_i64_le(lastPx);
+        out.write_i64_le(lastQty);
+        out.write_i64_le(leavesQty);
+        out.write_i64_le(cumQty);
+        codec::write_fixed_string(out, side, 1);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        orderId = codec::read_fixed_string(buf, 16);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        execId = codec::read_fixed_string(buf, 16);
-        execType = codec::read_fixed_string(buf, 1);
-        ordStatus = codec::read_fixed_string(buf, 1);
+        userInfo = codec::read_fixed_string<32>(buf);
+        orderId = codec::read_fixed_string<16>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        execId = codec::read_fixed_string<16>(buf);
+        execType = codec::read_fixed_string<1>(buf);
+        ordStatus = codec::read_fixed_string<1>(buf);
         lastPx = buf.read_i64_le();
         lastQty = buf.read_i64_le();
         leavesQty = buf.read_i64_le();
         cumQty = buf.read_i64_le();
-        side = codec::read_fixed_string(buf, 1);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        applExtend = ExecutionReportMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        side = codec::read_fixed_string<1>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("010"):
+                applExtend.emplace<ReportExtend010>().decode(buf);
+                break;
+            case codec::pack_key("040"):
+                applExtend.emplace<ReportExtend040>().decode(buf);
+                break;
+            case codec::pack_key("050"):
+                applExtend.emplace<ReportExtend050>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::orderId)) orderId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::execId)) execId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::execType)) execType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::ordStatus)) ordStatus = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::lastPx)) lastPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::lastQty)) lastQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::leavesQty)) leavesQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::cumQty)) cumQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("010"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ReportExtend010>().decode(buf);
+                else ReportExtend010().decode(buf, codec::FieldMask<ReportExtend010::Field>());
+                break;
+            case codec::pack_key("040"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ReportExtend040>().decode(buf);
+                else ReportExtend040().decode(buf, codec::FieldMask<ReportExtend040::Field>());
+                break;
+            case codec::pack_key("050"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<ReportExtend050>().decode(buf);
+                else ReportExtend050().decode(buf, codec::FieldMask<ReportExtend050::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 172
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExecutionReport*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExecutionReport)) return false;
+        const auto* checkType = static_cast<const ExecutionReport*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -1711,50 +3229,158 @@ inline std::ostream& operator<<(std::ostream& os, const ExecutionReport& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ExecutionReport: each accessor decodes one field in place from the
+// wire bytes. Covers the first 172 bytes, the part of the layout with fixed offsets.
+class ExecutionReportView {
+public:
+    static constexpr size_t kFixedSize = 172;
+
+    explicit ExecutionReportView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view orderId() const { return codec::fixed_string_view(data_ + 83, 16); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 99, 10); }
+    std::string_view execId() const { return codec::fixed_string_view(data_ + 109, 16); }
+    std::string_view execType() const { return codec::fixed_string_view(data_ + 125, 1); }
+    std::string_view ordStatus() const { return codec::fixed_string_view(data_ + 126, 1); }
+    int64_t lastPx() const { return LittleEndian::load<int64_t>(data_ + 127); }
+    int64_t lastQty() const { return LittleEndian::load<int64_t>(data_ + 135); }
+    int64_t leavesQty() const { return LittleEndian::load<int64_t>(data_ + 143); }
+    int64_t cumQty() const { return LittleEndian::load<int64_t>(data_ + 151); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 159, 1); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 160, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 170, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a ExecutionReport.
+struct ExecutionReportWire {
+    static void setPartitionNo(codec::FramePatcher& frame, int32_t partitionNo) { frame.put<LittleEndian>(frame.spec().headerSize + 0, partitionNo); }
+    static void setReportIndex(codec::FramePatcher& frame, int64_t reportIndex) { frame.put<LittleEndian>(frame.spec().headerSize + 4, reportIndex); }
+    static void setReportingPbuid(codec::FramePatcher& frame, std::string_view reportingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 15, reportingPbuid, 6); }
+    static void setSubmittingPbuid(codec::FramePatcher& frame, std::string_view submittingPbuid) { frame.put_fixed_string(frame.spec().headerSize + 21, submittingPbuid, 6); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 27, securityId, 8); }
+    static void setSecurityIdsource(codec::FramePatcher& frame, std::string_view securityIdsource) { frame.put_fixed_string(frame.spec().headerSize + 35, securityIdsource, 4); }
+    static void setOwnerType(codec::FramePatcher& frame, uint16_t ownerType) { frame.put<LittleEndian>(frame.spec().headerSize + 39, ownerType); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 41, clearingFirm, 2); }
+    static void setTransactTime(codec::FramePatcher& frame, int64_t transactTime) { frame.put<LittleEndian>(frame.spec().headerSize + 43, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 51, userInfo, 32); }
+    static void setOrderId(codec::FramePatcher& frame, std::string_view orderId) { frame.put_fixed_string(frame.spec().headerSize + 83, orderId, 16); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 99, clOrdId, 10); }
+    static void setExecId(codec::FramePatcher& frame, std::string_view execId) { frame.put_fixed_string(frame.spec().headerSize + 109, execId, 16); }
+    static void setExecType(codec::FramePatcher& frame, std::string_view execType) { frame.put_fixed_string(frame.spec().headerSize + 125, execType, 1); }
+    static void setOrdStatus(codec::FramePatcher& frame, std::string_view ordStatus) { frame.put_fixed_string(frame.spec().headerSize + 126, ordStatus, 1); }
+    static void setLastPx(codec::FramePatcher& frame, int64_t lastPx) { frame.put<LittleEndian>(frame.spec().headerSize + 127, lastPx); }
+    static void setLastQty(codec::FramePatcher& frame, int64_t lastQty) { frame.put<LittleEndian>(frame.spec().headerSize + 135, lastQty); }
+    static void setLeavesQty(codec::FramePatcher& frame, int64_t leavesQty) { frame.put<LittleEndian>(frame.spec().headerSize + 143, leavesQty); }
+    static void setCumQty(codec::FramePatcher& frame, int64_t cumQty) { frame.put<LittleEndian>(frame.spec().headerSize + 151, cumQty); }
+    static void setSide(codec::FramePatcher& frame, std::string_view side) { frame.put_fixed_string(frame.spec().headerSize + 159, side, 1); }
+    static void setAccountId(codec::FramePatcher& frame, std::string_view accountId) { frame.put_fixed_string(frame.spec().headerSize + 160, accountId, 10); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 170, branchId, 2); }
+};
+
 
 
 
 
-struct QuoteExtend070 : public codec::BinaryCodec {
-    std::string branchId;
-    std::string quoteId;
-    std::string quoteRespId;
+struct QuoteExtend070 final : public codec::BinaryCodec {
+    codec::FixedString<2> branchId;
+    codec::FixedString<10> quoteId;
+    codec::FixedString<10> quoteRespId;
     uint8_t privateQuote;
     int64_t validUntilTime;
     uint8_t priceType;
-    std::string cashMargin;
-    std::string counterPartyPbuid;
-    std::string memo;
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<6> counterPartyPbuid;
+    codec::FixedString<120> memo;
+
+    enum class Field : uint8_t {
+        branchId,
+        quoteId,
+        quoteRespId,
+        privateQuote,
+        validUntilTime,
+        priceType,
+        cashMargin,
+        counterPartyPbuid,
+        memo,
+    };
+
+    static constexpr size_t kWireSize = 159;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, quoteId, 10);
-        codec::write_fixed_string(buf, quoteRespId, 10);
-        buf.write_u8(privateQuote);
-        buf.write_i64_le(validUntilTime);
-        buf.write_u8(priceType);
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, counterPartyPbuid, 6);
-        codec::write_fixed_string(buf, memo, 120);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
-        branchId = codec::read_fixed_string(buf, 2);
-        quoteId = codec::read_fixed_string(buf, 10);
-        quoteRespId = codec::read_fixed_string(buf, 10);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, quoteId, 10);
+        codec::write_fixed_string(out, quoteRespId, 10);
+        out.write_u8(privateQuote);
+        out.write_i64_le(validUntilTime);
+        out.write_u8(priceType);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, counterPartyPbuid, 6);
+        codec::write_fixed_string(out, memo, 120);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        branchId = codec::read_fixed_string<2>(buf);
+        quoteId = codec::read_fixed_string<10>(buf);
+        quoteRespId = codec::read_fixed_string<10>(buf);
         privateQuote = buf.read_u8();
         validUntilTime = buf.read_i64_le();
         priceType = buf.read_u8();
-        cashMargin = codec::read_fixed_string(buf, 1);
-        counterPartyPbuid = codec::read_fixed_string(buf, 6);
-        memo = codec::read_fixed_string(buf, 120);
+        cashMargin = codec::read_fixed_string<1>(buf);
+        counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        memo = codec::read_fixed_string<120>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::quoteId)) quoteId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteRespId)) quoteRespId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::privateQuote)) privateQuote = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::validUntilTime)) validUntilTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::priceType)) priceType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::counterPartyPbuid)) counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::memo)) memo = codec::read_fixed_string<120>(buf);
+        else buf.skip_bytes(120);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const QuoteExtend070*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(QuoteExtend070)) return false;
+        const auto* checkType = static_cast<const QuoteExtend070*>(&other);
         return branchId == checkType->branchId
                && quoteId == checkType->quoteId
                && quoteRespId == checkType->quoteRespId
@@ -1796,21 +3422,55 @@ inline std::ostream& operator<<(std::ostream& os, const QuoteExtend070& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded QuoteExtend070: each accessor decodes one field in place from the
+// wire bytes. Covers the first 159 bytes, the part of the layout with fixed offsets.
+class QuoteExtend070View {
+public:
+    static constexpr size_t kFixedSize = 159;
+
+    explicit QuoteExtend070View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 0, 2); }
+    std::string_view quoteId() const { return codec::fixed_string_view(data_ + 2, 10); }
+    std::string_view quoteRespId() const { return codec::fixed_string_view(data_ + 12, 10); }
+    uint8_t privateQuote() const { return DefaultByteOrder::load<uint8_t>(data_ + 22); }
+    int64_t validUntilTime() const { return LittleEndian::load<int64_t>(data_ + 23); }
+    uint8_t priceType() const { return DefaultByteOrder::load<uint8_t>(data_ + 31); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 32, 1); }
+    std::string_view counterPartyPbuid() const { return codec::fixed_string_view(data_ + 33, 6); }
+    std::string_view memo() const { return codec::fixed_string_view(data_ + 39, 120); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct QuoteExtend071 final : public codec::BinaryCodec {
 
-struct QuoteExtend071 : public codec::BinaryCodec {
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const QuoteExtend071*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(QuoteExtend071);
     }
     
     std::string toString() const override {
@@ -1829,75 +3489,192 @@ inline std::ostream& operator<<(std::ostream& os, const QuoteExtend071& pkt) {
 
 struct QuoteTag{};
 using QuoteMessageFactory = MessageFactory<std::string, codec::BinaryCodec, QuoteTag>;
-REGISTER_MESSAGE(QuoteMessageFactory, "070", QuoteExtend070);
-REGISTER_MESSAGE(QuoteMessageFactory, "071", QuoteExtend071);
+template <>
+struct GeneratedMessages<QuoteTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("070"):
+                return std::make_unique<QuoteExtend070>();
+            case codec::pack_key("071"):
+                return std::make_unique<QuoteExtend071>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using QuoteApplExtend = codec::InlineMessage<QuoteExtend070, QuoteExtend071>;
 
 
-struct Quote : public codec::BinaryCodec {
-    std::string applId;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+struct Quote final : public codec::BinaryCodec {
+    codec::FixedString<3> applId;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string quoteMsgId;
-    std::string accountId;
-    std::string quoteReqId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<10> quoteMsgId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<10> quoteReqId;
     uint8_t quoteType;
     int64_t bidPx;
     int64_t offerPx;
     int64_t bidSize;
     int64_t offerSize;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    QuoteApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        applId,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        quoteMsgId,
+        accountId,
+        quoteReqId,
+        quoteType,
+        bidPx,
+        offerPx,
+        bidSize,
+        offerSize,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, quoteMsgId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, quoteReqId, 10);
-        buf.write_u8(quoteType);
-        buf.write_i64_le(bidPx);
-        buf.write_i64_le(offerPx);
-        buf.write_i64_le(bidSize);
-        buf.write_i64_le(offerSize);
+        auto out = buf.claim(128);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, quoteMsgId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, quoteReqId, 10);
+        out.write_u8(quoteType);
+        out.write_i64_le(bidPx);
+        out.write_i64_le(offerPx);
+        out.write_i64_le(bidSize);
+        out.write_i64_le(offerSize);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        applId = codec::read_fixed_string(buf, 3);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
+        applId = codec::read_fixed_string<3>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        quoteMsgId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        quoteReqId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        quoteMsgId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        quoteReqId = codec::read_fixed_string<10>(buf);
         quoteType = buf.read_u8();
         bidPx = buf.read_i64_le();
         offerPx = buf.read_i64_le();
         bidSize = buf.read_i64_le();
         offerSize = buf.read_i64_le();
-        applExtend = QuoteMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                applExtend.emplace<QuoteExtend070>().decode(buf);
+                break;
+            case codec::pack_key("071"):
+                applExtend.emplace<QuoteExtend071>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::quoteMsgId)) quoteMsgId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteReqId)) quoteReqId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteType)) quoteType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::bidPx)) bidPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::offerPx)) offerPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::bidSize)) bidSize = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::offerSize)) offerSize = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<QuoteExtend070>().decode(buf);
+                else QuoteExtend070().decode(buf, codec::FieldMask<QuoteExtend070::Field>());
+                break;
+            case codec::pack_key("071"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<QuoteExtend071>().decode(buf);
+                else QuoteExtend071().decode(buf, codec::FieldMask<QuoteExtend071::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 128
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Quote*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Quote)) return false;
+        const auto* checkType = static_cast<const Quote*>(&other);
         return applId == checkType->applId
                && submittingPbuid == checkType->submittingPbuid
                && securityId == checkType->securityId
@@ -1963,31 +3740,88 @@ inline std::ostream& operator<<(std::ostream& os, const Quote& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Quote: each accessor decodes one field in place from the
+// wire bytes. Covers the first 128 bytes, the part of the layout with fixed offsets.
+class QuoteView {
+public:
+    static constexpr size_t kFixedSize = 128;
+
+    explicit QuoteView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 0, 3); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 3, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 9, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 17, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 21); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 23, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 25); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 33, 32); }
+    std::string_view quoteMsgId() const { return codec::fixed_string_view(data_ + 65, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 75, 10); }
+    std::string_view quoteReqId() const { return codec::fixed_string_view(data_ + 85, 10); }
+    uint8_t quoteType() const { return DefaultByteOrder::load<uint8_t>(data_ + 95); }
+    int64_t bidPx() const { return LittleEndian::load<int64_t>(data_ + 96); }
+    int64_t offerPx() const { return LittleEndian::load<int64_t>(data_ + 104); }
+    int64_t bidSize() const { return LittleEndian::load<int64_t>(data_ + 112); }
+    int64_t offerSize() const { return LittleEndian::load<int64_t>(data_ + 120); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 
 
-struct Quote1 : public codec::BinaryCodec {
-    std::string quoteId;
+struct Quote1 final : public codec::BinaryCodec {
+    codec::FixedString<10> quoteId;
     int64_t quotePrice;
     int64_t quoteQty;
 
+    enum class Field : uint8_t {
+        quoteId,
+        quotePrice,
+        quoteQty,
+    };
+
+    static constexpr size_t kWireSize = 26;
+
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, quoteId, 10);
-        buf.write_i64_le(quotePrice);
-        buf.write_i64_le(quoteQty);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, quoteId, 10);
+        out.write_i64_le(quotePrice);
+        out.write_i64_le(quoteQty);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        quoteId = codec::read_fixed_string(buf, 10);
+    void decode(ByteBufView& buf) override {
+        quoteId = codec::read_fixed_string<10>(buf);
         quotePrice = buf.read_i64_le();
         quoteQty = buf.read_i64_le();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::quoteId)) quoteId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quotePrice)) quotePrice = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::quoteQty)) quoteQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Quote1*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Quote1)) return false;
+        const auto* checkType = static_cast<const Quote1*>(&other);
         return quoteId == checkType->quoteId
                && quotePrice == checkType->quotePrice
                && quoteQty == checkType->quoteQty;
@@ -2011,56 +3845,126 @@ inline std::ostream& operator<<(std::ostream& os, const Quote1& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Quote1: each accessor decodes one field in place from the
+// wire bytes. Covers the first 26 bytes, the part of the layout with fixed offsets.
+class Quote1View {
+public:
+    static constexpr size_t kFixedSize = 26;
+
+    explicit Quote1View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view quoteId() const { return codec::fixed_string_view(data_ + 0, 10); }
+    int64_t quotePrice() const { return LittleEndian::load<int64_t>(data_ + 10); }
+    int64_t quoteQty() const { return LittleEndian::load<int64_t>(data_ + 18); }
 
-struct QuoteStatusReportExtend070 : public codec::BinaryCodec {
-    std::string branchId;
-    std::string orderId;
-    std::string execId;
-    std::string quoteRespId;
+private:
+    const uint8_t* data_;
+};
+
+
+struct QuoteStatusReportExtend070 final : public codec::BinaryCodec {
+    codec::FixedString<2> branchId;
+    codec::FixedString<16> orderId;
+    codec::FixedString<16> execId;
+    codec::FixedString<10> quoteRespId;
     uint8_t privateQuote;
-    std::string side;
+    codec::FixedString<1> side;
     uint8_t priceType;
     int64_t validUntilTime;
-    std::string cashMargin;
-    std::string counterPartyPbuid;
-    std::string memo;
-    std::vector<Quote1> quote1;
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<6> counterPartyPbuid;
+    codec::FixedString<120> memo;
+    codec::List<Quote1> quote1;
+
+    enum class Field : uint8_t {
+        branchId,
+        orderId,
+        execId,
+        quoteRespId,
+        privateQuote,
+        side,
+        priceType,
+        validUntilTime,
+        cashMargin,
+        counterPartyPbuid,
+        memo,
+        quote1,
+    };
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, orderId, 16);
-        codec::write_fixed_string(buf, execId, 16);
-        codec::write_fixed_string(buf, quoteRespId, 10);
-        buf.write_u8(privateQuote);
-        codec::write_fixed_string(buf, side, 1);
-        buf.write_u8(priceType);
-        buf.write_i64_le(validUntilTime);
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, counterPartyPbuid, 6);
-        codec::write_fixed_string(buf, memo, 120);
+        auto out = buf.claim(182);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, orderId, 16);
+        codec::write_fixed_string(out, execId, 16);
+        codec::write_fixed_string(out, quoteRespId, 10);
+        out.write_u8(privateQuote);
+        codec::write_fixed_string(out, side, 1);
+        out.write_u8(priceType);
+        out.write_i64_le(validUntilTime);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, counterPartyPbuid, 6);
+        codec::write_fixed_string(out, memo, 120);
         codec::write_object_List_le<uint16_t>(buf,quote1);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        branchId = codec::read_fixed_string(buf, 2);
-        orderId = codec::read_fixed_string(buf, 16);
-        execId = codec::read_fixed_string(buf, 16);
-        quoteRespId = codec::read_fixed_string(buf, 10);
+    void decode(ByteBufView& buf) override {
+        branchId = codec::read_fixed_string<2>(buf);
+        orderId = codec::read_fixed_string<16>(buf);
+        execId = codec::read_fixed_string<16>(buf);
+        quoteRespId = codec::read_fixed_string<10>(buf);
         privateQuote = buf.read_u8();
-        side = codec::read_fixed_string(buf, 1);
+        side = codec::read_fixed_string<1>(buf);
         priceType = buf.read_u8();
         validUntilTime = buf.read_i64_le();
-        cashMargin = codec::read_fixed_string(buf, 1);
-        counterPartyPbuid = codec::read_fixed_string(buf, 6);
-        memo = codec::read_fixed_string(buf, 120);
-        quote1 = codec::read_object_List_le<uint16_t,Quote1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+        counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        memo = codec::read_fixed_string<120>(buf);
+        quote1 = codec::read_object_List_le<uint16_t,Quote1,codec::List<Quote1>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::orderId)) orderId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::execId)) execId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::quoteRespId)) quoteRespId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::privateQuote)) privateQuote = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::priceType)) priceType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::validUntilTime)) validUntilTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::counterPartyPbuid)) counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::memo)) memo = codec::read_fixed_string<120>(buf);
+        else buf.skip_bytes(120);
+        if(mask.has(Field::quote1)) quote1 = codec::read_object_List_le<uint16_t,Quote1,codec::List<Quote1>>(buf);
+        else codec::skip_object_List_le<uint16_t,Quote1>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 182
+               + codec::object_list_size<uint16_t>(quote1);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const QuoteStatusReportExtend070*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(QuoteStatusReportExtend070)) return false;
+        const auto* checkType = static_cast<const QuoteStatusReportExtend070*>(&other);
         return branchId == checkType->branchId
                && orderId == checkType->orderId
                && execId == checkType->execId
@@ -2111,89 +4015,236 @@ inline std::ostream& operator<<(std::ostream& os, const QuoteStatusReportExtend0
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded QuoteStatusReportExtend070: each accessor decodes one field in place from the
+// wire bytes. Covers the first 182 bytes, the part of the layout with fixed offsets.
+class QuoteStatusReportExtend070View {
+public:
+    static constexpr size_t kFixedSize = 182;
+
+    explicit QuoteStatusReportExtend070View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 0, 2); }
+    std::string_view orderId() const { return codec::fixed_string_view(data_ + 2, 16); }
+    std::string_view execId() const { return codec::fixed_string_view(data_ + 18, 16); }
+    std::string_view quoteRespId() const { return codec::fixed_string_view(data_ + 34, 10); }
+    uint8_t privateQuote() const { return DefaultByteOrder::load<uint8_t>(data_ + 44); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 45, 1); }
+    uint8_t priceType() const { return DefaultByteOrder::load<uint8_t>(data_ + 46); }
+    int64_t validUntilTime() const { return LittleEndian::load<int64_t>(data_ + 47); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 55, 1); }
+    std::string_view counterPartyPbuid() const { return codec::fixed_string_view(data_ + 56, 6); }
+    std::string_view memo() const { return codec::fixed_string_view(data_ + 62, 120); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct QuoteStatusReportTag{};
 using QuoteStatusReportMessageFactory = MessageFactory<std::string, codec::BinaryCodec, QuoteStatusReportTag>;
-REGISTER_MESSAGE(QuoteStatusReportMessageFactory, "070", QuoteStatusReportExtend070);
+template <>
+struct GeneratedMessages<QuoteStatusReportTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("070"):
+                return std::make_unique<QuoteStatusReportExtend070>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using QuoteStatusReportApplExtend = codec::InlineMessage<QuoteStatusReportExtend070>;
 
 
-struct QuoteStatusReport : public codec::BinaryCodec {
+struct QuoteStatusReport final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string quoteMsgId;
-    std::string accountId;
-    std::string quoteReqId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<10> quoteMsgId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<10> quoteReqId;
     uint64_t quoteRjectReason;
     uint8_t quoteType;
     int64_t bidPx;
     int64_t offerPx;
     int64_t bidSize;
     int64_t offerSize;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    QuoteStatusReportApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        quoteMsgId,
+        accountId,
+        quoteReqId,
+        quoteRjectReason,
+        quoteType,
+        bidPx,
+        offerPx,
+        bidSize,
+        offerSize,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, quoteMsgId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, quoteReqId, 10);
-        buf.write_u64_le(quoteRjectReason);
-        buf.write_u8(quoteType);
-        buf.write_i64_le(bidPx);
-        buf.write_i64_le(offerPx);
-        buf.write_i64_le(bidSize);
-        buf.write_i64_le(offerSize);
+        auto out = buf.claim(154);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, quoteMsgId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, quoteReqId, 10);
+        out.write_u64_le(quoteRjectReason);
+        out.write_u8(quoteType);
+        out.write_i64_le(bidPx);
+        out.write_i64_le(offerPx);
+        out.write_i64_le(bidSize);
+        out.write_i64_le(offerSize);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        quoteMsgId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        quoteReqId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        quoteMsgId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        quoteReqId = codec::read_fixed_string<10>(buf);
         quoteRjectReason = buf.read_u64_le();
         quoteType = buf.read_u8();
         bidPx = buf.read_i64_le();
         offerPx = buf.read_i64_le();
         bidSize = buf.read_i64_le();
         offerSize = buf.read_i64_le();
-        applExtend = QuoteStatusReportMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                applExtend.emplace<QuoteStatusReportExtend070>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::quoteMsgId)) quoteMsgId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteReqId)) quoteReqId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteRjectReason)) quoteRjectReason = buf.read_u64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::quoteType)) quoteType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::bidPx)) bidPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::offerPx)) offerPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::bidSize)) bidSize = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::offerSize)) offerSize = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<QuoteStatusReportExtend070>().decode(buf);
+                else QuoteStatusReportExtend070().decode(buf, codec::FieldMask<QuoteStatusReportExtend070::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 154
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const QuoteStatusReport*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(QuoteStatusReport)) return false;
+        const auto* checkType = static_cast<const QuoteStatusReport*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -2271,30 +4322,91 @@ inline std::ostream& operator<<(std::ostream& os, const QuoteStatusReport& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded QuoteStatusReport: each accessor decodes one field in place from the
+// wire bytes. Covers the first 154 bytes, the part of the layout with fixed offsets.
+class QuoteStatusReportView {
+public:
+    static constexpr size_t kFixedSize = 154;
+
+    explicit QuoteStatusReportView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view quoteMsgId() const { return codec::fixed_string_view(data_ + 83, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 93, 10); }
+    std::string_view quoteReqId() const { return codec::fixed_string_view(data_ + 103, 10); }
+    uint64_t quoteRjectReason() const { return LittleEndian::load<uint64_t>(data_ + 113); }
+    uint8_t quoteType() const { return DefaultByteOrder::load<uint8_t>(data_ + 121); }
+    int64_t bidPx() const { return LittleEndian::load<int64_t>(data_ + 122); }
+    int64_t offerPx() const { return LittleEndian::load<int64_t>(data_ + 130); }
+    int64_t bidSize() const { return LittleEndian::load<int64_t>(data_ + 138); }
+    int64_t offerSize() const { return LittleEndian::load<int64_t>(data_ + 146); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 
-struct Quote2 : public codec::BinaryCodec {
-    std::string quoteId;
+struct Quote2 final : public codec::BinaryCodec {
+    codec::FixedString<10> quoteId;
     int64_t quotePrice;
     int64_t quoteQty;
 
+    enum class Field : uint8_t {
+        quoteId,
+        quotePrice,
+        quoteQty,
+    };
+
+    static constexpr size_t kWireSize = 26;
+
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, quoteId, 10);
-        buf.write_i64_le(quotePrice);
-        buf.write_i64_le(quoteQty);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, quoteId, 10);
+        out.write_i64_le(quotePrice);
+        out.write_i64_le(quoteQty);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        quoteId = codec::read_fixed_string(buf, 10);
+    void decode(ByteBufView& buf) override {
+        quoteId = codec::read_fixed_string<10>(buf);
         quotePrice = buf.read_i64_le();
         quoteQty = buf.read_i64_le();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::quoteId)) quoteId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quotePrice)) quotePrice = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::quoteQty)) quoteQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Quote2*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Quote2)) return false;
+        const auto* checkType = static_cast<const Quote2*>(&other);
         return quoteId == checkType->quoteId
                && quotePrice == checkType->quotePrice
                && quoteQty == checkType->quoteQty;
@@ -2318,23 +4430,60 @@ inline std::ostream& operator<<(std::ostream& os, const Quote2& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Quote2: each accessor decodes one field in place from the
+// wire bytes. Covers the first 26 bytes, the part of the layout with fixed offsets.
+class Quote2View {
+public:
+    static constexpr size_t kFixedSize = 26;
+
+    explicit Quote2View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view quoteId() const { return codec::fixed_string_view(data_ + 0, 10); }
+    int64_t quotePrice() const { return LittleEndian::load<int64_t>(data_ + 10); }
+    int64_t quoteQty() const { return LittleEndian::load<int64_t>(data_ + 18); }
 
-struct QuoteResponseExtend070 : public codec::BinaryCodec {
-    std::string cashMargin;
+private:
+    const uint8_t* data_;
+};
+
+
+struct QuoteResponseExtend070 final : public codec::BinaryCodec {
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 1;
 
     void encode(ByteBuf& buf) const override {
         codec::write_fixed_string(buf, cashMargin, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        cashMargin = codec::read_fixed_string(buf, 1);
+    void decode(ByteBufView& buf) override {
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const QuoteResponseExtend070*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(QuoteResponseExtend070)) return false;
+        const auto* checkType = static_cast<const QuoteResponseExtend070*>(&other);
         return cashMargin == checkType->cashMargin;
     }
     
@@ -2352,86 +4501,221 @@ inline std::ostream& operator<<(std::ostream& os, const QuoteResponseExtend070&
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded QuoteResponseExtend070: each accessor decodes one field in place from the
+// wire bytes. Covers the first 1 bytes, the part of the layout with fixed offsets.
+class QuoteResponseExtend070View {
+public:
+    static constexpr size_t kFixedSize = 1;
+
+    explicit QuoteResponseExtend070View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 0, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct QuoteResponseTag{};
 using QuoteResponseMessageFactory = MessageFactory<std::string, codec::BinaryCodec, QuoteResponseTag>;
-REGISTER_MESSAGE(QuoteResponseMessageFactory, "070", QuoteResponseExtend070);
+template <>
+struct GeneratedMessages<QuoteResponseTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("070"):
+                return std::make_unique<QuoteResponseExtend070>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using QuoteResponseApplExtend = codec::InlineMessage<QuoteResponseExtend070>;
 
 
-struct QuoteResponse : public codec::BinaryCodec {
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+struct QuoteResponse final : public codec::BinaryCodec {
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string clOrdId;
-    std::string accountId;
-    std::string branchId;
-    std::string quoteRespId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<10> quoteRespId;
     uint8_t quoteRespType;
-    std::string side;
+    codec::FixedString<1> side;
     int64_t validUntilTime;
     uint8_t quoteType;
     uint8_t priceType;
-    std::vector<Quote2> quote2;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    codec::List<Quote2> quote2;
+    QuoteResponseApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        clOrdId,
+        accountId,
+        branchId,
+        quoteRespId,
+        quoteRespType,
+        side,
+        validUntilTime,
+        quoteType,
+        priceType,
+        quote2,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, quoteRespId, 10);
-        buf.write_u8(quoteRespType);
-        codec::write_fixed_string(buf, side, 1);
-        buf.write_i64_le(validUntilTime);
-        buf.write_u8(quoteType);
-        buf.write_u8(priceType);
+        auto out = buf.claim(115);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, quoteRespId, 10);
+        out.write_u8(quoteRespType);
+        codec::write_fixed_string(out, side, 1);
+        out.write_i64_le(validUntilTime);
+        out.write_u8(quoteType);
+        out.write_u8(priceType);
         codec::write_object_List_le<uint16_t>(buf,quote2);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        quoteRespId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        quoteRespId = codec::read_fixed_string<10>(buf);
         quoteRespType = buf.read_u8();
-        side = codec::read_fixed_string(buf, 1);
+        side = codec::read_fixed_string<1>(buf);
         validUntilTime = buf.read_i64_le();
         quoteType = buf.read_u8();
         priceType = buf.read_u8();
-        quote2 = codec::read_object_List_le<uint16_t,Quote2>(buf);
-        applExtend = QuoteResponseMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        quote2 = codec::read_object_List_le<uint16_t,Quote2,codec::List<Quote2>>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                applExtend.emplace<QuoteResponseExtend070>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::quoteRespId)) quoteRespId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteRespType)) quoteRespType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::validUntilTime)) validUntilTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::quoteType)) quoteType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::priceType)) priceType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::quote2)) quote2 = codec::read_object_List_le<uint16_t,Quote2,codec::List<Quote2>>(buf);
+        else codec::skip_object_List_le<uint16_t,Quote2>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<QuoteResponseExtend070>().decode(buf);
+                else QuoteResponseExtend070().decode(buf, codec::FieldMask<QuoteResponseExtend070::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 115
+               + codec::object_list_size<uint16_t>(quote2)
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const QuoteResponse*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(QuoteResponse)) return false;
+        const auto* checkType = static_cast<const QuoteResponse*>(&other);
         return applId == checkType->applId
                && reportingPbuid == checkType->reportingPbuid
                && submittingPbuid == checkType->submittingPbuid
@@ -2506,27 +4790,83 @@ inline std::ostream& operator<<(std::ostream& os, const QuoteResponse& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded QuoteResponse: each accessor decodes one field in place from the
+// wire bytes. Covers the first 115 bytes, the part of the layout with fixed offsets.
+class QuoteResponseView {
+public:
+    static constexpr size_t kFixedSize = 115;
+
+    explicit QuoteResponseView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 0, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 3, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 9, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 15, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 23, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 27); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 29, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 31); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 39, 32); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 71, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 81, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 91, 2); }
+    std::string_view quoteRespId() const { return codec::fixed_string_view(data_ + 93, 10); }
+    uint8_t quoteRespType() const { return DefaultByteOrder::load<uint8_t>(data_ + 103); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 104, 1); }
+    int64_t validUntilTime() const { return LittleEndian::load<int64_t>(data_ + 105); }
+    uint8_t quoteType() const { return DefaultByteOrder::load<uint8_t>(data_ + 113); }
+    uint8_t priceType() const { return DefaultByteOrder::load<uint8_t>(data_ + 114); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 
-struct AllegeQuoteExtend070 : public codec::BinaryCodec {
-    std::string cashMargin;
-    std::string counterPartyPbuid;
+struct AllegeQuoteExtend070 final : public codec::BinaryCodec {
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<6> counterPartyPbuid;
+
+    enum class Field : uint8_t {
+        cashMargin,
+        counterPartyPbuid,
+    };
+
+    static constexpr size_t kWireSize = 7;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, counterPartyPbuid, 6);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, counterPartyPbuid, 6);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        cashMargin = codec::read_fixed_string<1>(buf);
+        counterPartyPbuid = codec::read_fixed_string<6>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::counterPartyPbuid)) counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        cashMargin = codec::read_fixed_string(buf, 1);
-        counterPartyPbuid = codec::read_fixed_string(buf, 6);
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const AllegeQuoteExtend070*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(AllegeQuoteExtend070)) return false;
+        const auto* checkType = static_cast<const AllegeQuoteExtend070*>(&other);
         return cashMargin == checkType->cashMargin
                && counterPartyPbuid == checkType->counterPartyPbuid;
     }
@@ -2547,31 +4887,62 @@ inline std::ostream& operator<<(std::ostream& os, const AllegeQuoteExtend070& pk
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded AllegeQuoteExtend070: each accessor decodes one field in place from the
+// wire bytes. Covers the first 7 bytes, the part of the layout with fixed offsets.
+class AllegeQuoteExtend070View {
+public:
+    static constexpr size_t kFixedSize = 7;
+
+    explicit AllegeQuoteExtend070View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 0, 1); }
+    std::string_view counterPartyPbuid() const { return codec::fixed_string_view(data_ + 1, 6); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct AllegeQuoteTag{};
 using AllegeQuoteMessageFactory = MessageFactory<std::string, codec::BinaryCodec, AllegeQuoteTag>;
-REGISTER_MESSAGE(AllegeQuoteMessageFactory, "070", AllegeQuoteExtend070);
+template <>
+struct GeneratedMessages<AllegeQuoteTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("070"):
+                return std::make_unique<AllegeQuoteExtend070>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using AllegeQuoteApplExtend = codec::InlineMessage<AllegeQuoteExtend070>;
 
 
-struct AllegeQuote : public codec::BinaryCodec {
+struct AllegeQuote final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string orderId;
-    std::string execId;
-    std::string clOrdId;
-    std::string accountId;
-    std::string quoteReqId;
-    std::string quoteId;
-    std::string quoteRespId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<16> orderId;
+    codec::FixedString<16> execId;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<10> quoteReqId;
+    codec::FixedString<10> quoteId;
+    codec::FixedString<10> quoteRespId;
     uint8_t quoteType;
     int64_t bidPx;
     int64_t offerPx;
@@ -2580,60 +4951,94 @@ struct AllegeQuote : public codec::BinaryCodec {
     uint8_t privateQuote;
     int64_t validUntilTime;
     uint8_t priceType;
-    std::string memo;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    codec::FixedString<120> memo;
+    AllegeQuoteApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        orderId,
+        execId,
+        clOrdId,
+        accountId,
+        quoteReqId,
+        quoteId,
+        quoteRespId,
+        quoteType,
+        bidPx,
+        offerPx,
+        bidSize,
+        offerSize,
+        privateQuote,
+        validUntilTime,
+        priceType,
+        memo,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, orderId, 16);
-        codec::write_fixed_string(buf, execId, 16);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, quoteReqId, 10);
-        codec::write_fixed_string(buf, quoteId, 10);
-        codec::write_fixed_string(buf, quoteRespId, 10);
-        buf.write_u8(quoteType);
-        buf.write_i64_le(bidPx);
-        buf.write_i64_le(offerPx);
-        buf.write_i64_le(bidSize);
-        buf.write_i64_le(offerSize);
-        buf.write_u8(privateQuote);
-        buf.write_i64_le(validUntilTime);
-        buf.write_u8(priceType);
-        codec::write_fixed_string(buf, memo, 120);
+        auto out = buf.claim(328);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, orderId, 16);
+        codec::write_fixed_string(out, execId, 16);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, quoteReqId, 10);
+        codec::write_fixed_string(out, quoteId, 10);
+        codec::write_fixed_string(out, quoteRespId, 10);
+        out.write_u8(quoteType);
+        out.write_i64_le(bidPx);
+        out.write_i64_le(offerPx);
+        out.write_i64_le(bidSize);
+        out.write_i64_le(offerSize);
+        out.write_u8(privateQuote);
+        out.write_i64_le(validUntilTime);
+        out.write_u8(priceType);
+        codec::write_fixed_string(out, memo, 120);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        orderId = codec::read_fixed_string(buf, 16);
-        execId = codec::read_fixed_string(buf, 16);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        quoteReqId = codec::read_fixed_string(buf, 10);
-        quoteId = codec::read_fixed_string(buf, 10);
-        quoteRespId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        orderId = codec::read_fixed_string<16>(buf);
+        execId = codec::read_fixed_string<16>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        quoteReqId = codec::read_fixed_string<10>(buf);
+        quoteId = codec::read_fixed_string<10>(buf);
+        quoteRespId = codec::read_fixed_string<10>(buf);
         quoteType = buf.read_u8();
         bidPx = buf.read_i64_le();
         offerPx = buf.read_i64_le();
@@ -2642,15 +5047,109 @@ struct AllegeQuote : public codec::BinaryCodec {
         privateQuote = buf.read_u8();
         validUntilTime = buf.read_i64_le();
         priceType = buf.read_u8();
-        memo = codec::read_fixed_string(buf, 120);
-        applExtend = AllegeQuoteMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        memo = codec::read_fixed_string<120>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                applExtend.emplace<AllegeQuoteExtend070>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::orderId)) orderId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::execId)) execId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteReqId)) quoteReqId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteId)) quoteId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteRespId)) quoteRespId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteType)) quoteType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::bidPx)) bidPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::offerPx)) offerPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::bidSize)) bidSize = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::offerSize)) offerSize = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::privateQuote)) privateQuote = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::validUntilTime)) validUntilTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::priceType)) priceType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::memo)) memo = codec::read_fixed_string<120>(buf);
+        else buf.skip_bytes(120);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("070"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<AllegeQuoteExtend070>().decode(buf);
+                else AllegeQuoteExtend070().decode(buf, codec::FieldMask<AllegeQuoteExtend070::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 328
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const AllegeQuote*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(AllegeQuote)) return false;
+        const auto* checkType = static_cast<const AllegeQuote*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -2749,26 +5248,68 @@ inline std::ostream& operator<<(std::ostream& os, const AllegeQuote& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded AllegeQuote: each accessor decodes one field in place from the
+// wire bytes. Covers the first 328 bytes, the part of the layout with fixed offsets.
+class AllegeQuoteView {
+public:
+    static constexpr size_t kFixedSize = 328;
+
+    explicit AllegeQuoteView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view orderId() const { return codec::fixed_string_view(data_ + 83, 16); }
+    std::string_view execId() const { return codec::fixed_string_view(data_ + 99, 16); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 115, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 125, 10); }
+    std::string_view quoteReqId() const { return codec::fixed_string_view(data_ + 135, 10); }
+    std::string_view quoteId() const { return codec::fixed_string_view(data_ + 145, 10); }
+    std::string_view quoteRespId() const { return codec::fixed_string_view(data_ + 155, 10); }
+    uint8_t quoteType() const { return DefaultByteOrder::load<uint8_t>(data_ + 165); }
+    int64_t bidPx() const { return LittleEndian::load<int64_t>(data_ + 166); }
+    int64_t offerPx() const { return LittleEndian::load<int64_t>(data_ + 174); }
+    int64_t bidSize() const { return LittleEndian::load<int64_t>(data_ + 182); }
+    int64_t offerSize() const { return LittleEndian::load<int64_t>(data_ + 190); }
+    uint8_t privateQuote() const { return DefaultByteOrder::load<uint8_t>(data_ + 198); }
+    int64_t validUntilTime() const { return LittleEndian::load<int64_t>(data_ + 199); }
+    uint8_t priceType() const { return DefaultByteOrder::load<uint8_t>(data_ + 207); }
+    std::string_view memo() const { return codec::fixed_string_view(data_ + 208, 120); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 
-struct AllegeQuoteResponse : public codec::BinaryCodec {
+struct AllegeQuoteResponse final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string orderId;
-    std::string execId;
-    std::string clOrdId;
-    std::string accountId;
-    std::string quoteId;
-    std::string quoteRespId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<16> orderId;
+    codec::FixedString<16> execId;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<10> accountId;
+    codec::FixedString<10> quoteId;
+    codec::FixedString<10> quoteRespId;
     uint8_t quoteRespType;
     uint8_t privateQuote;
     int64_t orderQty;
@@ -2777,52 +5318,82 @@ struct AllegeQuoteResponse : public codec::BinaryCodec {
     uint8_t quoteType;
     uint8_t priceType;
 
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        orderId,
+        execId,
+        clOrdId,
+        accountId,
+        quoteId,
+        quoteRespId,
+        quoteRespType,
+        privateQuote,
+        orderQty,
+        price,
+        validUntilTime,
+        quoteType,
+        priceType,
+    };
+
+    static constexpr size_t kWireSize = 183;
+
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, orderId, 16);
-        codec::write_fixed_string(buf, execId, 16);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, quoteId, 10);
-        codec::write_fixed_string(buf, quoteRespId, 10);
-        buf.write_u8(quoteRespType);
-        buf.write_u8(privateQuote);
-        buf.write_i64_le(orderQty);
-        buf.write_i64_le(price);
-        buf.write_i64_le(validUntilTime);
-        buf.write_u8(quoteType);
-        buf.write_u8(priceType);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
+        auto out = buf.claim(kWireSize);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, orderId, 16);
+        codec::write_fixed_string(out, execId, 16);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, quoteId, 10);
+        codec::write_fixed_string(out, quoteRespId, 10);
+        out.write_u8(quoteRespType);
+        out.write_u8(privateQuote);
+        out.write_i64_le(orderQty);
+        out.write_i64_le(price);
+        out.write_i64_le(validUntilTime);
+        out.write_u8(quoteType);
+        out.write_u8(priceType);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        orderId = codec::read_fixed_string(buf, 16);
-        execId = codec::read_fixed_string(buf, 16);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        accountId = codec::read_fixed_string(buf, 10);
-        quoteId = codec::read_fixed_string(buf, 10);
-        quoteRespId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        orderId = codec::read_fixed_string<16>(buf);
+        execId = codec::read_fixed_string<16>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        quoteId = codec::read_fixed_string<10>(buf);
+        quoteRespId = codec::read_fixed_string<10>(buf);
         quoteRespType = buf.read_u8();
         privateQuote = buf.read_u8();
         orderQty = buf.read_i64_le();
@@ -2833,9 +5404,68 @@ struct AllegeQuoteResponse : public codec::BinaryCodec {
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::applId)) applId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::orderId)) orderId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::execId)) execId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteId)) quoteId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteRespId)) quoteRespId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::quoteRespType)) quoteRespType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::privateQuote)) privateQuote = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::price)) price = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::validUntilTime)) validUntilTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::quoteType)) quoteType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::priceType)) priceType = buf.read_u8();
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const AllegeQuoteResponse*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(AllegeQuoteResponse)) return false;
+        const auto* checkType = static_cast<const AllegeQuoteResponse*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -2922,44 +5552,124 @@ inline std::ostream& operator<<(std::ostream& os, const AllegeQuoteResponse& pkt
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded AllegeQuoteResponse: each accessor decodes one field in place from the
+// wire bytes. Covers the first 183 bytes, the part of the layout with fixed offsets.
+class AllegeQuoteResponseView {
+public:
+    static constexpr size_t kFixedSize = 183;
+
+    explicit AllegeQuoteResponseView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view orderId() const { return codec::fixed_string_view(data_ + 83, 16); }
+    std::string_view execId() const { return codec::fixed_string_view(data_ + 99, 16); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 115, 10); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 125, 10); }
+    std::string_view quoteId() const { return codec::fixed_string_view(data_ + 135, 10); }
+    std::string_view quoteRespId() const { return codec::fixed_string_view(data_ + 145, 10); }
+    uint8_t quoteRespType() const { return DefaultByteOrder::load<uint8_t>(data_ + 155); }
+    uint8_t privateQuote() const { return DefaultByteOrder::load<uint8_t>(data_ + 156); }
+    int64_t orderQty() const { return LittleEndian::load<int64_t>(data_ + 157); }
+    int64_t price() const { return LittleEndian::load<int64_t>(data_ + 165); }
+    int64_t validUntilTime() const { return LittleEndian::load<int64_t>(data_ + 173); }
+    uint8_t quoteType() const { return DefaultByteOrder::load<uint8_t>(data_ + 181); }
+    uint8_t priceType() const { return DefaultByteOrder::load<uint8_t>(data_ + 182); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct TradeCaptureReportExtend031 : public codec::BinaryCodec {
-    std::string memberId;
-    std::string traderCode;
-    std::string counterPartyMemberId;
-    std::string counterPartyTraderCode;
-    std::string settlType;
-    std::string settlPeriod;
-    std::string cashMargin;
-    std::string memo;
+struct TradeCaptureReportExtend031 final : public codec::BinaryCodec {
+    codec::FixedString<6> memberId;
+    codec::FixedString<5> traderCode;
+    codec::FixedString<6> counterPartyMemberId;
+    codec::FixedString<5> counterPartyTraderCode;
+    codec::FixedString<1> settlType;
+    codec::FixedString<1> settlPeriod;
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<120> memo;
+
+    enum class Field : uint8_t {
+        memberId,
+        traderCode,
+        counterPartyMemberId,
+        counterPartyTraderCode,
+        settlType,
+        settlPeriod,
+        cashMargin,
+        memo,
+    };
+
+    static constexpr size_t kWireSize = 145;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, memberId, 6);
-        codec::write_fixed_string(buf, traderCode, 5);
-        codec::write_fixed_string(buf, counterPartyMemberId, 6);
-        codec::write_fixed_string(buf, counterPartyTraderCode, 5);
-        codec::write_fixed_string(buf, settlType, 1);
-        codec::write_fixed_string(buf, settlPeriod, 1);
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, memo, 120);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, memberId, 6);
+        codec::write_fixed_string(out, traderCode, 5);
+        codec::write_fixed_string(out, counterPartyMemberId, 6);
+        codec::write_fixed_string(out, counterPartyTraderCode, 5);
+        codec::write_fixed_string(out, settlType, 1);
+        codec::write_fixed_string(out, settlPeriod, 1);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, memo, 120);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        memberId = codec::read_fixed_string<6>(buf);
+        traderCode = codec::read_fixed_string<5>(buf);
+        counterPartyMemberId = codec::read_fixed_string<6>(buf);
+        counterPartyTraderCode = codec::read_fixed_string<5>(buf);
+        settlType = codec::read_fixed_string<1>(buf);
+        settlPeriod = codec::read_fixed_string<1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+        memo = codec::read_fixed_string<120>(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        memberId = codec::read_fixed_string(buf, 6);
-        traderCode = codec::read_fixed_string(buf, 5);
-        counterPartyMemberId = codec::read_fixed_string(buf, 6);
-        counterPartyTraderCode = codec::read_fixed_string(buf, 5);
-        settlType = codec::read_fixed_string(buf, 1);
-        settlPeriod = codec::read_fixed_string(buf, 1);
-        cashMargin = codec::read_fixed_string(buf, 1);
-        memo = codec::read_fixed_string(buf, 120);
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::memberId)) memberId = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::traderCode)) traderCode = codec::read_fixed_string<5>(buf);
+        else buf.skip_bytes(5);
+        if(mask.has(Field::counterPartyMemberId)) counterPartyMemberId = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::counterPartyTraderCode)) counterPartyTraderCode = codec::read_fixed_string<5>(buf);
+        else buf.skip_bytes(5);
+        if(mask.has(Field::settlType)) settlType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::settlPeriod)) settlPeriod = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::memo)) memo = codec::read_fixed_string<120>(buf);
+        else buf.skip_bytes(120);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportExtend031*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReportExtend031)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReportExtend031*>(&other);
         return memberId == checkType->memberId
                && traderCode == checkType->traderCode
                && counterPartyMemberId == checkType->counterPartyMemberId
@@ -2998,29 +5708,78 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportExtend
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReportExtend031: each accessor decodes one field in place from the
+// wire bytes. Covers the first 145 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportExtend031View {
+public:
+    static constexpr size_t kFixedSize = 145;
+
+    explicit TradeCaptureReportExtend031View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view memberId() const { return codec::fixed_string_view(data_ + 0, 6); }
+    std::string_view traderCode() const { return codec::fixed_string_view(data_ + 6, 5); }
+    std::string_view counterPartyMemberId() const { return codec::fixed_string_view(data_ + 11, 6); }
+    std::string_view counterPartyTraderCode() const { return codec::fixed_string_view(data_ + 17, 5); }
+    std::string_view settlType() const { return codec::fixed_string_view(data_ + 22, 1); }
+    std::string_view settlPeriod() const { return codec::fixed_string_view(data_ + 23, 1); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 24, 1); }
+    std::string_view memo() const { return codec::fixed_string_view(data_ + 25, 120); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct TradeCaptureReportExtend051 : public codec::BinaryCodec {
+struct TradeCaptureReportExtend051 final : public codec::BinaryCodec {
     uint16_t expirationDays;
     uint8_t expirationType;
-    std::string shareProperty;
+    codec::FixedString<2> shareProperty;
+
+    enum class Field : uint8_t {
+        expirationDays,
+        expirationType,
+        shareProperty,
+    };
+
+    static constexpr size_t kWireSize = 5;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(expirationDays);
-        buf.write_u8(expirationType);
-        codec::write_fixed_string(buf, shareProperty, 2);
+        auto out = buf.claim(kWireSize);
+        out.write_u16_le(expirationDays);
+        out.write_u8(expirationType);
+        codec::write_fixed_string(out, shareProperty, 2);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         expirationDays = buf.read_u16_le();
         expirationType = buf.read_u8();
-        shareProperty = codec::read_fixed_string(buf, 2);
+        shareProperty = codec::read_fixed_string<2>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::expirationDays)) expirationDays = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::expirationType)) expirationType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::shareProperty)) shareProperty = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportExtend051*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReportExtend051)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReportExtend051*>(&other);
         return expirationDays == checkType->expirationDays
                && expirationType == checkType->expirationType
                && shareProperty == checkType->shareProperty;
@@ -3044,21 +5803,49 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportExtend
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReportExtend051: each accessor decodes one field in place from the
+// wire bytes. Covers the first 5 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportExtend051View {
+public:
+    static constexpr size_t kFixedSize = 5;
+
+    explicit TradeCaptureReportExtend051View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t expirationDays() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint8_t expirationType() const { return DefaultByteOrder::load<uint8_t>(data_ + 2); }
+    std::string_view shareProperty() const { return codec::fixed_string_view(data_ + 3, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct TradeCaptureReportExtend060 final : public codec::BinaryCodec {
 
-struct TradeCaptureReportExtend060 : public codec::BinaryCodec {
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportExtend060*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(TradeCaptureReportExtend060);
     }
     
     std::string toString() const override {
@@ -3075,20 +5862,30 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportExtend
 }
 
 
-struct TradeCaptureReportExtend061 : public codec::BinaryCodec {
+struct TradeCaptureReportExtend061 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportExtend061*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(TradeCaptureReportExtend061);
     }
     
     std::string toString() const override {
@@ -3105,22 +5902,41 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportExtend
 }
 
 
-struct TradeCaptureReportExtend062 : public codec::BinaryCodec {
-    std::string cashMargin;
+struct TradeCaptureReportExtend062 final : public codec::BinaryCodec {
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 1;
 
     void encode(ByteBuf& buf) const override {
         codec::write_fixed_string(buf, cashMargin, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        cashMargin = codec::read_fixed_string(buf, 1);
+    void decode(ByteBufView& buf) override {
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportExtend062*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReportExtend062)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReportExtend062*>(&other);
         return cashMargin == checkType->cashMargin;
     }
     
@@ -3138,108 +5954,292 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportExtend
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReportExtend062: each accessor decodes one field in place from the
+// wire bytes. Covers the first 1 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportExtend062View {
+public:
+    static constexpr size_t kFixedSize = 1;
 
-struct TradeCaptureReportTag{};
-using TradeCaptureReportMessageFactory = MessageFactory<std::string, codec::BinaryCodec, TradeCaptureReportTag>;
-REGISTER_MESSAGE(TradeCaptureReportMessageFactory, "031", TradeCaptureReportExtend031);
-REGISTER_MESSAGE(TradeCaptureReportMessageFactory, "051", TradeCaptureReportExtend051);
-REGISTER_MESSAGE(TradeCaptureReportMessageFactory, "060", TradeCaptureReportExtend060);
-REGISTER_MESSAGE(TradeCaptureReportMessageFactory, "061", TradeCaptureReportExtend061);
-REGISTER_MESSAGE(TradeCaptureReportMessageFactory, "062", TradeCaptureReportExtend062);
-
-
-struct TradeCaptureReport : public codec::BinaryCodec {
-    std::string applId;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
-    uint16_t ownerType;
-    std::string clearingFirm;
+    explicit TradeCaptureReportExtend062View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 0, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct TradeCaptureReportTag{};
+using TradeCaptureReportMessageFactory = MessageFactory<std::string, codec::BinaryCodec, TradeCaptureReportTag>;
+template <>
+struct GeneratedMessages<TradeCaptureReportTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("031"):
+                return std::make_unique<TradeCaptureReportExtend031>();
+            case codec::pack_key("051"):
+                return std::make_unique<TradeCaptureReportExtend051>();
+            case codec::pack_key("060"):
+                return std::make_unique<TradeCaptureReportExtend060>();
+            case codec::pack_key("061"):
+                return std::make_unique<TradeCaptureReportExtend061>();
+            case codec::pack_key("062"):
+                return std::make_unique<TradeCaptureReportExtend062>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using TradeCaptureReportApplExtend = codec::InlineMessage<TradeCaptureReportExtend031, TradeCaptureReportExtend051, TradeCaptureReportExtend060, TradeCaptureReportExtend061, TradeCaptureReportExtend062>;
+
+
+struct TradeCaptureReport final : public codec::BinaryCodec {
+    codec::FixedString<3> applId;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
+    uint16_t ownerType;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string tradeReportId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<10> tradeReportId;
     uint8_t tradeReportType;
     uint8_t tradeReportTransType;
-    std::string tradeHandlingInstr;
-    std::string tradeReportRefId;
+    codec::FixedString<1> tradeHandlingInstr;
+    codec::FixedString<10> tradeReportRefId;
     int64_t lastPx;
     int64_t lastQty;
     uint16_t trdType;
     uint16_t trdSubType;
     uint32_t confirmId;
-    std::string side;
-    std::string pbuid;
-    std::string accountId;
-    std::string branchId;
-    std::string counterPartyPbuid;
-    std::string counterPartyAccountId;
-    std::string counterPartyBranchId;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    codec::FixedString<1> side;
+    codec::FixedString<6> pbuid;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<6> counterPartyPbuid;
+    codec::FixedString<10> counterPartyAccountId;
+    codec::FixedString<2> counterPartyBranchId;
+    TradeCaptureReportApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        applId,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        tradeReportId,
+        tradeReportType,
+        tradeReportTransType,
+        tradeHandlingInstr,
+        tradeReportRefId,
+        lastPx,
+        lastQty,
+        trdType,
+        trdSubType,
+        confirmId,
+        side,
+        pbuid,
+        accountId,
+        branchId,
+        counterPartyPbuid,
+        counterPartyAccountId,
+        counterPartyBranchId,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, tradeReportId, 10);
-        buf.write_u8(tradeReportType);
-        buf.write_u8(tradeReportTransType);
-        codec::write_fixed_string(buf, tradeHandlingInstr, 1);
-        codec::write_fixed_string(buf, tradeReportRefId, 10);
-        buf.write_i64_le(lastPx);
-        buf.write_i64_le(lastQty);
-        buf.write_u16_le(trdType);
-        buf.write_u16_le(trdSubType);
-        buf.write_u32_le(confirmId);
-        codec::write_fixed_string(buf, side, 1);
-        codec::write_fixed_string(buf, pbuid, 6);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, counterPartyPbuid, 6);
-        codec::write_fixed_string(buf, counterPartyAccountId, 10);
-        codec::write_fixed_string(buf, counterPartyBranchId, 2);
+        auto out = buf.claim(149);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, tradeReportId, 10);
+        out.write_u8(tradeReportType);
+        out.write_u8(tradeReportTransType);
+        codec::write_fixed_string(out, tradeHandlingInstr, 1);
+        codec::write_fixed_string(out, tradeReportRefId, 10);
+        out.write_i64_le(lastPx);
+        out.write_i64_le(lastQty);
+        out.write_u16_le(trdType);
+        out.write_u16_le(trdSubType);
+        out.write_u32_le(confirmId);
+        codec::write_fixed_string(out, side, 1);
+        codec::write_fixed_string(out, pbuid, 6);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, counterPartyPbuid, 6);
+        codec::write_fixed_string(out, counterPartyAccountId, 10);
+        codec::write_fixed_string(out, counterPartyBranchId, 2);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        applId = codec::read_fixed_string(buf, 3);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
+        applId = codec::read_fixed_string<3>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        tradeReportId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        tradeReportId = codec::read_fixed_string<10>(buf);
         tradeReportType = buf.read_u8();
         tradeReportTransType = buf.read_u8();
-        tradeHandlingInstr = codec::read_fixed_string(buf, 1);
-        tradeReportRefId = codec::read_fixed_string(buf, 10);
+        tradeHandlingInstr = codec::read_fixed_string<1>(buf);
+        tradeReportRefId = codec::read_fixed_string<10>(buf);
         lastPx = buf.read_i64_le();
         lastQty = buf.read_i64_le();
         trdType = buf.read_u16_le();
         trdSubType = buf.read_u16_le();
         confirmId = buf.read_u32_le();
-        side = codec::read_fixed_string(buf, 1);
-        pbuid = codec::read_fixed_string(buf, 6);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        counterPartyPbuid = codec::read_fixed_string(buf, 6);
-        counterPartyAccountId = codec::read_fixed_string(buf, 10);
-        counterPartyBranchId = codec::read_fixed_string(buf, 2);
-        applExtend = TradeCaptureReportMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        side = codec::read_fixed_string<1>(buf);
+        pbuid = codec::read_fixed_string<6>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        counterPartyAccountId = codec::read_fixed_string<10>(buf);
+        counterPartyBranchId = codec::read_fixed_string<2>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("031"):
+                applExtend.emplace<TradeCaptureReportExtend031>().decode(buf);
+                break;
+            case codec::pack_key("051"):
+                applExtend.emplace<TradeCaptureReportExtend051>().decode(buf);
+                break;
+            case codec::pack_key("060"):
+                applExtend.emplace<TradeCaptureReportExtend060>().decode(buf);
+                break;
+            case codec::pack_key("061"):
+                applExtend.emplace<TradeCaptureReportExtend061>().decode(buf);
+                break;
+            case codec::pack_key("062"):
+                applExtend.emplace<TradeCaptureReportExtend062>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::tradeReportId)) tradeReportId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::tradeReportType)) tradeReportType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeReportTransType)) tradeReportTransType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeHandlingInstr)) tradeHandlingInstr = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeReportRefId)) tradeReportRefId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::lastPx)) lastPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::lastQty)) lastQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::trdType)) trdType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::trdSubType)) trdSubType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::confirmId)) confirmId = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::pbuid)) pbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::counterPartyPbuid)) counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::counterPartyAccountId)) counterPartyAccountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::counterPartyBranchId)) counterPartyBranchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("031"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportExtend031>().decode(buf);
+                else TradeCaptureReportExtend031().decode(buf, codec::FieldMask<TradeCaptureReportExtend031::Field>());
+                break;
+            case codec::pack_key("051"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportExtend051>().decode(buf);
+                else TradeCaptureReportExtend051().decode(buf, codec::FieldMask<TradeCaptureReportExtend051::Field>());
+                break;
+            case codec::pack_key("060"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportExtend060>().decode(buf);
+                else TradeCaptureReportExtend060().decode(buf, codec::FieldMask<TradeCaptureReportExtend060::Field>());
+                break;
+            case codec::pack_key("061"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportExtend061>().decode(buf);
+                else TradeCaptureReportExtend061().decode(buf, codec::FieldMask<TradeCaptureReportExtend061::Field>());
+                break;
+            case codec::pack_key("062"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportExtend062>().decode(buf);
+                else TradeCaptureReportExtend062().decode(buf, codec::FieldMask<TradeCaptureReportExtend062::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 149
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReport*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReport)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReport*>(&other);
         return applId == checkType->applId
                && submittingPbuid == checkType->submittingPbuid
                && securityId == checkType->securityId
@@ -3332,49 +6332,130 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReport& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReport: each accessor decodes one field in place from the
+// wire bytes. Covers the first 149 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportView {
+public:
+    static constexpr size_t kFixedSize = 149;
+
+    explicit TradeCaptureReportView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 0, 3); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 3, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 9, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 17, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 21); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 23, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 25); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 33, 32); }
+    std::string_view tradeReportId() const { return codec::fixed_string_view(data_ + 65, 10); }
+    uint8_t tradeReportType() const { return DefaultByteOrder::load<uint8_t>(data_ + 75); }
+    uint8_t tradeReportTransType() const { return DefaultByteOrder::load<uint8_t>(data_ + 76); }
+    std::string_view tradeHandlingInstr() const { return codec::fixed_string_view(data_ + 77, 1); }
+    std::string_view tradeReportRefId() const { return codec::fixed_string_view(data_ + 78, 10); }
+    int64_t lastPx() const { return LittleEndian::load<int64_t>(data_ + 88); }
+    int64_t lastQty() const { return LittleEndian::load<int64_t>(data_ + 96); }
+    uint16_t trdType() const { return LittleEndian::load<uint16_t>(data_ + 104); }
+    uint16_t trdSubType() const { return LittleEndian::load<uint16_t>(data_ + 106); }
+    uint32_t confirmId() const { return LittleEndian::load<uint32_t>(data_ + 108); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 112, 1); }
+    std::string_view pbuid() const { return codec::fixed_string_view(data_ + 113, 6); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 119, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 129, 2); }
+    std::string_view counterPartyPbuid() const { return codec::fixed_string_view(data_ + 131, 6); }
+    std::string_view counterPartyAccountId() const { return codec::fixed_string_view(data_ + 137, 10); }
+    std::string_view counterPartyBranchId() const { return codec::fixed_string_view(data_ + 147, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+
 
 
 
 
+struct TradeCaptureReportAckExtend031 final : public codec::BinaryCodec {
+    codec::FixedString<6> memberId;
+    codec::FixedString<5> traderCode;
+    codec::FixedString<6> counterPartyMemberId;
+    codec::FixedString<5> counterPartyTraderCode;
+    codec::FixedString<1> settlType;
+    codec::FixedString<1> settlPeriod;
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<120> memo;
 
+    enum class Field : uint8_t {
+        memberId,
+        traderCode,
+        counterPartyMemberId,
+        counterPartyTraderCode,
+        settlType,
+        settlPeriod,
+        cashMargin,
+        memo,
+    };
 
-struct TradeCaptureReportAckExtend031 : public codec::BinaryCodec {
-    std::string memberId;
-    std::string traderCode;
-    std::string counterPartyMemberId;
-    std::string counterPartyTraderCode;
-    std::string settlType;
-    std::string settlPeriod;
-    std::string cashMargin;
-    std::string memo;
+    static constexpr size_t kWireSize = 145;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, memberId, 6);
-        codec::write_fixed_string(buf, traderCode, 5);
-        codec::write_fixed_string(buf, counterPartyMemberId, 6);
-        codec::write_fixed_string(buf, counterPartyTraderCode, 5);
-        codec::write_fixed_string(buf, settlType, 1);
-        codec::write_fixed_string(buf, settlPeriod, 1);
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, memo, 120);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, memberId, 6);
+        codec::write_fixed_string(out, traderCode, 5);
+        codec::write_fixed_string(out, counterPartyMemberId, 6);
+        codec::write_fixed_string(out, counterPartyTraderCode, 5);
+        codec::write_fixed_string(out, settlType, 1);
+        codec::write_fixed_string(out, settlPeriod, 1);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, memo, 120);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        memberId = codec::read_fixed_string<6>(buf);
+        traderCode = codec::read_fixed_string<5>(buf);
+        counterPartyMemberId = codec::read_fixed_string<6>(buf);
+        counterPartyTraderCode = codec::read_fixed_string<5>(buf);
+        settlType = codec::read_fixed_string<1>(buf);
+        settlPeriod = codec::read_fixed_string<1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+        memo = codec::read_fixed_string<120>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::memberId)) memberId = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::traderCode)) traderCode = codec::read_fixed_string<5>(buf);
+        else buf.skip_bytes(5);
+        if(mask.has(Field::counterPartyMemberId)) counterPartyMemberId = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::counterPartyTraderCode)) counterPartyTraderCode = codec::read_fixed_string<5>(buf);
+        else buf.skip_bytes(5);
+        if(mask.has(Field::settlType)) settlType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::settlPeriod)) settlPeriod = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::memo)) memo = codec::read_fixed_string<120>(buf);
+        else buf.skip_bytes(120);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        memberId = codec::read_fixed_string(buf, 6);
-        traderCode = codec::read_fixed_string(buf, 5);
-        counterPartyMemberId = codec::read_fixed_string(buf, 6);
-        counterPartyTraderCode = codec::read_fixed_string(buf, 5);
-        settlType = codec::read_fixed_string(buf, 1);
-        settlPeriod = codec::read_fixed_string(buf, 1);
-        cashMargin = codec::read_fixed_string(buf, 1);
-        memo = codec::read_fixed_string(buf, 120);
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportAckExtend031*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReportAckExtend031)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReportAckExtend031*>(&other);
         return memberId == checkType->memberId
                && traderCode == checkType->traderCode
                && counterPartyMemberId == checkType->counterPartyMemberId
@@ -3413,29 +6494,78 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportAckExt
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReportAckExtend031: each accessor decodes one field in place from the
+// wire bytes. Covers the first 145 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportAckExtend031View {
+public:
+    static constexpr size_t kFixedSize = 145;
+
+    explicit TradeCaptureReportAckExtend031View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view memberId() const { return codec::fixed_string_view(data_ + 0, 6); }
+    std::string_view traderCode() const { return codec::fixed_string_view(data_ + 6, 5); }
+    std::string_view counterPartyMemberId() const { return codec::fixed_string_view(data_ + 11, 6); }
+    std::string_view counterPartyTraderCode() const { return codec::fixed_string_view(data_ + 17, 5); }
+    std::string_view settlType() const { return codec::fixed_string_view(data_ + 22, 1); }
+    std::string_view settlPeriod() const { return codec::fixed_string_view(data_ + 23, 1); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 24, 1); }
+    std::string_view memo() const { return codec::fixed_string_view(data_ + 25, 120); }
 
-struct TradeCaptureReportAckExtend051 : public codec::BinaryCodec {
+private:
+    const uint8_t* data_;
+};
+
+
+struct TradeCaptureReportAckExtend051 final : public codec::BinaryCodec {
     uint16_t expirationDays;
     uint8_t expirationType;
-    std::string shareProperty;
+    codec::FixedString<2> shareProperty;
+
+    enum class Field : uint8_t {
+        expirationDays,
+        expirationType,
+        shareProperty,
+    };
+
+    static constexpr size_t kWireSize = 5;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(expirationDays);
-        buf.write_u8(expirationType);
-        codec::write_fixed_string(buf, shareProperty, 2);
+        auto out = buf.claim(kWireSize);
+        out.write_u16_le(expirationDays);
+        out.write_u8(expirationType);
+        codec::write_fixed_string(out, shareProperty, 2);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         expirationDays = buf.read_u16_le();
         expirationType = buf.read_u8();
-        shareProperty = codec::read_fixed_string(buf, 2);
+        shareProperty = codec::read_fixed_string<2>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::expirationDays)) expirationDays = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::expirationType)) expirationType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::shareProperty)) shareProperty = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportAckExtend051*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReportAckExtend051)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReportAckExtend051*>(&other);
         return expirationDays == checkType->expirationDays
                && expirationType == checkType->expirationType
                && shareProperty == checkType->shareProperty;
@@ -3459,21 +6589,49 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportAckExt
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReportAckExtend051: each accessor decodes one field in place from the
+// wire bytes. Covers the first 5 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportAckExtend051View {
+public:
+    static constexpr size_t kFixedSize = 5;
+
+    explicit TradeCaptureReportAckExtend051View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t expirationDays() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint8_t expirationType() const { return DefaultByteOrder::load<uint8_t>(data_ + 2); }
+    std::string_view shareProperty() const { return codec::fixed_string_view(data_ + 3, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct TradeCaptureReportAckExtend060 : public codec::BinaryCodec {
+struct TradeCaptureReportAckExtend060 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportAckExtend060*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(TradeCaptureReportAckExtend060);
     }
     
     std::string toString() const override {
@@ -3490,20 +6648,30 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportAckExt
 }
 
 
-struct TradeCaptureReportAckExtend061 : public codec::BinaryCodec {
+struct TradeCaptureReportAckExtend061 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportAckExtend061*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(TradeCaptureReportAckExtend061);
     }
     
     std::string toString() const override {
@@ -3520,22 +6688,41 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportAckExt
 }
 
 
-struct TradeCaptureReportAckExtend062 : public codec::BinaryCodec {
-    std::string cashMargin;
+struct TradeCaptureReportAckExtend062 final : public codec::BinaryCodec {
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 1;
 
     void encode(ByteBuf& buf) const override {
         codec::write_fixed_string(buf, cashMargin, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        cashMargin = codec::read_fixed_string(buf, 1);
+    void decode(ByteBufView& buf) override {
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportAckExtend062*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReportAckExtend062)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReportAckExtend062*>(&other);
         return cashMargin == checkType->cashMargin;
     }
     
@@ -3553,34 +6740,68 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportAckExt
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReportAckExtend062: each accessor decodes one field in place from the
+// wire bytes. Covers the first 1 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportAckExtend062View {
+public:
+    static constexpr size_t kFixedSize = 1;
+
+    explicit TradeCaptureReportAckExtend062View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 0, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct TradeCaptureReportAckTag{};
 using TradeCaptureReportAckMessageFactory = MessageFactory<std::string, codec::BinaryCodec, TradeCaptureReportAckTag>;
-REGISTER_MESSAGE(TradeCaptureReportAckMessageFactory, "031", TradeCaptureReportAckExtend031);
-REGISTER_MESSAGE(TradeCaptureReportAckMessageFactory, "051", TradeCaptureReportAckExtend051);
-REGISTER_MESSAGE(TradeCaptureReportAckMessageFactory, "060", TradeCaptureReportAckExtend060);
-REGISTER_MESSAGE(TradeCaptureReportAckMessageFactory, "061", TradeCaptureReportAckExtend061);
-REGISTER_MESSAGE(TradeCaptureReportAckMessageFactory, "062", TradeCaptureReportAckExtend062);
+template <>
+struct GeneratedMessages<TradeCaptureReportAckTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("031"):
+                return std::make_unique<TradeCaptureReportAckExtend031>();
+            case codec::pack_key("051"):
+                return std::make_unique<TradeCaptureReportAckExtend051>();
+            case codec::pack_key("060"):
+                return std::make_unique<TradeCaptureReportAckExtend060>();
+            case codec::pack_key("061"):
+                return std::make_unique<TradeCaptureReportAckExtend061>();
+            case codec::pack_key("062"):
+                return std::make_unique<TradeCaptureReportAckExtend062>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using TradeCaptureReportAckApplExtend = codec::InlineMessage<TradeCaptureReportAckExtend031, TradeCaptureReportAckExtend051, TradeCaptureReportAckExtend060, TradeCaptureReportAckExtend061, TradeCaptureReportAckExtend062>;
 
 
-struct TradeCaptureReportAck : public codec::BinaryCodec {
+struct TradeCaptureReportAck final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string tradeId;
-    std::string tradeReportId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<16> tradeId;
+    codec::FixedString<10> tradeReportId;
     uint8_t tradeReportType;
     uint8_t tradeReportTransType;
-    std::string tradeHandlingInstr;
-    std::string tradeReportRefId;
+    codec::FixedString<1> tradeHandlingInstr;
+    codec::FixedString<10> tradeReportRefId;
     uint8_t trdAckStatus;
     uint8_t trdRptStatus;
     uint16_t tradeReportRejectReason;
@@ -3589,72 +6810,112 @@ struct TradeCaptureReportAck : public codec::BinaryCodec {
     uint16_t trdType;
     uint16_t trdSubType;
     uint32_t confirmId;
-    std::string execId;
-    std::string side;
-    std::string pbuid;
-    std::string accountId;
-    std::string branchId;
-    std::string counterPartyPbuid;
-    std::string counterPartyAccountId;
-    std::string counterPartyBranchId;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    codec::FixedString<16> execId;
+    codec::FixedString<1> side;
+    codec::FixedString<6> pbuid;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<6> counterPartyPbuid;
+    codec::FixedString<10> counterPartyAccountId;
+    codec::FixedString<2> counterPartyBranchId;
+    TradeCaptureReportAckApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        tradeId,
+        tradeReportId,
+        tradeReportType,
+        tradeReportTransType,
+        tradeHandlingInstr,
+        tradeReportRefId,
+        trdAckStatus,
+        trdRptStatus,
+        tradeReportRejectReason,
+        lastPx,
+        lastQty,
+        trdType,
+        trdSubType,
+        confirmId,
+        execId,
+        side,
+        pbuid,
+        accountId,
+        branchId,
+        counterPartyPbuid,
+        counterPartyAccountId,
+        counterPartyBranchId,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, tradeId, 16);
-        codec::write_fixed_string(buf, tradeReportId, 10);
-        buf.write_u8(tradeReportType);
-        buf.write_u8(tradeReportTransType);
-        codec::write_fixed_string(buf, tradeHandlingInstr, 1);
-        codec::write_fixed_string(buf, tradeReportRefId, 10);
-        buf.write_u8(trdAckStatus);
-        buf.write_u8(trdRptStatus);
-        buf.write_u16_le(tradeReportRejectReason);
-        buf.write_i64_le(lastPx);
-        buf.write_i64_le(lastQty);
-        buf.write_u16_le(trdType);
-        buf.write_u16_le(trdSubType);
-        buf.write_u32_le(confirmId);
-        codec::write_fixed_string(buf, execId, 16);
-        codec::write_fixed_string(buf, side, 1);
-        codec::write_fixed_string(buf, pbuid, 6);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, counterPartyPbuid, 6);
-        codec::write_fixed_string(buf, counterPartyAccountId, 10);
-        codec::write_fixed_string(buf, counterPartyBranchId, 2);
+        auto out = buf.claim(203);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, tradeId, 16);
+        codec::write_fixed_string(out, tradeReportId, 10);
+        out.write_u8(tradeReportType);
+        out.write_u8(tradeReportTransType);
+        codec::write_fixed_string(out, tradeHandlingInstr, 1);
+        codec::write_fixed_string(out, tradeReportRefId, 10);
+        out.write_u8(trdAckStatus);
+        out.write_u8(trdRptStatus);
+        out.write_u16_le(tradeReportRejectReason);
+        out.write_i64_le(lastPx);
+        out.write_i64_le(lastQty);
+        out.write_u16_le(trdType);
+        out.write_u16_le(trdSubType);
+        out.write_u32_le(confirmId);
+        codec::write_fixed_string(out, execId, 16);
+        codec::write_fixed_string(out, side, 1);
+        codec::write_fixed_string(out, pbuid, 6);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, counterPartyPbuid, 6);
+        codec::write_fixed_string(out, counterPartyAccountId, 10);
+        codec::write_fixed_string(out, counterPartyBranchId, 2);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        tradeId = codec::read_fixed_string(buf, 16);
-        tradeReportId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        tradeId = codec::read_fixed_string<16>(buf);
+        tradeReportId = codec::read_fixed_string<10>(buf);
         tradeReportType = buf.read_u8();
         tradeReportTransType = buf.read_u8();
-        tradeHandlingInstr = codec::read_fixed_string(buf, 1);
-        tradeReportRefId = codec::read_fixed_string(buf, 10);
+        tradeHandlingInstr = codec::read_fixed_string<1>(buf);
+        tradeReportRefId = codec::read_fixed_string<10>(buf);
         trdAckStatus = buf.read_u8();
         trdRptStatus = buf.read_u8();
         tradeReportRejectReason = buf.read_u16_le();
@@ -3663,22 +6924,156 @@ struct TradeCaptureReportAck : public codec::BinaryCodec {
         trdType = buf.read_u16_le();
         trdSubType = buf.read_u16_le();
         confirmId = buf.read_u32_le();
-        execId = codec::read_fixed_string(buf, 16);
-        side = codec::read_fixed_string(buf, 1);
-        pbuid = codec::read_fixed_string(buf, 6);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        counterPartyPbuid = codec::read_fixed_string(buf, 6);
-        counterPartyAccountId = codec::read_fixed_string(buf, 10);
-        counterPartyBranchId = codec::read_fixed_string(buf, 2);
-        applExtend = TradeCaptureReportAckMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        execId = codec::read_fixed_string<16>(buf);
+        side = codec::read_fixed_string<1>(buf);
+        pbuid = codec::read_fixed_string<6>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        counterPartyAccountId = codec::read_fixed_string<10>(buf);
+        counterPartyBranchId = codec::read_fixed_string<2>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("031"):
+                applExtend.emplace<TradeCaptureReportAckExtend031>().decode(buf);
+                break;
+            case codec::pack_key("051"):
+                applExtend.emplace<TradeCaptureReportAckExtend051>().decode(buf);
+                break;
+            case codec::pack_key("060"):
+                applExtend.emplace<TradeCaptureReportAckExtend060>().decode(buf);
+                break;
+            case codec::pack_key("061"):
+                applExtend.emplace<TradeCaptureReportAckExtend061>().decode(buf);
+                break;
+            case codec::pack_key("062"):
+                applExtend.emplace<TradeCaptureReportAckExtend062>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::tradeId)) tradeId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::tradeReportId)) tradeReportId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::tradeReportType)) tradeReportType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeReportTransType)) tradeReportTransType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeHandlingInstr)) tradeHandlingInstr = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeReportRefId)) tradeReportRefId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::trdAckStatus)) trdAckStatus = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::trdRptStatus)) trdRptStatus = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeReportRejectReason)) tradeReportRejectReason = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::lastPx)) lastPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::lastQty)) lastQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::trdType)) trdType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::trdSubType)) trdSubType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::confirmId)) confirmId = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::execId)) execId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::pbuid)) pbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::counterPartyPbuid)) counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::counterPartyAccountId)) counterPartyAccountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::counterPartyBranchId)) counterPartyBranchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("031"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportAckExtend031>().decode(buf);
+                else TradeCaptureReportAckExtend031().decode(buf, codec::FieldMask<TradeCaptureReportAckExtend031::Field>());
+                break;
+            case codec::pack_key("051"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportAckExtend051>().decode(buf);
+                else TradeCaptureReportAckExtend051().decode(buf, codec::FieldMask<TradeCaptureReportAckExtend051::Field>());
+                break;
+            case codec::pack_key("060"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportAckExtend060>().decode(buf);
+                else TradeCaptureReportAckExtend060().decode(buf, codec::FieldMask<TradeCaptureReportAckExtend060::Field>());
+                break;
+            case codec::pack_key("061"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportAckExtend061>().decode(buf);
+                else TradeCaptureReportAckExtend061().decode(buf, codec::FieldMask<TradeCaptureReportAckExtend061::Field>());
+                break;
+            case codec::pack_key("062"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureReportAckExtend062>().decode(buf);
+                else TradeCaptureReportAckExtend062().decode(buf, codec::FieldMask<TradeCaptureReportAckExtend062::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 203
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureReportAck*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureReportAck)) return false;
+        const auto* checkType = static_cast<const TradeCaptureReportAck*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -3795,49 +7190,138 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureReportAck& p
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureReportAck: each accessor decodes one field in place from the
+// wire bytes. Covers the first 203 bytes, the part of the layout with fixed offsets.
+class TradeCaptureReportAckView {
+public:
+    static constexpr size_t kFixedSize = 203;
+
+    explicit TradeCaptureReportAckView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view tradeId() const { return codec::fixed_string_view(data_ + 83, 16); }
+    std::string_view tradeReportId() const { return codec::fixed_string_view(data_ + 99, 10); }
+    uint8_t tradeReportType() const { return DefaultByteOrder::load<uint8_t>(data_ + 109); }
+    uint8_t tradeReportTransType() const { return DefaultByteOrder::load<uint8_t>(data_ + 110); }
+    std::string_view tradeHandlingInstr() const { return codec::fixed_string_view(data_ + 111, 1); }
+    std::string_view tradeReportRefId() const { return codec::fixed_string_view(data_ + 112, 10); }
+    uint8_t trdAckStatus() const { return DefaultByteOrder::load<uint8_t>(data_ + 122); }
+    uint8_t trdRptStatus() const { return DefaultByteOrder::load<uint8_t>(data_ + 123); }
+    uint16_t tradeReportRejectReason() const { return LittleEndian::load<uint16_t>(data_ + 124); }
+    int64_t lastPx() const { return LittleEndian::load<int64_t>(data_ + 126); }
+    int64_t lastQty() const { return LittleEndian::load<int64_t>(data_ + 134); }
+    uint16_t trdType() const { return LittleEndian::load<uint16_t>(data_ + 142); }
+    uint16_t trdSubType() const { return LittleEndian::load<uint16_t>(data_ + 144); }
+    uint32_t confirmId() const { return LittleEndian::load<uint32_t>(data_ + 146); }
+    std::string_view execId() const { return codec::fixed_string_view(data_ + 150, 16); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 166, 1); }
+    std::string_view pbuid() const { return codec::fixed_string_view(data_ + 167, 6); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 173, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 183, 2); }
+    std::string_view counterPartyPbuid() const { return codec::fixed_string_view(data_ + 185, 6); }
+    std::string_view counterPartyAccountId() const { return codec::fixed_string_view(data_ + 191, 10); }
+    std::string_view counterPartyBranchId() const { return codec::fixed_string_view(data_ + 201, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 
 
 
 
 
-struct TradeCaptureConfirmExtend031 : public codec::BinaryCodec {
-    std::string memberId;
-    std::string traderCode;
-    std::string counterPartyMemberId;
-    std::string counterPartyTraderCode;
-    std::string settlType;
-    std::string settlPeriod;
-    std::string cashMargin;
-    std::string memo;
+struct TradeCaptureConfirmExtend031 final : public codec::BinaryCodec {
+    codec::FixedString<6> memberId;
+    codec::FixedString<5> traderCode;
+    codec::FixedString<6> counterPartyMemberId;
+    codec::FixedString<5> counterPartyTraderCode;
+    codec::FixedString<1> settlType;
+    codec::FixedString<1> settlPeriod;
+    codec::FixedString<1> cashMargin;
+    codec::FixedString<120> memo;
+
+    enum class Field : uint8_t {
+        memberId,
+        traderCode,
+        counterPartyMemberId,
+        counterPartyTraderCode,
+        settlType,
+        settlPeriod,
+        cashMargin,
+        memo,
+    };
+
+    static constexpr size_t kWireSize = 145;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, memberId, 6);
-        codec::write_fixed_string(buf, traderCode, 5);
-        codec::write_fixed_string(buf, counterPartyMemberId, 6);
-        codec::write_fixed_string(buf, counterPartyTraderCode, 5);
-        codec::write_fixed_string(buf, settlType, 1);
-        codec::write_fixed_string(buf, settlPeriod, 1);
-        codec::write_fixed_string(buf, cashMargin, 1);
-        codec::write_fixed_string(buf, memo, 120);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, memberId, 6);
+        codec::write_fixed_string(out, traderCode, 5);
+        codec::write_fixed_string(out, counterPartyMemberId, 6);
+        codec::write_fixed_string(out, counterPartyTraderCode, 5);
+        codec::write_fixed_string(out, settlType, 1);
+        codec::write_fixed_string(out, settlPeriod, 1);
+        codec::write_fixed_string(out, cashMargin, 1);
+        codec::write_fixed_string(out, memo, 120);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        memberId = codec::read_fixed_string<6>(buf);
+        traderCode = codec::read_fixed_string<5>(buf);
+        counterPartyMemberId = codec::read_fixed_string<6>(buf);
+        counterPartyTraderCode = codec::read_fixed_string<5>(buf);
+        settlType = codec::read_fixed_string<1>(buf);
+        settlPeriod = codec::read_fixed_string<1>(buf);
+        cashMargin = codec::read_fixed_string<1>(buf);
+        memo = codec::read_fixed_string<120>(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        memberId = codec::read_fixed_string(buf, 6);
-        traderCode = codec::read_fixed_string(buf, 5);
-        counterPartyMemberId = codec::read_fixed_string(buf, 6);
-        counterPartyTraderCode = codec::read_fixed_string(buf, 5);
-        settlType = codec::read_fixed_string(buf, 1);
-        settlPeriod = codec::read_fixed_string(buf, 1);
-        cashMargin = codec::read_fixed_string(buf, 1);
-        memo = codec::read_fixed_string(buf, 120);
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::memberId)) memberId = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::traderCode)) traderCode = codec::read_fixed_string<5>(buf);
+        else buf.skip_bytes(5);
+        if(mask.has(Field::counterPartyMemberId)) counterPartyMemberId = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::counterPartyTraderCode)) counterPartyTraderCode = codec::read_fixed_string<5>(buf);
+        else buf.skip_bytes(5);
+        if(mask.has(Field::settlType)) settlType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::settlPeriod)) settlPeriod = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::memo)) memo = codec::read_fixed_string<120>(buf);
+        else buf.skip_bytes(120);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureConfirmExtend031*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureConfirmExtend031)) return false;
+        const auto* checkType = static_cast<const TradeCaptureConfirmExtend031*>(&other);
         return memberId == checkType->memberId
                && traderCode == checkType->traderCode
                && counterPartyMemberId == checkType->counterPartyMemberId
@@ -3876,32 +7360,84 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureConfirmExten
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureConfirmExtend031: each accessor decodes one field in place from the
+// wire bytes. Covers the first 145 bytes, the part of the layout with fixed offsets.
+class TradeCaptureConfirmExtend031View {
+public:
+    static constexpr size_t kFixedSize = 145;
+
+    explicit TradeCaptureConfirmExtend031View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
 
-struct TradeCaptureConfirmExtend051 : public codec::BinaryCodec {
+    std::string_view memberId() const { return codec::fixed_string_view(data_ + 0, 6); }
+    std::string_view traderCode() const { return codec::fixed_string_view(data_ + 6, 5); }
+    std::string_view counterPartyMemberId() const { return codec::fixed_string_view(data_ + 11, 6); }
+    std::string_view counterPartyTraderCode() const { return codec::fixed_string_view(data_ + 17, 5); }
+    std::string_view settlType() const { return codec::fixed_string_view(data_ + 22, 1); }
+    std::string_view settlPeriod() const { return codec::fixed_string_view(data_ + 23, 1); }
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 24, 1); }
+    std::string_view memo() const { return codec::fixed_string_view(data_ + 25, 120); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct TradeCaptureConfirmExtend051 final : public codec::BinaryCodec {
     uint16_t expirationDays;
     uint8_t expirationType;
     uint32_t maturityDate;
-    std::string shareProperty;
+    codec::FixedString<2> shareProperty;
+
+    enum class Field : uint8_t {
+        expirationDays,
+        expirationType,
+        maturityDate,
+        shareProperty,
+    };
+
+    static constexpr size_t kWireSize = 9;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(expirationDays);
-        buf.write_u8(expirationType);
-        buf.write_u32_le(maturityDate);
-        codec::write_fixed_string(buf, shareProperty, 2);
+        auto out = buf.claim(kWireSize);
+        out.write_u16_le(expirationDays);
+        out.write_u8(expirationType);
+        out.write_u32_le(maturityDate);
+        codec::write_fixed_string(out, shareProperty, 2);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         expirationDays = buf.read_u16_le();
         expirationType = buf.read_u8();
         maturityDate = buf.read_u32_le();
-        shareProperty = codec::read_fixed_string(buf, 2);
+        shareProperty = codec::read_fixed_string<2>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::expirationDays)) expirationDays = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::expirationType)) expirationType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::maturityDate)) maturityDate = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::shareProperty)) shareProperty = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureConfirmExtend051*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureConfirmExtend051)) return false;
+        const auto* checkType = static_cast<const TradeCaptureConfirmExtend051*>(&other);
         return expirationDays == checkType->expirationDays
                && expirationType == checkType->expirationType
                && maturityDate == checkType->maturityDate
@@ -3928,21 +7464,50 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureConfirmExten
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureConfirmExtend051: each accessor decodes one field in place from the
+// wire bytes. Covers the first 9 bytes, the part of the layout with fixed offsets.
+class TradeCaptureConfirmExtend051View {
+public:
+    static constexpr size_t kFixedSize = 9;
+
+    explicit TradeCaptureConfirmExtend051View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t expirationDays() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint8_t expirationType() const { return DefaultByteOrder::load<uint8_t>(data_ + 2); }
+    uint32_t maturityDate() const { return LittleEndian::load<uint32_t>(data_ + 3); }
+    std::string_view shareProperty() const { return codec::fixed_string_view(data_ + 7, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct TradeCaptureConfirmExtend060 final : public codec::BinaryCodec {
 
-struct TradeCaptureConfirmExtend060 : public codec::BinaryCodec {
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureConfirmExtend060*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(TradeCaptureConfirmExtend060);
     }
     
     std::string toString() const override {
@@ -3959,20 +7524,30 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureConfirmExten
 }
 
 
-struct TradeCaptureConfirmExtend061 : public codec::BinaryCodec {
+struct TradeCaptureConfirmExtend061 final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureConfirmExtend061*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(TradeCaptureConfirmExtend061);
     }
     
     std::string toString() const override {
@@ -3989,22 +7564,41 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureConfirmExten
 }
 
 
-struct TradeCaptureConfirmExtend062 : public codec::BinaryCodec {
-    std::string cashMargin;
+struct TradeCaptureConfirmExtend062 final : public codec::BinaryCodec {
+    codec::FixedString<1> cashMargin;
+
+    enum class Field : uint8_t {
+        cashMargin,
+    };
+
+    static constexpr size_t kWireSize = 1;
 
     void encode(ByteBuf& buf) const override {
         codec::write_fixed_string(buf, cashMargin, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        cashMargin = codec::read_fixed_string(buf, 1);
+    void decode(ByteBufView& buf) override {
+        cashMargin = codec::read_fixed_string<1>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::cashMargin)) cashMargin = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureConfirmExtend062*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureConfirmExtend062)) return false;
+        const auto* checkType = static_cast<const TradeCaptureConfirmExtend062*>(&other);
         return cashMargin == checkType->cashMargin;
     }
     
@@ -4022,120 +7616,316 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureConfirmExten
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureConfirmExtend062: each accessor decodes one field in place from the
+// wire bytes. Covers the first 1 bytes, the part of the layout with fixed offsets.
+class TradeCaptureConfirmExtend062View {
+public:
+    static constexpr size_t kFixedSize = 1;
+
+    explicit TradeCaptureConfirmExtend062View(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view cashMargin() const { return codec::fixed_string_view(data_ + 0, 1); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct TradeCaptureConfirmTag{};
 using TradeCaptureConfirmMessageFactory = MessageFactory<std::string, codec::BinaryCodec, TradeCaptureConfirmTag>;
-REGISTER_MESSAGE(TradeCaptureConfirmMessageFactory, "031", TradeCaptureConfirmExtend031);
-REGISTER_MESSAGE(TradeCaptureConfirmMessageFactory, "051", TradeCaptureConfirmExtend051);
-REGISTER_MESSAGE(TradeCaptureConfirmMessageFactory, "060", TradeCaptureConfirmExtend060);
-REGISTER_MESSAGE(TradeCaptureConfirmMessageFactory, "061", TradeCaptureConfirmExtend061);
-REGISTER_MESSAGE(TradeCaptureConfirmMessageFactory, "062", TradeCaptureConfirmExtend062);
+template <>
+struct GeneratedMessages<TradeCaptureConfirmTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(const std::string& applId) {
+        if(applId.size() != 3) return nullptr;
+        switch(codec::pack_key(codec::FixedString<3>(applId))) {
+            case codec::pack_key("031"):
+                return std::make_unique<TradeCaptureConfirmExtend031>();
+            case codec::pack_key("051"):
+                return std::make_unique<TradeCaptureConfirmExtend051>();
+            case codec::pack_key("060"):
+                return std::make_unique<TradeCaptureConfirmExtend060>();
+            case codec::pack_key("061"):
+                return std::make_unique<TradeCaptureConfirmExtend061>();
+            case codec::pack_key("062"):
+                return std::make_unique<TradeCaptureConfirmExtend062>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using TradeCaptureConfirmApplExtend = codec::InlineMessage<TradeCaptureConfirmExtend031, TradeCaptureConfirmExtend051, TradeCaptureConfirmExtend060, TradeCaptureConfirmExtend061, TradeCaptureConfirmExtend062>;
 
 
-struct TradeCaptureConfirm : public codec::BinaryCodec {
+struct TradeCaptureConfirm final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
-    std::string applId;
-    std::string reportingPbuid;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<3> applId;
+    codec::FixedString<6> reportingPbuid;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     uint16_t ownerType;
-    std::string clearingFirm;
+    codec::FixedString<2> clearingFirm;
     int64_t transactTime;
-    std::string userInfo;
-    std::string tradeId;
-    std::string tradeReportId;
+    codec::FixedString<32> userInfo;
+    codec::FixedString<16> tradeId;
+    codec::FixedString<10> tradeReportId;
     uint8_t tradeReportType;
     uint8_t tradeReportTransType;
-    std::string tradeHandlingInstr;
+    codec::FixedString<1> tradeHandlingInstr;
     int64_t lastPx;
     int64_t lastQty;
     uint16_t trdType;
     uint16_t trdSubType;
     uint32_t confirmId;
-    std::string execId;
-    std::string side;
-    std::string pbuid;
-    std::string accountId;
-    std::string branchId;
-    std::string counterPartyPbuid;
-    std::string counterPartyAccountId;
-    std::string counterPartyBranchId;
-    std::unique_ptr<codec::BinaryCodec> applExtend;
+    codec::FixedString<16> execId;
+    codec::FixedString<1> side;
+    codec::FixedString<6> pbuid;
+    codec::FixedString<10> accountId;
+    codec::FixedString<2> branchId;
+    codec::FixedString<6> counterPartyPbuid;
+    codec::FixedString<10> counterPartyAccountId;
+    codec::FixedString<2> counterPartyBranchId;
+    TradeCaptureConfirmApplExtend applExtend;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        applId,
+        reportingPbuid,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        ownerType,
+        clearingFirm,
+        transactTime,
+        userInfo,
+        tradeId,
+        tradeReportId,
+        tradeReportType,
+        tradeReportTransType,
+        tradeHandlingInstr,
+        lastPx,
+        lastQty,
+        trdType,
+        trdSubType,
+        confirmId,
+        execId,
+        side,
+        pbuid,
+        accountId,
+        branchId,
+        counterPartyPbuid,
+        counterPartyAccountId,
+        counterPartyBranchId,
+        applExtend,
+    };
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        codec::write_fixed_string(buf, applId, 3);
-        codec::write_fixed_string(buf, reportingPbuid, 6);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_u16_le(ownerType);
-        codec::write_fixed_string(buf, clearingFirm, 2);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-        codec::write_fixed_string(buf, tradeId, 16);
-        codec::write_fixed_string(buf, tradeReportId, 10);
-        buf.write_u8(tradeReportType);
-        buf.write_u8(tradeReportTransType);
-        codec::write_fixed_string(buf, tradeHandlingInstr, 1);
-        buf.write_i64_le(lastPx);
-        buf.write_i64_le(lastQty);
-        buf.write_u16_le(trdType);
-        buf.write_u16_le(trdSubType);
-        buf.write_u32_le(confirmId);
-        codec::write_fixed_string(buf, execId, 16);
-        codec::write_fixed_string(buf, side, 1);
-        codec::write_fixed_string(buf, pbuid, 6);
-        codec::write_fixed_string(buf, accountId, 10);
-        codec::write_fixed_string(buf, branchId, 2);
-        codec::write_fixed_string(buf, counterPartyPbuid, 6);
-        codec::write_fixed_string(buf, counterPartyAccountId, 10);
-        codec::write_fixed_string(buf, counterPartyBranchId, 2);
+        auto out = buf.claim(189);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        codec::write_fixed_string(out, applId, 3);
+        codec::write_fixed_string(out, reportingPbuid, 6);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_u16_le(ownerType);
+        codec::write_fixed_string(out, clearingFirm, 2);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+        codec::write_fixed_string(out, tradeId, 16);
+        codec::write_fixed_string(out, tradeReportId, 10);
+        out.write_u8(tradeReportType);
+        out.write_u8(tradeReportTransType);
+        codec::write_fixed_string(out, tradeHandlingInstr, 1);
+        out.write_i64_le(lastPx);
+        out.write_i64_le(lastQty);
+        out.write_u16_le(trdType);
+        out.write_u16_le(trdSubType);
+        out.write_u32_le(confirmId);
+        codec::write_fixed_string(out, execId, 16);
+        codec::write_fixed_string(out, side, 1);
+        codec::write_fixed_string(out, pbuid, 6);
+        codec::write_fixed_string(out, accountId, 10);
+        codec::write_fixed_string(out, branchId, 2);
+        codec::write_fixed_string(out, counterPartyPbuid, 6);
+        codec::write_fixed_string(out, counterPartyAccountId, 10);
+        codec::write_fixed_string(out, counterPartyBranchId, 2);
         applExtend->encode(buf);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but an applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
-        applId = codec::read_fixed_string(buf, 3);
-        reportingPbuid = codec::read_fixed_string(buf, 6);
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        applId = codec::read_fixed_string<3>(buf);
+        reportingPbuid = codec::read_fixed_string<6>(buf);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         ownerType = buf.read_u16_le();
-        clearingFirm = codec::read_fixed_string(buf, 2);
+        clearingFirm = codec::read_fixed_string<2>(buf);
         transactTime = buf.read_i64_le();
-        userInfo = codec::read_fixed_string(buf, 32);
-        tradeId = codec::read_fixed_string(buf, 16);
-        tradeReportId = codec::read_fixed_string(buf, 10);
+        userInfo = codec::read_fixed_string<32>(buf);
+        tradeId = codec::read_fixed_string<16>(buf);
+        tradeReportId = codec::read_fixed_string<10>(buf);
         tradeReportType = buf.read_u8();
         tradeReportTransType = buf.read_u8();
-        tradeHandlingInstr = codec::read_fixed_string(buf, 1);
+        tradeHandlingInstr = codec::read_fixed_string<1>(buf);
         lastPx = buf.read_i64_le();
         lastQty = buf.read_i64_le();
         trdType = buf.read_u16_le();
         trdSubType = buf.read_u16_le();
         confirmId = buf.read_u32_le();
-        execId = codec::read_fixed_string(buf, 16);
-        side = codec::read_fixed_string(buf, 1);
-        pbuid = codec::read_fixed_string(buf, 6);
-        accountId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 2);
-        counterPartyPbuid = codec::read_fixed_string(buf, 6);
-        counterPartyAccountId = codec::read_fixed_string(buf, 10);
-        counterPartyBranchId = codec::read_fixed_string(buf, 2);
-        applExtend = TradeCaptureConfirmMessageFactory::getInstance().create(applId);
-        applExtend->decode(buf);
+        execId = codec::read_fixed_string<16>(buf);
+        side = codec::read_fixed_string<1>(buf);
+        pbuid = codec::read_fixed_string<6>(buf);
+        accountId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<2>(buf);
+        counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        counterPartyAccountId = codec::read_fixed_string<10>(buf);
+        counterPartyBranchId = codec::read_fixed_string<2>(buf);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("031"):
+                applExtend.emplace<TradeCaptureConfirmExtend031>().decode(buf);
+                break;
+            case codec::pack_key("051"):
+                applExtend.emplace<TradeCaptureConfirmExtend051>().decode(buf);
+                break;
+            case codec::pack_key("060"):
+                applExtend.emplace<TradeCaptureConfirmExtend060>().decode(buf);
+                break;
+            case codec::pack_key("061"):
+                applExtend.emplace<TradeCaptureConfirmExtend061>().decode(buf);
+                break;
+            case codec::pack_key("062"):
+                applExtend.emplace<TradeCaptureConfirmExtend062>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped. applId is always
+    // decoded because it selects the applExtend layout.
+    // An applId without an applExtend layout returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        applId = codec::read_fixed_string<3>(buf);
+        if(mask.has(Field::reportingPbuid)) reportingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::tradeId)) tradeId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::tradeReportId)) tradeReportId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::tradeReportType)) tradeReportType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeReportTransType)) tradeReportTransType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradeHandlingInstr)) tradeHandlingInstr = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::lastPx)) lastPx = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::lastQty)) lastQty = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::trdType)) trdType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::trdSubType)) trdSubType = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::confirmId)) confirmId = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::execId)) execId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::pbuid)) pbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::accountId)) accountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::counterPartyPbuid)) counterPartyPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::counterPartyAccountId)) counterPartyAccountId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::counterPartyBranchId)) counterPartyBranchId = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        switch(codec::pack_key(applId)) {
+            case codec::pack_key("031"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureConfirmExtend031>().decode(buf);
+                else TradeCaptureConfirmExtend031().decode(buf, codec::FieldMask<TradeCaptureConfirmExtend031::Field>());
+                break;
+            case codec::pack_key("051"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureConfirmExtend051>().decode(buf);
+                else TradeCaptureConfirmExtend051().decode(buf, codec::FieldMask<TradeCaptureConfirmExtend051::Field>());
+                break;
+            case codec::pack_key("060"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureConfirmExtend060>().decode(buf);
+                else TradeCaptureConfirmExtend060().decode(buf, codec::FieldMask<TradeCaptureConfirmExtend060::Field>());
+                break;
+            case codec::pack_key("061"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureConfirmExtend061>().decode(buf);
+                else TradeCaptureConfirmExtend061().decode(buf, codec::FieldMask<TradeCaptureConfirmExtend061::Field>());
+                break;
+            case codec::pack_key("062"):
+                if(mask.has(Field::applExtend)) applExtend.emplace<TradeCaptureConfirmExtend062>().decode(buf);
+                else TradeCaptureConfirmExtend062().decode(buf, codec::FieldMask<TradeCaptureConfirmExtend062::Field>());
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    // Like tryDecode(buf, mask), but an unknown applId throws.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(!tryDecode(buf, mask)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 189
+               + applExtend->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradeCaptureConfirm*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradeCaptureConfirm)) return false;
+        const auto* checkType = static_cast<const TradeCaptureConfirm*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && applId == checkType->applId
@@ -4240,55 +8030,146 @@ inline std::ostream& operator<<(std::ostream& os, const TradeCaptureConfirm& pkt
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradeCaptureConfirm: each accessor decodes one field in place from the
+// wire bytes. Covers the first 189 bytes, the part of the layout with fixed offsets.
+class TradeCaptureConfirmView {
+public:
+    static constexpr size_t kFixedSize = 189;
+
+    explicit TradeCaptureConfirmView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 12, 3); }
+    std::string_view reportingPbuid() const { return codec::fixed_string_view(data_ + 15, 6); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 21, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 27, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 35, 4); }
+    uint16_t ownerType() const { return LittleEndian::load<uint16_t>(data_ + 39); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 41, 2); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 43); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 51, 32); }
+    std::string_view tradeId() const { return codec::fixed_string_view(data_ + 83, 16); }
+    std::string_view tradeReportId() const { return codec::fixed_string_view(data_ + 99, 10); }
+    uint8_t tradeReportType() const { return DefaultByteOrder::load<uint8_t>(data_ + 109); }
+    uint8_t tradeReportTransType() const { return DefaultByteOrder::load<uint8_t>(data_ + 110); }
+    std::string_view tradeHandlingInstr() const { return codec::fixed_string_view(data_ + 111, 1); }
+    int64_t lastPx() const { return LittleEndian::load<int64_t>(data_ + 112); }
+    int64_t lastQty() const { return LittleEndian::load<int64_t>(data_ + 120); }
+    uint16_t trdType() const { return LittleEndian::load<uint16_t>(data_ + 128); }
+    uint16_t trdSubType() const { return LittleEndian::load<uint16_t>(data_ + 130); }
+    uint32_t confirmId() const { return LittleEndian::load<uint32_t>(data_ + 132); }
+    std::string_view execId() const { return codec::fixed_string_view(data_ + 136, 16); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 152, 1); }
+    std::string_view pbuid() const { return codec::fixed_string_view(data_ + 153, 6); }
+    std::string_view accountId() const { return codec::fixed_string_view(data_ + 159, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 169, 2); }
+    std::string_view counterPartyPbuid() const { return codec::fixed_string_view(data_ + 171, 6); }
+    std::string_view counterPartyAccountId() const { return codec::fixed_string_view(data_ + 177, 10); }
+    std::string_view counterPartyBranchId() const { return codec::fixed_string_view(data_ + 187, 2); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 
 
 
 
 
-struct BusinessReject : public codec::BinaryCodec {
-    std::string applId;
+struct BusinessReject final : public codec::BinaryCodec {
+    codec::FixedString<3> applId;
     int64_t transactTime;
-    std::string submittingPbuid;
-    std::string securityId;
-    std::string securityIdsource;
+    codec::FixedString<6> submittingPbuid;
+    codec::FixedString<8> securityId;
+    codec::FixedString<4> securityIdsource;
     int64_t refSeqNum;
     uint32_t refMsgType;
-    std::string businessRejectRefId;
+    codec::FixedString<10> businessRejectRefId;
     uint16_t businessRejectReason;
-    std::string businessRejectText;
+    codec::FixedString<50> businessRejectText;
+
+    enum class Field : uint8_t {
+        applId,
+        transactTime,
+        submittingPbuid,
+        securityId,
+        securityIdsource,
+        refSeqNum,
+        refMsgType,
+        businessRejectRefId,
+        businessRejectReason,
+        businessRejectText,
+    };
+
+    static constexpr size_t kWireSize = 103;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, applId, 3);
-        buf.write_i64_le(transactTime);
-        codec::write_fixed_string(buf, submittingPbuid, 6);
-        codec::write_fixed_string(buf, securityId, 8);
-        codec::write_fixed_string(buf, securityIdsource, 4);
-        buf.write_i64_le(refSeqNum);
-        buf.write_u32_le(refMsgType);
-        codec::write_fixed_string(buf, businessRejectRefId, 10);
-        buf.write_u16_le(businessRejectReason);
-        codec::write_fixed_string(buf, businessRejectText, 50);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
-        applId = codec::read_fixed_string(buf, 3);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, applId, 3);
+        out.write_i64_le(transactTime);
+        codec::write_fixed_string(out, submittingPbuid, 6);
+        codec::write_fixed_string(out, securityId, 8);
+        codec::write_fixed_string(out, securityIdsource, 4);
+        out.write_i64_le(refSeqNum);
+        out.write_u32_le(refMsgType);
+        codec::write_fixed_string(out, businessRejectRefId, 10);
+        out.write_u16_le(businessRejectReason);
+        codec::write_fixed_string(out, businessRejectText, 50);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        applId = codec::read_fixed_string<3>(buf);
         transactTime = buf.read_i64_le();
-        submittingPbuid = codec::read_fixed_string(buf, 6);
-        securityId = codec::read_fixed_string(buf, 8);
-        securityIdsource = codec::read_fixed_string(buf, 4);
+        submittingPbuid = codec::read_fixed_string<6>(buf);
+        securityId = codec::read_fixed_string<8>(buf);
+        securityIdsource = codec::read_fixed_string<4>(buf);
         refSeqNum = buf.read_i64_le();
         refMsgType = buf.read_u32_le();
-        businessRejectRefId = codec::read_fixed_string(buf, 10);
+        businessRejectRefId = codec::read_fixed_string<10>(buf);
         businessRejectReason = buf.read_u16_le();
-        businessRejectText = codec::read_fixed_string(buf, 50);
+        businessRejectText = codec::read_fixed_string<50>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::applId)) applId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::submittingPbuid)) submittingPbuid = codec::read_fixed_string<6>(buf);
+        else buf.skip_bytes(6);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::securityIdsource)) securityIdsource = codec::read_fixed_string<4>(buf);
+        else buf.skip_bytes(4);
+        if(mask.has(Field::refSeqNum)) refSeqNum = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::refMsgType)) refMsgType = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::businessRejectRefId)) businessRejectRefId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::businessRejectReason)) businessRejectReason = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::businessRejectText)) businessRejectText = codec::read_fixed_string<50>(buf);
+        else buf.skip_bytes(50);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const BusinessReject*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(BusinessReject)) return false;
+        const auto* checkType = static_cast<const BusinessReject*>(&other);
         return applId == checkType->applId
                && transactTime == checkType->transactTime
                && submittingPbuid == checkType->submittingPbuid
@@ -4333,26 +8214,74 @@ inline std::ostream& operator<<(std::ostream& os, const BusinessReject& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded BusinessReject: each accessor decodes one field in place from the
+// wire bytes. Covers the first 103 bytes, the part of the layout with fixed offsets.
+class BusinessRejectView {
+public:
+    static constexpr size_t kFixedSize = 103;
+
+    explicit BusinessRejectView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view applId() const { return codec::fixed_string_view(data_ + 0, 3); }
+    int64_t transactTime() const { return LittleEndian::load<int64_t>(data_ + 3); }
+    std::string_view submittingPbuid() const { return codec::fixed_string_view(data_ + 11, 6); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 17, 8); }
+    std::string_view securityIdsource() const { return codec::fixed_string_view(data_ + 25, 4); }
+    int64_t refSeqNum() const { return LittleEndian::load<int64_t>(data_ + 29); }
+    uint32_t refMsgType() const { return LittleEndian::load<uint32_t>(data_ + 37); }
+    std::string_view businessRejectRefId() const { return codec::fixed_string_view(data_ + 41, 10); }
+    uint16_t businessRejectReason() const { return LittleEndian::load<uint16_t>(data_ + 51); }
+    std::string_view businessRejectText() const { return codec::fixed_string_view(data_ + 53, 50); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct ReportPartitionSync : public codec::BinaryCodec {
+struct ReportPartitionSync final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
 
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+    };
+
+    static constexpr size_t kWireSize = 12;
+
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
+        auto out = buf.claim(kWireSize);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ReportPartitionSync*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ReportPartitionSync)) return false;
+        const auto* checkType = static_cast<const ReportPartitionSync*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex;
     }
@@ -4373,23 +8302,57 @@ inline std::ostream& operator<<(std::ostream& os, const ReportPartitionSync& pkt
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ReportPartitionSync: each accessor decodes one field in place from the
+// wire bytes. Covers the first 12 bytes, the part of the layout with fixed offsets.
+class ReportPartitionSyncView {
+public:
+    static constexpr size_t kFixedSize = 12;
+
+    explicit ReportPartitionSyncView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct ReportSynchronization : public codec::BinaryCodec {
-    std::vector<ReportPartitionSync> reportPartitionSync;
+struct ReportSynchronization final : public codec::BinaryCodec {
+    codec::List<ReportPartitionSync> reportPartitionSync;
+
+    enum class Field : uint8_t {
+        reportPartitionSync,
+    };
 
     void encode(ByteBuf& buf) const override {
         codec::write_object_List_le<uint16_t>(buf,reportPartitionSync);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        reportPartitionSync = codec::read_object_List_le<uint16_t,ReportPartitionSync>(buf);
+    void decode(ByteBufView& buf) override {
+        reportPartitionSync = codec::read_object_List_le<uint16_t,ReportPartitionSync,codec::List<ReportPartitionSync>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::reportPartitionSync)) reportPartitionSync = codec::read_object_List_le<uint16_t,ReportPartitionSync,codec::List<ReportPartitionSync>>(buf);
+        else codec::skip_object_List_le<uint16_t,ReportPartitionSync>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return codec::object_list_size<uint16_t>(reportPartitionSync);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ReportSynchronization*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ReportSynchronization)) return false;
+        const auto* checkType = static_cast<const ReportSynchronization*>(&other);
         return reportPartitionSync == checkType->reportPartitionSync;
     }
     
@@ -4408,37 +8371,72 @@ inline std::ostream& operator<<(std::ostream& os, const ReportSynchronization& p
 }
 
 
-struct TradingSessionStatus : public codec::BinaryCodec {
-    std::string marketId;
-    std::string marketSegmentId;
-    std::string tradingSessionId;
-    std::string tradingSessionSubId;
+struct TradingSessionStatus final : public codec::BinaryCodec {
+    codec::FixedString<3> marketId;
+    codec::FixedString<3> marketSegmentId;
+    codec::FixedString<3> tradingSessionId;
+    codec::FixedString<3> tradingSessionSubId;
     uint8_t tradSesStatus;
     int64_t tradSesStartTime;
 
+    enum class Field : uint8_t {
+        marketId,
+        marketSegmentId,
+        tradingSessionId,
+        tradingSessionSubId,
+        tradSesStatus,
+        tradSesStartTime,
+    };
+
+    static constexpr size_t kWireSize = 21;
+
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, marketId, 3);
-        codec::write_fixed_string(buf, marketSegmentId, 3);
-        codec::write_fixed_string(buf, tradingSessionId, 3);
-        codec::write_fixed_string(buf, tradingSessionSubId, 3);
-        buf.write_u8(tradSesStatus);
-        buf.write_i64_le(tradSesStartTime);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, marketId, 3);
+        codec::write_fixed_string(out, marketSegmentId, 3);
+        codec::write_fixed_string(out, tradingSessionId, 3);
+        codec::write_fixed_string(out, tradingSessionSubId, 3);
+        out.write_u8(tradSesStatus);
+        out.write_i64_le(tradSesStartTime);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        marketId = codec::read_fixed_string(buf, 3);
-        marketSegmentId = codec::read_fixed_string(buf, 3);
-        tradingSessionId = codec::read_fixed_string(buf, 3);
-        tradingSessionSubId = codec::read_fixed_string(buf, 3);
+    void decode(ByteBufView& buf) override {
+        marketId = codec::read_fixed_string<3>(buf);
+        marketSegmentId = codec::read_fixed_string<3>(buf);
+        tradingSessionId = codec::read_fixed_string<3>(buf);
+        tradingSessionSubId = codec::read_fixed_string<3>(buf);
         tradSesStatus = buf.read_u8();
         tradSesStartTime = buf.read_i64_le();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::marketId)) marketId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::marketSegmentId)) marketSegmentId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::tradingSessionId)) tradingSessionId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::tradingSessionSubId)) tradingSessionSubId = codec::read_fixed_string<3>(buf);
+        else buf.skip_bytes(3);
+        if(mask.has(Field::tradSesStatus)) tradSesStatus = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::tradSesStartTime)) tradSesStartTime = buf.read_i64_le();
+        else buf.skip_bytes(8);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const TradingSessionStatus*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(TradingSessionStatus)) return false;
+        const auto* checkType = static_cast<const TradingSessionStatus*>(&other);
         return marketId == checkType->marketId
                && marketSegmentId == checkType->marketSegmentId
                && tradingSessionId == checkType->tradingSessionId
@@ -4471,26 +8469,70 @@ inline std::ostream& operator<<(std::ostream& os, const TradingSessionStatus& pk
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded TradingSessionStatus: each accessor decodes one field in place from the
+// wire bytes. Covers the first 21 bytes, the part of the layout with fixed offsets.
+class TradingSessionStatusView {
+public:
+    static constexpr size_t kFixedSize = 21;
+
+    explicit TradingSessionStatusView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
 
-struct PlatformStateInfo : public codec::BinaryCodec {
+    std::string_view marketId() const { return codec::fixed_string_view(data_ + 0, 3); }
+    std::string_view marketSegmentId() const { return codec::fixed_string_view(data_ + 3, 3); }
+    std::string_view tradingSessionId() const { return codec::fixed_string_view(data_ + 6, 3); }
+    std::string_view tradingSessionSubId() const { return codec::fixed_string_view(data_ + 9, 3); }
+    uint8_t tradSesStatus() const { return DefaultByteOrder::load<uint8_t>(data_ + 12); }
+    int64_t tradSesStartTime() const { return LittleEndian::load<int64_t>(data_ + 13); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct PlatformStateInfo final : public codec::BinaryCodec {
     uint16_t platformId;
     uint16_t platformState;
 
+    enum class Field : uint8_t {
+        platformId,
+        platformState,
+    };
+
+    static constexpr size_t kWireSize = 4;
+
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(platformId);
-        buf.write_u16_le(platformState);
+        auto out = buf.claim(kWireSize);
+        out.write_u16_le(platformId);
+        out.write_u16_le(platformState);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         platformId = buf.read_u16_le();
         platformState = buf.read_u16_le();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::platformId)) platformId = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::platformState)) platformState = buf.read_u16_le();
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const PlatformStateInfo*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(PlatformStateInfo)) return false;
+        const auto* checkType = static_cast<const PlatformStateInfo*>(&other);
         return platformId == checkType->platformId
                && platformState == checkType->platformState;
     }
@@ -4511,29 +8553,78 @@ inline std::ostream& operator<<(std::ostream& os, const PlatformStateInfo& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded PlatformStateInfo: each accessor decodes one field in place from the
+// wire bytes. Covers the first 4 bytes, the part of the layout with fixed offsets.
+class PlatformStateInfoView {
+public:
+    static constexpr size_t kFixedSize = 4;
+
+    explicit PlatformStateInfoView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t platformId() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint16_t platformState() const { return LittleEndian::load<uint16_t>(data_ + 2); }
 
-struct ReportFinished : public codec::BinaryCodec {
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a PlatformStateInfo.
+struct PlatformStateInfoWire {
+    static void setPlatformId(codec::FramePatcher& frame, uint16_t platformId) { frame.put<LittleEndian>(frame.spec().headerSize + 0, platformId); }
+    static void setPlatformState(codec::FramePatcher& frame, uint16_t platformState) { frame.put<LittleEndian>(frame.spec().headerSize + 2, platformState); }
+};
+
+
+struct ReportFinished final : public codec::BinaryCodec {
     int32_t partitionNo;
     int64_t reportIndex;
     uint16_t platformId;
 
+    enum class Field : uint8_t {
+        partitionNo,
+        reportIndex,
+        platformId,
+    };
+
+    static constexpr size_t kWireSize = 14;
+
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        buf.write_i64_le(reportIndex);
-        buf.write_u16_le(platformId);
+        auto out = buf.claim(kWireSize);
+        out.write_i32_le(partitionNo);
+        out.write_i64_le(reportIndex);
+        out.write_u16_le(platformId);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         partitionNo = buf.read_i32_le();
         reportIndex = buf.read_i64_le();
         platformId = buf.read_u16_le();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::platformId)) platformId = buf.read_u16_le();
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ReportFinished*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ReportFinished)) return false;
+        const auto* checkType = static_cast<const ReportFinished*>(&other);
         return partitionNo == checkType->partitionNo
                && reportIndex == checkType->reportIndex
                && platformId == checkType->platformId;
@@ -4557,26 +8648,74 @@ inline std::ostream& operator<<(std::ostream& os, const ReportFinished& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ReportFinished: each accessor decodes one field in place from the
+// wire bytes. Covers the first 14 bytes, the part of the layout with fixed offsets.
+class ReportFinishedView {
+public:
+    static constexpr size_t kFixedSize = 14;
+
+    explicit ReportFinishedView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    int64_t reportIndex() const { return LittleEndian::load<int64_t>(data_ + 4); }
+    uint16_t platformId() const { return LittleEndian::load<uint16_t>(data_ + 12); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded BjseBinary frame carrying a ReportFinished.
+struct ReportFinishedWire {
+    static void setPartitionNo(codec::FramePatcher& frame, int32_t partitionNo) { frame.put<LittleEndian>(frame.spec().headerSize + 0, partitionNo); }
+    static void setReportIndex(codec::FramePatcher& frame, int64_t reportIndex) { frame.put<LittleEndian>(frame.spec().headerSize + 4, reportIndex); }
+    static void setPlatformId(codec::FramePatcher& frame, uint16_t platformId) { frame.put<LittleEndian>(frame.spec().headerSize + 12, platformId); }
+};
+
 
-struct NoPartitions : public codec::BinaryCodec {
+struct NoPartitions final : public codec::BinaryCodec {
     int32_t partitionNo;
-    std::string partitionName;
+    codec::FixedString<20> partitionName;
+
+    enum class Field : uint8_t {
+        partitionNo,
+        partitionName,
+    };
+
+    static constexpr size_t kWireSize = 24;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i32_le(partitionNo);
-        codec::write_fixed_string(buf, partitionName, 20);
+        auto out = buf.claim(kWireSize);
+        out.write_i32_le(partitionNo);
+        codec::write_fixed_string(out, partitionName, 20);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         partitionNo = buf.read_i32_le();
-        partitionName = codec::read_fixed_string(buf, 20);
+        partitionName = codec::read_fixed_string<20>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::partitionNo)) partitionNo = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::partitionName)) partitionName = codec::read_fixed_string<20>(buf);
+        else buf.skip_bytes(20);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const NoPartitions*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(NoPartitions)) return false;
+        const auto* checkType = static_cast<const NoPartitions*>(&other);
         return partitionNo == checkType->partitionNo
                && partitionName == checkType->partitionName;
     }
@@ -4597,10 +8736,32 @@ inline std::ostream& operator<<(std::ostream& os, const NoPartitions& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded NoPartitions: each accessor decodes one field in place from the
+// wire bytes. Covers the first 24 bytes, the part of the layout with fixed offsets.
+class NoPartitionsView {
+public:
+    static constexpr size_t kFixedSize = 24;
+
+    explicit NoPartitionsView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
 
-struct PlatformInfo : public codec::BinaryCodec {
+    int32_t partitionNo() const { return LittleEndian::load<int32_t>(data_ + 0); }
+    std::string_view partitionName() const { return codec::fixed_string_view(data_ + 4, 20); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct PlatformInfo final : public codec::BinaryCodec {
     uint16_t platformId;
-    std::vector<NoPartitions> noPartitions;
+    codec::List<NoPartitions> noPartitions;
+
+    enum class Field : uint8_t {
+        platformId,
+        noPartitions,
+    };
 
     void encode(ByteBuf& buf) const override {
         buf.write_u16_le(platformId);
@@ -4608,15 +8769,31 @@ struct PlatformInfo : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         platformId = buf.read_u16_le();
-        noPartitions = codec::read_object_List_le<uint16_t,NoPartitions>(buf);
+        noPartitions = codec::read_object_List_le<uint16_t,NoPartitions,codec::List<NoPartitions>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::platformId)) platformId = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::noPartitions)) noPartitions = codec::read_object_List_le<uint16_t,NoPartitions,codec::List<NoPartitions>>(buf);
+        else codec::skip_object_List_le<uint16_t,NoPartitions>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 2
+               + codec::object_list_size<uint16_t>(noPartitions);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const PlatformInfo*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(PlatformInfo)) return false;
+        const auto* checkType = static_cast<const PlatformInfo*>(&other);
         return platformId == checkType->platformId
                && noPartitions == checkType->noPartitions;
     }
@@ -4637,26 +8814,68 @@ inline std::ostream& operator<<(std::ostream& os, const PlatformInfo& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded PlatformInfo: each accessor decodes one field in place from the
+// wire bytes. Covers the first 2 bytes, the part of the layout with fixed offsets.
+class PlatformInfoView {
+public:
+    static constexpr size_t kFixedSize = 2;
+
+    explicit PlatformInfoView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t platformId() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 struct BjseBinaryTag{};
 using BjseBinaryMessageFactory = MessageFactory<uint32_t, codec::BinaryCodec, BjseBinaryTag>;
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 1, Logon);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 2, Logout);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 3, Heartbeat);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 101000, NewOrder);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 102000, OrderCancelRequest);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 201000, CancelReject);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 202010, ExecutionConfirm);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 203010, ExecutionReport);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 5, ReportSynchronization);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 6, PlatformStateInfo);
-REGISTER_MESSAGE(BjseBinaryMessageFactory, 7, ReportFinished);
-
-
-struct BjseBinary : public codec::BinaryCodec {
+template <>
+struct GeneratedMessages<BjseBinaryTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(uint32_t key) {
+        switch(key) {
+            case 1:
+                return std::make_unique<Logon>();
+            case 2:
+                return std::make_unique<Logout>();
+            case 3:
+                return std::make_unique<Heartbeat>();
+            case 101000:
+                return std::make_unique<NewOrder>();
+            case 102000:
+                return std::make_unique<OrderCancelRequest>();
+            case 201000:
+                return std::make_unique<CancelReject>();
+            case 202010:
+                return std::make_unique<ExecutionConfirm>();
+            case 203010:
+                return std::make_unique<ExecutionReport>();
+            case 5:
+                return std::make_unique<ReportSynchronization>();
+            case 6:
+                return std::make_unique<PlatformStateInfo>();
+            case 7:
+                return std::make_unique<ReportFinished>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using BjseBinaryBody = codec::InlineMessage<Logon, Logout, Heartbeat, NewOrder, OrderCancelRequest, CancelReject, ExecutionConfirm, ExecutionReport, ReportSynchronization, PlatformStateInfo, ReportFinished>;
+
+
+// Header/length/trailer layout of a BjseBinary frame, for codec::StreamFramer.
+inline constexpr codec::FrameSpec BjseBinaryFrameSpec{8, 4, 4};
+
+struct BjseBinary final : public codec::BinaryCodec {
     uint32_t msgType;
     uint32_t bodyLength;
-    std::unique_ptr<codec::BinaryCodec> body;
+    BjseBinaryBody body;
     uint32_t checksum;
 
     void encode(ByteBuf& buf) const override {
@@ -4667,18 +8886,66 @@ struct BjseBinary : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but a msgType without a body returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         msgType = buf.read_u32_le();
         bodyLength = buf.read_u32_le();
-        body = BjseBinaryMessageFactory::getInstance().create(msgType);
-        body->decode(buf);
+        switch(msgType) {
+            case 1:
+                body.emplace<Logon>().decode(buf);
+                break;
+            case 2:
+                body.emplace<Logout>().decode(buf);
+                break;
+            case 3:
+                body.emplace<Heartbeat>().decode(buf);
+                break;
+            case 101000:
+                if(!body.emplace<NewOrder>().tryDecode(buf)) return false;
+                break;
+            case 102000:
+                body.emplace<OrderCancelRequest>().decode(buf);
+                break;
+            case 201000:
+                body.emplace<CancelReject>().decode(buf);
+                break;
+            case 202010:
+                if(!body.emplace<ExecutionConfirm>().tryDecode(buf)) return false;
+                break;
+            case 203010:
+                if(!body.emplace<ExecutionReport>().tryDecode(buf)) return false;
+                break;
+            case 5:
+                body.emplace<ReportSynchronization>().decode(buf);
+                break;
+            case 6:
+                body.emplace<PlatformStateInfo>().decode(buf);
+                break;
+            case 7:
+                body.emplace<ReportFinished>().decode(buf);
+                break;
+            default:
+                return false;
+        }
         checksum = buf.read_u32_le();
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 12 + body->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const BjseBinary*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(BjseBinary)) return false;
+        const auto* checkType = static_cast<const BjseBinary*>(&other);
         return msgType == checkType->msgType
                && bodyLength == checkType->bodyLength
                && body->equals(*checkType->body)
@@ -4705,4 +8972,105 @@ inline std::ostream& operator<<(std::ostream& os, const BjseBinary& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded BjseBinary frame: header fields, the body bytes and the trailer,
+// without decoding the body. Pair it with the body type's own View to route on a few fields.
+class BjseBinaryView {
+public:
+    static constexpr size_t kHeaderSize = 8;
+    static constexpr size_t kTrailerSize = 4;
+
+    explicit BjseBinaryView(const ByteBufView& buf)
+        : data_(buf.data() + buf.reader_index()), size_(buf.readable_bytes()) {
+        if(size_ < kHeaderSize || size_ < frameSize()) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t msgType() const { return LittleEndian::load<uint32_t>(data_ + 0); }
+    uint32_t bodyLength() const { return LittleEndian::load<uint32_t>(data_ + 4); }
+    ByteBufView body() const { return ByteBufView(data_ + kHeaderSize, bodyLength()); }
+    uint32_t checksum() const { return LittleEndian::load<uint32_t>(data_ + kHeaderSize + bodyLength()); }
+    size_t frameSize() const { return kHeaderSize + bodyLength() + kTrailerSize; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+};
+
+// Entry point for patching encoded BjseBinary frames: patch() wraps a frame, the body's XWire
+// setters change its fields and the checksum trailer follows.
+struct BjseBinaryWire {
+    static codec::FramePatcher patch(uint8_t* frame, size_t len) {
+        return codec::FramePatcher(frame, len, BjseBinaryFrameSpec, codec::TrailerUpdate::kNone);
+    }
+
+    static codec::FramePatcher patch(ByteBuf& buf, size_t frameStart = 0) {
+        return patch(buf.mutable_data() + frameStart, buf.size() - frameStart);
+    }
+
+    // Encodes the frame `prototype` once as the constant part of a send template.
+    static codec::FrameTemplate makeTemplate(const codec::BinaryCodec& prototype) {
+        return codec::FrameTemplate(prototype, BjseBinaryFrameSpec, codec::TrailerUpdate::kNone);
+    }
+};
+
+// BjseBinary with the body type fixed at compile time: same wire format, but the body is held
+// by value and its encode/decode/encodedSize calls bind statically, so the whole frame encode
+// can be inlined. Still a codec::BinaryCodec for callers that only have the virtual interface.
+template <typename Body>
+struct BjseBinaryFrame final : public codec::BinaryCodec {
+    uint32_t msgType;
+    uint32_t bodyLength;
+    Body body;
+    uint32_t checksum;
+
+    void encode(ByteBuf& buf) const override {
+        buf.write_u32_le(msgType);
+        buf.write_u32_le(bodyLength);
+        body.encode(buf);
+        buf.write_u32_le(checksum);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        msgType = buf.read_u32_le();
+        bodyLength = buf.read_u32_le();
+        body.decode(buf);
+        checksum = buf.read_u32_le();
+    }
+    
+
+    size_t encodedSize() const override {
+        return 12 + body.encodedSize();
+    }
+    
+
+    bool equals(const BinaryCodec& other) const override {
+        if(typeid(other) != typeid(BjseBinaryFrame)) return false;
+        const auto* checkType = static_cast<const BjseBinaryFrame*>(&other);
+        return msgType == checkType->msgType
+               && bodyLength == checkType->bodyLength
+               && body.equals(checkType->body)
+               && checksum == checkType->checksum;
+    }
+    
+    std::string toString() const override {
+        std::ostringstream oss;
+        oss << "BjseBinary { "
+        << "MsgType: " << std::to_string(msgType)
+        << ", "
+        << "BodyLength: " << std::to_string(bodyLength)
+        << ", "
+        << "Body: " << body.toString()
+        << ", "
+        << "Checksum: " << std::to_string(checksum)
+        << " }";
+        return oss.str();
+    }
+    
+};
+
+template <typename Body>
+inline std::ostream& operator<<(std::ostream& os, const BjseBinaryFrame<Body>& pkt) {
+    return os << pkt.toString();
+}
+
 
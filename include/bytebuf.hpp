@@ -3,299 +3,528 @@
 
 #include <endian.h>
 
+#include <cassert>
 #include <cstdint>
 #include <cstring>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
-#include <vector>
+#include <utility>
 
-class ByteBuf {
- public:
-  ByteBuf(size_t capacity = 256) : buffer_(), reader_index_(0), writer_index_(0) {
-    buffer_.reserve(capacity);
+#include "simd.hpp"
+
+namespace detail {
+
+template <size_t N>
+struct UintOfSize;
+template <>
+struct UintOfSize<1> {
+  using type = uint8_t;
+};
+template <>
+struct UintOfSize<2> {
+  using type = uint16_t;
+};
+template <>
+struct UintOfSize<4> {
+  using type = uint32_t;
+};
+template <>
+struct UintOfSize<8> {
+  using type = uint64_t;
+};
+
+inline uint8_t byteswap(uint8_t v) { return v; }
+inline uint16_t byteswap(uint16_t v) { return __builtin_bswap16(v); }
+inline uint32_t byteswap(uint32_t v) { return __builtin_bswap32(v); }
+inline uint64_t byteswap(uint64_t v) { return __builtin_bswap64(v); }
+
+// One unaligned load/store through memcpy, plus a bswap when the wire order is not the host order.
+template <bool Swap>
+struct ByteOrder {
+  template <typename T>
+  static T load(const uint8_t* p) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
+    using U = typename UintOfSize<sizeof(T)>::type;
+    U raw;
+    std::memcpy(&raw, p, sizeof(T));
+    if constexpr (Swap) raw = byteswap(raw);
+    T value;
+    std::memcpy(&value, &raw, sizeof(T));
+    return value;
   }
 
-  void write_u8(uint8_t val) { buffer_.push_back(val); }
-  void write_u8_at(size_t pos, uint8_t val) { write_at(pos, val); }
+  template <typename T>
+  static void store(uint8_t* p, T value) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
+    using U = typename UintOfSize<sizeof(T)>::type;
+    U raw;
+    std::memcpy(&raw, &value, sizeof(T));
+    if constexpr (Swap) raw = byteswap(raw);
+    std::memcpy(p, &raw, sizeof(T));
+  }
+
+  // Bulk forms over `count` contiguous elements: one memcpy when the wire order is the host order,
+  // a vectorized byteswap otherwise.
+  template <typename T>
+  static void load_array(T* dst, const uint8_t* src, size_t count) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
+    if constexpr (Swap && sizeof(T) > 1) {
+      simd::byteswap_copy<sizeof(T)>(dst, src, count);
+    } else if (count > 0) {
+      std::memcpy(dst, src, count * sizeof(T));
+    }
+  }
+
+  template <typename T>
+  static void store_array(uint8_t* dst, const T* src, size_t count) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
+    if constexpr (Swap && sizeof(T) > 1) {
+      simd::byteswap_copy<sizeof(T)>(dst, src, count);
+    } else if (count > 0) {
+      std::memcpy(dst, src, count * sizeof(T));
+    }
+  }
+};
+
+}  // namespace detail
+
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+struct LittleEndian : detail::ByteOrder<false> {};
+struct BigEndian : detail::ByteOrder<true> {};
+#else
+struct LittleEndian : detail::ByteOrder<true> {};
+struct BigEndian : detail::ByteOrder<false> {};
+#endif
+
+// Order used by the unsuffixed write_u32/read_u32 family and the non-_le codec helpers.
+using DefaultByteOrder = LittleEndian;
+
+// Observer fed the bytes of a buffer in order, in chunks of about kChunk, while they are still
+// in cache: ByteBuf hands it what is written after attach_write_tap(), ByteBufView what is read
+// (or skipped) after attach_read_tap(). The frame checksums use it to run their accumulator as
+// the frame is encoded or decoded (see ChecksumWriteTap and ChecksumReadTap).
+class ByteTap {
+ public:
+  static constexpr size_t kChunk = 64;
+
+  virtual void on_bytes(const uint8_t* data, size_t len) = 0;
+
+ protected:
+  ~ByteTap() = default;
+};
+
+// Non-owning, read-only window over encoded bytes. Lets generated decode() run directly on a
+// recv buffer or an mmap'd capture; the caller keeps the memory alive while the view is in use.
+class ByteBufView {
+ public:
+  ByteBufView() : data_(nullptr), size_(0), reader_index_(0) {}
+  ByteBufView(const void* data, size_t size)
+      : data_(static_cast<const uint8_t*>(data)), size_(size), reader_index_(0) {}
+
   uint8_t read_u8() {
     check_read(1);
-    return buffer_[reader_index_++];
+    return data_[reader_index_++];
   }
 
-  void write_u8_le(uint8_t val) { buffer_.push_back(val); }
-  void write_u8_le_at(size_t pos, uint8_t val) { write_le_at(pos, val); }
   uint8_t read_u8_le() {
     check_read(1);
-    return buffer_[reader_index_++];
+    return data_[reader_index_++];
   }
 
-  void write_u16(uint16_t val) { write(val); }
-  void write_u16_at(size_t pos, uint16_t val) { write_at(pos, val); }
-  uint16_t read_u16() {
-    check_read(2);
-    return read<uint16_t>();
-  }
+  uint16_t read_u16() { return read_as<DefaultByteOrder, uint16_t>(); }
 
-  void write_u16_le(uint16_t val) { write_le(val); }
-  void write_u16_le_at(size_t pos, uint16_t val) { write_le_at(pos, val); }
-  uint16_t read_u16_le() {
-    check_read(2);
-    return read_le<uint16_t>();
-  }
+  uint16_t read_u16_le() { return read_as<LittleEndian, uint16_t>(); }
 
-  void write_u32(uint32_t val) { write(val); }
-  void write_u32_at(size_t pos, uint32_t val) { write_at(pos, val); }
-  uint32_t read_u32() {
-    check_read(4);
-    return read<uint32_t>();
-  }
+  uint32_t read_u32() { return read_as<DefaultByteOrder, uint32_t>(); }
 
-  void write_u32_le(uint32_t val) { write_le(val); }
-  void write_u32_le_at(size_t pos, uint32_t val) { write_le_at(pos, val); }
-  uint32_t read_u32_le() {
-    check_read(4);
-    return read_le<uint32_t>();
-  }
+  uint32_t read_u32_le() { return read_as<LittleEndian, uint32_t>(); }
 
-  void write_u64(uint64_t val) { write(val); }
-  void write_u64_at(size_t pos, uint64_t val) { write_at(pos, val); }
-  uint64_t read_u64() {
-    check_read(8);
-    return read<uint64_t>();
-  }
+  uint64_t read_u64() { return read_as<DefaultByteOrder, uint64_t>(); }
 
-  void write_u64_le(uint64_t val) { write_le(val); }
-  void write_u64_le_at(size_t pos, uint64_t val) { write_le_at(pos, val); }
-  uint64_t read_u64_le() {
-    check_read(8);
-    return read_le<uint64_t>();
-  }
+  uint64_t read_u64_le() { return read_as<LittleEndian, uint64_t>(); }
 
-  void write_i8(int8_t val) { buffer_.push_back(static_cast<uint8_t>(val)); }
-  void write_i8_at(size_t pos, int8_t val) { write_at(pos, val); }
   int8_t read_i8() {
     check_read(1);
-    return static_cast<int8_t>(buffer_[reader_index_++]);
+    return static_cast<int8_t>(data_[reader_index_++]);
   }
 
-  void write_i8_le(int8_t val) { buffer_.push_back(static_cast<uint8_t>(val)); }
-  void write_i8_le_at(size_t pos, int8_t val) { write_le_at(pos, val); }
   int8_t read_i8_le() {
     check_read(1);
-    return static_cast<int8_t>(buffer_[reader_index_++]);
+    return static_cast<int8_t>(data_[reader_index_++]);
+  }
+
+  int16_t read_i16() { return read_as<DefaultByteOrder, int16_t>(); }
+
+  int16_t read_i16_le() { return read_as<LittleEndian, int16_t>(); }
+
+  int32_t read_i32() { return read_as<DefaultByteOrder, int32_t>(); }
+
+  int32_t read_i32_le() { return read_as<LittleEndian, int32_t>(); }
+
+  int64_t read_i64() { return read_as<DefaultByteOrder, int64_t>(); }
+
+  int64_t read_i64_le() { return read_as<LittleEndian, int64_t>(); }
+
+  float read_f32() { return read_as<DefaultByteOrder, float>(); }
+
+  float read_f32_le() { return read_as<LittleEndian, float>(); }
+
+  double read_f64() { return read_as<DefaultByteOrder, double>(); }
+
+  double read_f64_le() { return read_as<LittleEndian, double>(); }
+
+  void read_bytes(void* dest, size_t len) {
+    check_read(len);
+    std::memcpy(dest, data_ + reader_index_, len);
+    reader_index_ += len;
   }
-  void write_i16(int16_t val) { write(val); }
-  void write_i6_at(size_t pos, int16_t val) { write_at(pos, val); }
-  int16_t read_i16() {
-    check_read(2);
-    return read<int16_t>();
+
+  void skip_bytes(size_t len) {
+    check_read(len);
+    reader_index_ += len;
   }
 
-  void write_i16_le(int16_t val) { write_le(val); }
-  void write_i16_le_at(size_t pos, int16_t val) { write_at(pos, val); }
-  int16_t read_i16_le() {
-    check_read(2);
-    return read_le<int16_t>();
+  // Returns the next `len` bytes in place and advances past them. The pointer is only valid as
+  // long as the underlying memory is.
+  const uint8_t* read_span(size_t len) {
+    check_read(len);
+    const uint8_t* p = data_ + reader_index_;
+    reader_index_ += len;
+    return p;
   }
 
-  void write_i32(int32_t val) { write(val); }
-  void write_i32_at(size_t pos, int32_t val) { write_at(pos, val); }
-  int32_t read_i32() {
-    check_read(4);
-    return read<int32_t>();
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+  size_t reader_index() const { return reader_index_; }
+  size_t readable_bytes() const { return size_ - reader_index_; }
+
+  template <typename Order, typename T>
+  T read_as() {
+    check_read(sizeof(T));
+    T value = Order::template load<T>(data_ + reader_index_);
+    reader_index_ += sizeof(T);
+    return value;
   }
 
-  void write_i32_le(int32_t val) { write_le(val); }
+  template <typename Order, typename T>
+  void read_array_as(T* dst, size_t count) {
+    Order::load_array(dst, read_span(count * sizeof(T)), count);
+  }
 
-  void write_i32_le_at(size_t pos, int32_t val) { write_le_at(pos, val); }
-  int32_t read_i32_le() {
-    check_read(4);
-    return read_le<int32_t>();
+  template <typename T>
+  T read_le() {
+    return read_as<LittleEndian, T>();
   }
 
-  void write_i64(int64_t val) { write(val); }
-  void write_i64_at(size_t pos, int64_t val) { write_at(pos, val); }
-  int64_t read_i64() {
-    check_read(8);
-    return read<int64_t>();
+  template <typename T>
+  T read_be() {
+    return read_as<BigEndian, T>();
   }
 
-  void write_i64_le(int64_t val) { write_le(val); }
-  void write_i64_le_at(size_t pos, int64_t val) { write_le_at(pos, val); }
-  int64_t read_i64_le() {
-    check_read(8);
-    return read_le<int64_t>();
+  // 通用读取函数，默认小端序
+  template <typename T>
+  T read(bool big_endian = false) {
+    if (big_endian) {
+      return read_be<T>();
+    } else {
+      return read_le<T>();
+    }
+  }
+
+  // Every read and skip comes through here before it advances, so this is also where an attached
+  // tap is fed the bytes consumed since its last chunk.
+  void check_read(size_t required) {
+    if (readable_bytes() < required) {
+      throw std::out_of_range("Not enough data to read");
+    }
+    if (read_tap_ != nullptr && reader_index_ - read_tap_mark_ >= ByteTap::kChunk) {
+      flush_read_tap();
+    }
   }
 
-  void write_f32(float val) { write(val); }
-  float read_f32() {
-    check_read(4);
-    return read<float>();
+  // Feeds every byte read or skipped from now on to `tap`. Only one tap can be attached at a time.
+  void attach_read_tap(ByteTap* tap) {
+    assert(read_tap_ == nullptr);
+    read_tap_ = tap;
+    read_tap_mark_ = reader_index_;
   }
 
-  void write_f32_le(float val) { write_le(val); }
-  float read_f32_le() {
-    check_read(4);
-    return read_le<float>();
+  // Hands the tap the bytes consumed since its last chunk and detaches it.
+  void detach_read_tap() {
+    flush_read_tap();
+    read_tap_ = nullptr;
   }
 
-  void write_f64(double val) { write(val); }
-  double read_f64() {
-    check_read(8);
-    return read<double>();
+  bool has_read_tap() const { return read_tap_ != nullptr; }
+
+ protected:
+  const uint8_t* data_;
+  size_t size_;
+  size_t reader_index_;
+
+ private:
+  void flush_read_tap() {
+    if (reader_index_ > read_tap_mark_) {
+      read_tap_->on_bytes(data_ + read_tap_mark_, reader_index_ - read_tap_mark_);
+    }
+    read_tap_mark_ = reader_index_;
   }
 
-  void write_f64_le(double val) { write_le(val); }
-  double read_f64_le() {
-    check_read(8);
-    return read<double>();
+  ByteTap* read_tap_ = nullptr;
+  size_t read_tap_mark_ = 0;
+};
+
+// Unchecked writer over a region claimed up front with ByteBuf::claim(). The generated encode()
+// methods claim the whole fixed-width run of a message once and write every field through it.
+class ByteBufCursor {
+ public:
+  ByteBufCursor(uint8_t* begin, uint8_t* end) : pos_(begin), end_(end) {}
+
+  void write_u8(uint8_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u8_le(uint8_t val) { write_as<LittleEndian>(val); }
+  void write_u16(uint16_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u16_le(uint16_t val) { write_as<LittleEndian>(val); }
+  void write_u32(uint32_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u32_le(uint32_t val) { write_as<LittleEndian>(val); }
+  void write_u64(uint64_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u64_le(uint64_t val) { write_as<LittleEndian>(val); }
+  void write_i8(int8_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i8_le(int8_t val) { write_as<LittleEndian>(val); }
+  void write_i16(int16_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i16_le(int16_t val) { write_as<LittleEndian>(val); }
+  void write_i32(int32_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i32_le(int32_t val) { write_as<LittleEndian>(val); }
+  void write_i64(int64_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i64_le(int64_t val) { write_as<LittleEndian>(val); }
+  void write_f32(float val) { write_as<DefaultByteOrder>(val); }
+  void write_f32_le(float val) { write_as<LittleEndian>(val); }
+  void write_f64(double val) { write_as<DefaultByteOrder>(val); }
+  void write_f64_le(double val) { write_as<LittleEndian>(val); }
+
+  template <typename Order, typename T>
+  void write_as(T value) {
+    assert(pos_ + sizeof(T) <= end_);
+    Order::store(pos_, value);
+    pos_ += sizeof(T);
+  }
+
+  template <typename Order, typename T>
+  void write_array_as(const T* values, size_t count) {
+    assert(pos_ + count * sizeof(T) <= end_);
+    Order::store_array(pos_, values, count);
+    pos_ += count * sizeof(T);
   }
 
   void write_bytes(const void* data, size_t len) {
-    const uint8_t* bytes = static_cast<const uint8_t*>(data);
-    buffer_.insert(buffer_.end(), bytes, bytes + len);
+    assert(pos_ + len <= end_);
+    std::memcpy(pos_, data, len);
+    pos_ += len;
   }
-  void read_bytes(void* dest, size_t len) {
-    check_read(len);
-    std::memcpy(dest, &buffer_[reader_index_], len);
-    reader_index_ += len;
+
+  void fill(uint8_t val, size_t len) {
+    assert(pos_ + len <= end_);
+    simd::fill(pos_, val, len);
+    pos_ += len;
   }
 
-  const std::vector<uint8_t>& data() const { return buffer_; }
+  size_t remaining() const { return static_cast<size_t>(end_ - pos_); }
 
-  void reset() {
-    buffer_.clear();
-    reader_index_ = 0;
-    writer_index_ = 0;
+ private:
+  uint8_t* pos_;
+  uint8_t* end_;
+};
+
+class ByteBuf : public ByteBufView {
+ public:
+  ByteBuf(size_t capacity = 256) : storage_(nullptr), capacity_(0) {
+    if (capacity > 0) reallocate(capacity);
   }
 
-  size_t readable_bytes() const { return buffer_.size() - reader_index_; }
+  // Takes its storage from `resource` (e.g. a codec::DecodeArena) instead of the global heap.
+  ByteBuf(size_t capacity, std::pmr::memory_resource* resource)
+      : storage_(nullptr), capacity_(0), resource_(resource) {
+    if (capacity > 0) reallocate(capacity);
+  }
 
-  // 修改后的模板函数
-  template <typename T>
-  void write_le(T value) {
-    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
-    if constexpr (std::is_floating_point_v<T>) {
-      // 浮点数的处理方式
-      uint8_t bytes[sizeof(T)];
-      std::memcpy(bytes, &value, sizeof(T));
-      write_bytes(bytes, sizeof(T));
-      writer_index_ += sizeof(T);
-    } else {
-      // 整数的处理方式
-      uint8_t bytes[sizeof(T)];
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        bytes[i] = static_cast<uint8_t>(value >> (i * 8));
-      }
-      write_bytes(bytes, sizeof(T));
-      writer_index_ += sizeof(T);
-    }
+  ByteBuf(const ByteBuf& other) : ByteBufView(), storage_(nullptr), capacity_(0) {
+    if (other.capacity_ > 0) reallocate(other.capacity_);
+    if (other.size_ > 0) std::memcpy(storage_, other.storage_, other.size_);
+    size_ = other.size_;
+    reader_index_ = other.reader_index_;
   }
 
-  template <typename T>
-  void write_be(T value) {
-    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
-    if constexpr (std::is_floating_point_v<T>) {
-      // 浮点数的处理方式
-      uint8_t bytes[sizeof(T)];
-      std::memcpy(bytes, &value, sizeof(T));
-      write_bytes(bytes, sizeof(T));
-      writer_index_ += sizeof(T);
-    } else {
-      // 整数的处理方式
-      uint8_t bytes[sizeof(T)];
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        bytes[i] = static_cast<uint8_t>(value >> ((sizeof(T) - 1 - i) * 8));
-      }
-      write_bytes(bytes, sizeof(T));
-      writer_index_ += sizeof(T);
+  // Steals the heap block of `other`; bytes held in a SmallByteBuf's inline storage are copied.
+  // That copy may have to allocate, so unlike a plain heap move it can throw.
+  ByteBuf(ByteBuf&& other) : ByteBufView(), storage_(nullptr), capacity_(0) {
+    take(std::move(other));
+  }
+
+  ByteBuf& operator=(const ByteBuf& other) {
+    if (this != &other) {
+      size_ = 0;
+      reader_index_ = 0;
+      write_bytes(other.storage_, other.size_);
+      reader_index_ = other.reader_index_;
     }
+    return *this;
   }
 
-  template <typename T>
-  void write_le_at(size_t pos, T value) {
-    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
+  ByteBuf& operator=(ByteBuf&& other) {
+    if (this != &other) take(std::move(other));
+    return *this;
+  }
 
-    if (pos + sizeof(T) > buffer_.size()) {
-      throw std::out_of_range("Position out of bounds for write_le_at");
-    }
+  ~ByteBuf() { free_storage(); }
 
-    if constexpr (std::is_floating_point_v<T>) {
-      uint8_t bytes[sizeof(T)];
-      std::memcpy(bytes, &value, sizeof(T));
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        buffer_[pos + i] = bytes[i];
-      }
-    } else {
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        buffer_[pos + i] = static_cast<uint8_t>(value >> (i * 8));
-      }
+  void write_u8(uint8_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u8_at(size_t pos, uint8_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_u8_le(uint8_t val) { write_as<LittleEndian>(val); }
+  void write_u8_le_at(size_t pos, uint8_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_u16(uint16_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u16_at(size_t pos, uint16_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_u16_le(uint16_t val) { write_as<LittleEndian>(val); }
+  void write_u16_le_at(size_t pos, uint16_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_u32(uint32_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u32_at(size_t pos, uint32_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_u32_le(uint32_t val) { write_as<LittleEndian>(val); }
+  void write_u32_le_at(size_t pos, uint32_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_u64(uint64_t val) { write_as<DefaultByteOrder>(val); }
+  void write_u64_at(size_t pos, uint64_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_u64_le(uint64_t val) { write_as<LittleEndian>(val); }
+  void write_u64_le_at(size_t pos, uint64_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_i8(int8_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i8_at(size_t pos, int8_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_i8_le(int8_t val) { write_as<LittleEndian>(val); }
+  void write_i8_le_at(size_t pos, int8_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_i16(int16_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i6_at(size_t pos, int16_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_i16_le(int16_t val) { write_as<LittleEndian>(val); }
+  void write_i16_le_at(size_t pos, int16_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_i32(int32_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i32_at(size_t pos, int32_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_i32_le(int32_t val) { write_as<LittleEndian>(val); }
+
+  void write_i32_le_at(size_t pos, int32_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_i64(int64_t val) { write_as<DefaultByteOrder>(val); }
+  void write_i64_at(size_t pos, int64_t val) { write_as_at<DefaultByteOrder>(pos, val); }
+
+  void write_i64_le(int64_t val) { write_as<LittleEndian>(val); }
+  void write_i64_le_at(size_t pos, int64_t val) { write_as_at<LittleEndian>(pos, val); }
+
+  void write_f32(float val) { write_as<DefaultByteOrder>(val); }
+
+  void write_f32_le(float val) { write_as<LittleEndian>(val); }
+
+  void write_f64(double val) { write_as<DefaultByteOrder>(val); }
+
+  void write_f64_le(double val) { write_as<LittleEndian>(val); }
+
+  void write_bytes(const void* data, size_t len) {
+    ensure_writable(len);
+    if (len > 0) std::memcpy(storage_ + size_, data, len);
+    size_ += len;
+  }
+
+  // Grows the storage at most once so that the next `len` bytes can be written without
+  // reallocating. Every write comes through here, so this is also where an attached tap is fed
+  // what the previous writes (and claimed cursors) left behind it.
+  void ensure_writable(size_t len) {
+    if (write_tap_ != nullptr && size_ - write_tap_mark_ >= ByteTap::kChunk) flush_write_tap();
+    if (capacity_ - size_ < len) {
+      size_t required = size_ + len;
+      size_t capacity = capacity_ > 0 ? capacity_ * 2 : 64;
+      while (capacity < required) capacity *= 2;
+      reallocate(capacity);
     }
   }
 
-  template <typename T>
-  void write_be_at(size_t pos, T value) {
-    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
+  // Reserves `len` bytes at the writer index and hands them out as an unchecked cursor. The
+  // caller must write exactly `len` bytes through it before touching the buffer again.
+  ByteBufCursor claim(size_t len) {
+    ensure_writable(len);
+    uint8_t* begin = storage_ + size_;
+    size_ += len;
+    return ByteBufCursor(begin, begin + len);
+  }
 
-    if (pos + sizeof(T) > buffer_.size()) {
-      throw std::out_of_range("Position out of bounds for write_be_at");
-    }
+  // Feeds every byte written from now on to `tap`. Only one tap can be attached at a time, and
+  // bytes patched in place with the write_*_at() setters are not seen by it.
+  void attach_write_tap(ByteTap* tap) {
+    assert(write_tap_ == nullptr);
+    write_tap_ = tap;
+    write_tap_mark_ = size_;
+  }
 
-    if constexpr (std::is_floating_point_v<T>) {
-      uint8_t bytes[sizeof(T)];
-      std::memcpy(bytes, &value, sizeof(T));
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        buffer_[pos + i] = bytes[i];
-      }
-    } else {
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        buffer_[pos + i] = static_cast<uint8_t>(value >> ((sizeof(T) - 1 - i) * 8));
-      }
+  // Hands the tap the bytes written since its last chunk and detaches it.
+  void detach_write_tap() {
+    flush_write_tap();
+    write_tap_ = nullptr;
+  }
+
+  bool has_write_tap() const { return write_tap_ != nullptr; }
+
+  // Read-only window over the readable bytes; stays valid until the next write or reset().
+  ByteBufView view() const { return ByteBufView(data_ + reader_index_, readable_bytes()); }
+
+  // Writable access to the bytes already written, e.g. to patch an encoded frame in place.
+  uint8_t* mutable_data() { return storage_; }
+
+  void reset() {
+    size_ = 0;
+    reader_index_ = 0;
+  }
+
+  size_t capacity() const { return capacity_; }
+  std::pmr::memory_resource* resource() const { return resource_; }
+
+  template <typename Order, typename T>
+  void write_as(T value) {
+    ensure_writable(sizeof(T));
+    Order::store(storage_ + size_, value);
+    size_ += sizeof(T);
+  }
+
+  template <typename Order, typename T>
+  void write_as_at(size_t pos, T value) {
+    if (pos + sizeof(T) > size_) {
+      throw std::out_of_range("Position out of bounds for write_at");
     }
+    Order::store(storage_ + pos, value);
   }
 
   template <typename T>
-  T read_le() {
-    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
-    check_read(sizeof(T));
-    if constexpr (std::is_floating_point_v<T>) {
-      // 浮点数的处理方式
-      T value;
-      std::memcpy(&value, &buffer_[reader_index_], sizeof(T));
-      reader_index_ += sizeof(T);
-      return value;
-    } else {
-      // 整数的处理方式
-      T value = 0;
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        value |= static_cast<T>(buffer_[reader_index_ + i]) << (i * 8);
-      }
-      reader_index_ += sizeof(T);
-      return value;
-    }
+  void write_le(T value) {
+    write_as<LittleEndian>(value);
   }
 
   template <typename T>
-  T read_be() {
-    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic type");
-    check_read(sizeof(T));
-    if constexpr (std::is_floating_point_v<T>) {
-      // 浮点数的处理方式
-      T value;
-      uint8_t bytes[sizeof(T)];
-      std::memcpy(bytes, &buffer_[reader_index_], sizeof(T));
-      std::memcpy(&value, bytes, sizeof(T));
-      reader_index_ += sizeof(T);
-      return value;
-    } else {
-      // 整数的处理方式
-      T value = 0;
-      for (size_t i = 0; i < sizeof(T); ++i) {
-        value |= static_cast<T>(buffer_[reader_index_ + i]) << ((sizeof(T) - 1 - i) * 8);
-      }
-      reader_index_ += sizeof(T);
-      return value;
-    }
+  void write_be(T value) {
+    write_as<BigEndian>(value);
+  }
+
+  template <typename T>
+  void write_le_at(size_t pos, T value) {
+    write_as_at<LittleEndian>(pos, value);
+  }
+
+  template <typename T>
+  void write_be_at(size_t pos, T value) {
+    write_as_at<BigEndian>(pos, value);
   }
 
   // 通用写入函数，默认小端序
@@ -316,26 +545,129 @@ class ByteBuf {
     }
   }
 
-  // 通用读取函数，默认小端序
-  template <typename T>
-  T read(bool big_endian = false) {
-    if (big_endian) {
-      return read_be<T>();
-    } else {
-      return read_le<T>();
+  size_t writer_index() const { return size_; }
+
+ protected:
+  // Uses caller-provided storage (SmallByteBuf's inline array) until the first growth, and falls
+  // back to it whenever the heap block is moved away.
+  ByteBuf(uint8_t* inline_storage, size_t capacity)
+      : ByteBufView(inline_storage, 0), storage_(inline_storage), capacity_(capacity),
+        inline_storage_(true), inline_base_(inline_storage), inline_capacity_(capacity) {}
+
+  bool holds_inline_storage() const { return inline_storage_; }
+
+  // Adopts the heap block of `other`, which must not be inline; `other` is left empty.
+  void steal(ByteBuf& other) noexcept {
+    free_storage();
+    data_ = other.data_;
+    size_ = other.size_;
+    reader_index_ = other.reader_index_;
+    storage_ = other.storage_;
+    capacity_ = other.capacity_;
+    resource_ = other.resource_;
+    inline_storage_ = false;
+    other.release();
+  }
+
+  // Copies the contents of `other` into the storage this buffer already has, which must hold them.
+  void copy_within_capacity(const ByteBuf& other) noexcept {
+    assert(other.size_ <= capacity_);
+    if (other.size_ > 0) std::memcpy(storage_, other.data_, other.size_);
+    size_ = other.size_;
+    reader_index_ = other.reader_index_;
+  }
+
+ private:
+  void reallocate(size_t capacity) {
+    auto* storage = static_cast<uint8_t*>(resource_->allocate(capacity, 1));
+    if (size_ > 0) std::memcpy(storage, storage_, size_);
+    free_storage();
+    storage_ = storage;
+    capacity_ = capacity;
+    inline_storage_ = false;
+    data_ = storage_;
+  }
+
+  void flush_write_tap() {
+    if (size_ > write_tap_mark_) {
+      write_tap_->on_bytes(storage_ + write_tap_mark_, size_ - write_tap_mark_);
     }
+    write_tap_mark_ = size_;
   }
 
-  void check_read(size_t required) {
-    if (readable_bytes() < required) {
-      throw std::out_of_range("Not enough data to read");
+  void free_storage() {
+    if (!inline_storage_ && storage_ != nullptr) resource_->deallocate(storage_, capacity_, 1);
+  }
+
+  void take(ByteBuf&& other) {
+    if (!other.inline_storage_) {
+      steal(other);
+      return;
     }
+    *this = static_cast<const ByteBuf&>(other);
+    other.size_ = 0;
+    other.reader_index_ = 0;
+  }
+
+  // Empties the buffer after its heap block was handed to another one. A SmallByteBuf goes back
+  // to its inline array, so reusing it stays allocation-free.
+  void release() {
+    storage_ = inline_base_;
+    capacity_ = inline_capacity_;
+    inline_storage_ = inline_base_ != nullptr;
+    data_ = inline_base_;
+    size_ = 0;
+    reader_index_ = 0;
   }
 
-  size_t writer_index() const { return writer_index_; }
+  uint8_t* storage_;
+  size_t capacity_;
+  std::pmr::memory_resource* resource_ = std::pmr::new_delete_resource();
+  bool inline_storage_ = false;
+  uint8_t* inline_base_ = nullptr;
+  size_t inline_capacity_ = 0;
+  ByteTap* write_tap_ = nullptr;
+  size_t write_tap_mark_ = 0;
+};
+
+// ----------------------------
+// SmallByteBuf
+// ----------------------------
+// ByteBuf whose first N bytes of storage live inside the object, so encoding a short frame on the
+// stack (heartbeats, cancels, admin messages) never calls malloc. It is a ByteBuf, so every
+// generated encode(ByteBuf&) accepts it; past N bytes it spills to the heap like a plain ByteBuf.
+template <size_t N>
+class SmallByteBuf : public ByteBuf {
+ public:
+  static_assert(N > 0, "SmallByteBuf needs inline capacity");
+
+  SmallByteBuf() : ByteBuf(inline_, N) {}
+  SmallByteBuf(const ByteBuf& other) : SmallByteBuf() { ByteBuf::operator=(other); }
+  SmallByteBuf(const SmallByteBuf& other) : SmallByteBuf() { ByteBuf::operator=(other); }
+  SmallByteBuf(SmallByteBuf&& other) noexcept : SmallByteBuf() { move_from(other); }
+
+  SmallByteBuf& operator=(const SmallByteBuf& other) {
+    ByteBuf::operator=(other);
+    return *this;
+  }
+  SmallByteBuf& operator=(SmallByteBuf&& other) noexcept {
+    if (this != &other) move_from(other);
+    return *this;
+  }
+
+  bool is_inline() const { return data() == inline_; }
 
  private:
-  std::vector<uint8_t> buffer_;
-  size_t reader_index_;
-  size_t writer_index_;
+  // Unlike a ByteBuf move, a move between SmallByteBufs of the same N never allocates: inline
+  // contents fit this buffer, whose capacity is never below N, and heap blocks are stolen.
+  void move_from(SmallByteBuf& other) noexcept {
+    if (other.holds_inline_storage()) {
+      copy_within_capacity(other);
+      other.reset();
+    } else {
+      steal(other);
+    }
+  }
+
+  alignas(8) uint8_t inline_[N];
 };
@@ -2,12 +2,18 @@
 #pragma once
 #include <zlib.h>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 
 #include "bytebuf.hpp"
+#include "crc.hpp"
+#include "simd.hpp"
 
 class IChecksumService {
  public:
@@ -22,71 +28,175 @@ class ChecksumService : public IChecksumService {
   using output_type = Output;
 
   virtual Output calc(const Input& data) const = 0;
+
+  // Checksum of [data, data + len) only, e.g. one frame inside a buffer that holds several. The
+  // built-in services run their accumulator over the range directly; this fallback copies the
+  // range into an Input so services that only implement calc() keep working.
+  virtual Output calcRange(const uint8_t* data, size_t len) const {
+    if constexpr (std::is_same_v<Input, ByteBuf>) {
+      ByteBuf range(len);
+      range.write_bytes(data, len);
+      return calc(range);
+    } else {
+      throw std::logic_error("calcRange is not supported for " + algorithm());
+    }
+  }
+
+  // Incremental form of calcRange() over a single state word, which lets the frame encoders and
+  // decoders feed the bytes to the service as they write or read them. beginStream() returns
+  // false for services that cannot stream; their frames are checksummed with one calcRange()
+  // pass instead.
+  virtual bool beginStream(uint64_t& state) const {
+    (void)state;
+    return false;
+  }
+  virtual void updateStream(uint64_t& state, const uint8_t* data, size_t len) const {
+    (void)state;
+    (void)data;
+    (void)len;
+  }
+  virtual Output finishStream(uint64_t state) const {
+    (void)state;
+    return Output();
+  }
+};
+
+// ----------------------------
+// Accumulators
+// ----------------------------
+// Running checksum state fed one byte range at a time, so a checksum can be built from several
+// spans (header, then body) or a span of a receive buffer checked in place, without copying it.
+// The whole state is one integer: state() saves it and the explicit constructor resumes from it.
+class Crc16Accumulator {
+ public:
+  Crc16Accumulator() = default;
+  explicit Crc16Accumulator(uint64_t state) : crc_(static_cast<uint16_t>(state)) {}
+
+  void update(const uint8_t* data, size_t len) { crc_ = crc::crc16_modbus(data, len, crc_); }
+  uint16_t value() const { return crc_; }
+  uint64_t state() const { return crc_; }
+
+ private:
+  uint16_t crc_ = 0xFFFF;
+};
+
+class Crc32Accumulator {
+ public:
+  Crc32Accumulator() = default;
+  explicit Crc32Accumulator(uint64_t state) : crc_(static_cast<uint32_t>(state)) {}
+
+  void update(const uint8_t* data, size_t len) { crc_ = crc::crc32(crc_, data, len); }
+  uint32_t value() const { return crc_; }
+  uint64_t state() const { return crc_; }
+
+ private:
+  uint32_t crc_ = 0;
+};
+
+class SseBinAccumulator {
+ public:
+  SseBinAccumulator() = default;
+  explicit SseBinAccumulator(uint64_t state) : sum_(state) {}
+
+  void update(const uint8_t* data, size_t len) { sum_ += simd::byte_sum(data, len); }
+  uint32_t value() const { return static_cast<uint32_t>(sum_ & 0xFF); }
+  uint64_t state() const { return sum_; }
+
+ private:
+  uint64_t sum_ = 0;
+};
+
+class SzseBinAccumulator {
+ public:
+  SzseBinAccumulator() = default;
+  explicit SzseBinAccumulator(uint64_t state) : sum_(state) {}
+
+  void update(const uint8_t* data, size_t len) { sum_ += simd::byte_sum(data, len); }
+  int32_t value() const { return static_cast<int32_t>(sum_ % 256); }
+  uint64_t state() const { return sum_; }
+
+ private:
+  uint64_t sum_ = 0;
+};
+
+// SSE_BIN and SZSE_BIN are byte sums mod 256, so when bytes of a frame change the checksum moves
+// by the difference of their sums; the rest of the frame need not be summed again.
+inline uint32_t byte_sum_checksum_patch(uint32_t checksum, uint64_t sumBefore, uint64_t sumAfter) {
+  return static_cast<uint32_t>(((checksum & 0xFF) + 256 + sumAfter % 256 - sumBefore % 256) % 256);
+}
+
+template <typename Accumulator>
+auto accumulate(const uint8_t* data, size_t len) {
+  Accumulator acc;
+  acc.update(data, len);
+  return acc.value();
+}
+
+// Base of the built-in services: calcRange() and the streaming hooks both run Accumulator.
+template <typename Accumulator, typename Output>
+class AccumulatorChecksumService : public ChecksumService<ByteBuf, Output> {
+ public:
+  Output calcRange(const uint8_t* data, size_t len) const override {
+    return accumulate<Accumulator>(data, len);
+  }
+
+  bool beginStream(uint64_t& state) const override {
+    state = Accumulator().state();
+    return true;
+  }
+
+  void updateStream(uint64_t& state, const uint8_t* data, size_t len) const override {
+    Accumulator acc(state);
+    acc.update(data, len);
+    state = acc.state();
+  }
+
+  Output finishStream(uint64_t state) const override { return Accumulator(state).value(); }
 };
 
-class Crc16ChecksumService : public ChecksumService<ByteBuf, uint16_t> {
+class Crc16ChecksumService : public AccumulatorChecksumService<Crc16Accumulator, uint16_t> {
  public:
   std::string algorithm() const override { return "CRC16"; }
 
   uint16_t calc(const ByteBuf& data) const override {
-    uint16_t crc = 0xFFFF;
-    for (uint8_t b : data.data()) {
-      crc ^= static_cast<uint16_t>(b);
-      for (int i = 0; i < 8; i++) {
-        if (crc & 0x0001)
-          crc = (crc >> 1) ^ 0xA001;
-        else
-          crc >>= 1;
-      }
-    }
-    return crc;
+    return crc::crc16_modbus(data.data(), data.size());
   }
 };
 
-class Crc32ChecksumService : public ChecksumService<ByteBuf, uint32_t> {
+class Crc32ChecksumService : public AccumulatorChecksumService<Crc32Accumulator, uint32_t> {
  public:
   std::string algorithm() const override { return "CRC32"; }
 
   uint32_t calc(const ByteBuf& data) const override {
-    uint32_t crc = crc32(0, data.data().data(), data.readable_bytes());
-    return crc;
+    return crc::crc32(0, data.data(), data.readable_bytes());
   }
 };
 
-class SseBinChecksumService : public ChecksumService<ByteBuf, uint32_t> {
+class SseBinChecksumService : public AccumulatorChecksumService<SseBinAccumulator, uint32_t> {
  public:
   std::string algorithm() const override { return "SSE_BIN"; }
 
   uint32_t calc(const ByteBuf& data) const override {
-    uint32_t checksum = 0;
-    for (uint8_t b : data.data()) {
-      checksum = (checksum + b) & 0xFF;
-    }
-    return checksum;
+    return calcRange(data.data(), data.size());
   }
 };
 
-class SzseBinChecksumService : public ChecksumService<ByteBuf, int32_t> {
+class SzseBinChecksumService : public AccumulatorChecksumService<SzseBinAccumulator, int32_t> {
  public:
   std::string algorithm() const override { return "SZSE_BIN"; }
 
   int32_t calc(const ByteBuf& data) const override {
-    int32_t checksum = 0;
-    for (uint8_t b : data.data()) {
-      checksum += b;
-    }
-    return checksum % 256;
+    return calcRange(data.data(), data.size());
   }
 };
 
+// Registry of checksum algorithms by name. The built-in services are registered once, when the
+// context is first used; registerService() adds new ones and overrideService() replaces one at
+// runtime. Every change bumps version() so cached ChecksumHandles re-resolve.
 class ChecksumServiceContext {
  public:
   static ChecksumServiceContext& instance() {
     static ChecksumServiceContext ctx;
-    ctx.registerService(std::make_shared<Crc16ChecksumService>());
-    ctx.registerService(std::make_shared<Crc32ChecksumService>());
-    ctx.registerService(std::make_shared<SseBinChecksumService>());
-    ctx.registerService(std::make_shared<SzseBinChecksumService>());
     return ctx;
   }
 
@@ -95,9 +205,18 @@ class ChecksumServiceContext {
     auto algo = service->algorithm();
     if (services_.count(algo)) return false;
     services_[algo] = std::move(service);
+    version_.fetch_add(1, std::memory_order_release);
     return true;
   }
 
+  // Installs `service` under its algorithm name, replacing any service already registered there.
+  void overrideService(std::shared_ptr<IChecksumService> service) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto algo = service->algorithm();
+    services_[algo] = std::move(service);
+    version_.fetch_add(1, std::memory_order_release);
+  }
+
   template <typename Input, typename Output>
   std::shared_ptr<ChecksumService<Input, Output>> get(const std::string& algo) {
     std::lock_guard<std::mutex> lock(mu_);
@@ -108,8 +227,196 @@ class ChecksumServiceContext {
     return nullptr;
   }
 
+  uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
  private:
-  ChecksumServiceContext() = default;
+  ChecksumServiceContext() {
+    registerService(std::make_shared<Crc16ChecksumService>());
+    registerService(std::make_shared<Crc32ChecksumService>());
+    registerService(std::make_shared<SseBinChecksumService>());
+    registerService(std::make_shared<SzseBinChecksumService>());
+  }
+
   std::unordered_map<std::string, std::shared_ptr<IChecksumService>> services_;
   std::mutex mu_;
-};
\ No newline at end of file
+  std::atomic<uint64_t> version_{0};
+};
+
+// Cached lookup of one algorithm for a hot path. get() only goes back to the context (lock, map
+// lookup, dynamic cast) after a registration or override; otherwise it is an atomic load and a
+// compare. A handle is not thread-safe, so give each thread its own (e.g. static thread_local).
+template <typename Input, typename Output>
+class ChecksumHandle {
+ public:
+  explicit ChecksumHandle(std::string algo) : algo_(std::move(algo)) {}
+
+  ChecksumService<Input, Output>* get() {
+    auto& ctx = ChecksumServiceContext::instance();
+    uint64_t version = ctx.version();
+    if (version != version_) {
+      service_ = ctx.get<Input, Output>(algo_);
+      version_ = version;
+    }
+    return service_.get();
+  }
+
+ private:
+  std::string algo_;
+  uint64_t version_ = 0;
+  std::shared_ptr<ChecksumService<Input, Output>> service_;
+};
+
+// ----------------------------
+// Encode-time checksum
+// ----------------------------
+// Checksum of the bytes written to `buf` between construction and value(). Generated frame
+// encoders create one before the header and feed the service through a ByteBuf write tap, so the
+// accumulator runs over each chunk of the frame right after it is written. Services that cannot
+// stream, and buffers that already have a tap, fall back to one calcRange() pass in value().
+template <typename Output>
+class ChecksumWriteTap final : public ByteTap {
+ public:
+  ChecksumWriteTap(const ChecksumService<ByteBuf, Output>* service, ByteBuf& buf)
+      : service_(service), buf_(buf), start_(buf.size()) {
+    if (service_ != nullptr && !buf_.has_write_tap() && service_->beginStream(state_)) {
+      buf_.attach_write_tap(this);
+      attached_ = true;
+    }
+  }
+
+  ~ChecksumWriteTap() {
+    if (attached_) buf_.detach_write_tap();
+  }
+
+  ChecksumWriteTap(const ChecksumWriteTap&) = delete;
+  ChecksumWriteTap& operator=(const ChecksumWriteTap&) = delete;
+
+  // False without a service; the frame then carries its checksum field as is.
+  bool enabled() const { return service_ != nullptr; }
+
+  // Requires enabled(). Call once, before the checksum itself is written.
+  Output value() {
+    if (!attached_) return service_->calcRange(buf_.data() + start_, buf_.size() - start_);
+    buf_.detach_write_tap();
+    attached_ = false;
+    return service_->finishStream(state_);
+  }
+
+  void on_bytes(const uint8_t* data, size_t len) override {
+    service_->updateStream(state_, data, len);
+  }
+
+ private:
+  const ChecksumService<ByteBuf, Output>* service_;
+  ByteBuf& buf_;
+  size_t start_;
+  uint64_t state_ = 0;
+  bool attached_ = false;
+};
+
+// ----------------------------
+// Decode-time verification
+// ----------------------------
+// Read-side counterpart of ChecksumWriteTap: checksum of the bytes read (or skipped) from `buf`
+// between construction and value(), fed to the service through a ByteBufView read tap while the
+// decoder reads the fields. A null service disables it, which is how unsampled frames skip the
+// work; services that cannot stream fall back to one calcRange() pass in value().
+template <typename Output>
+class ChecksumReadTap final : public ByteTap {
+ public:
+  ChecksumReadTap(const ChecksumService<ByteBuf, Output>* service, ByteBufView& buf)
+      : service_(service), buf_(buf), start_(buf.reader_index()) {
+    if (service_ != nullptr && !buf_.has_read_tap() && service_->beginStream(state_)) {
+      buf_.attach_read_tap(this);
+      attached_ = true;
+    }
+  }
+
+  ~ChecksumReadTap() {
+    if (attached_) buf_.detach_read_tap();
+  }
+
+  ChecksumReadTap(const ChecksumReadTap&) = delete;
+  ChecksumReadTap& operator=(const ChecksumReadTap&) = delete;
+
+  bool enabled() const { return service_ != nullptr; }
+
+  // Requires enabled(). Call once, before the checksum itself is read.
+  Output value() {
+    if (!attached_) {
+      return service_->calcRange(buf_.data() + start_, buf_.reader_index() - start_);
+    }
+    buf_.detach_read_tap();
+    attached_ = false;
+    return service_->finishStream(state_);
+  }
+
+  void on_bytes(const uint8_t* data, size_t len) override {
+    service_->updateStream(state_, data, len);
+  }
+
+ private:
+  const ChecksumService<ByteBuf, Output>* service_;
+  ByteBufView& buf_;
+  size_t start_;
+  uint64_t state_ = 0;
+  bool attached_ = false;
+};
+
+enum class ChecksumVerifyMode : uint8_t {
+  kOff,      // read the trailing checksum, never check it (the default)
+  kAlways,   // check every frame
+  kSampled,  // check one frame in every sampleEvery()
+};
+
+// Verification policy and counters for one frame type. Generated decoders ask sample() whether
+// to check the frame they are about to read, accumulate it with a ChecksumReadTap if so, and
+// report the result through verify(); a mismatch is counted, never thrown, so a bad frame still
+// decodes. Policy and counters are safe to use from several threads.
+template <typename Output>
+class ChecksumVerifier {
+ public:
+  void setMode(ChecksumVerifyMode mode, uint32_t sampleEvery = 1) {
+    sampleEvery_.store(sampleEvery == 0 ? 1 : sampleEvery, std::memory_order_relaxed);
+    mode_.store(mode, std::memory_order_relaxed);
+  }
+
+  ChecksumVerifyMode mode() const { return mode_.load(std::memory_order_relaxed); }
+  uint32_t sampleEvery() const { return sampleEvery_.load(std::memory_order_relaxed); }
+
+  bool sample() {
+    switch (mode()) {
+      case ChecksumVerifyMode::kOff:
+        return false;
+      case ChecksumVerifyMode::kAlways:
+        return true;
+      case ChecksumVerifyMode::kSampled:
+        return seen_.fetch_add(1, std::memory_order_relaxed) % sampleEvery() == 0;
+    }
+    return false;
+  }
+
+  // Counts one checked frame whose bytes summed to `actual`; returns false on a mismatch.
+  bool verify(Output actual, Output expected) {
+    checked_.fetch_add(1, std::memory_order_relaxed);
+    if (actual == expected) return true;
+    mismatches_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  uint64_t checked() const { return checked_.load(std::memory_order_relaxed); }
+  uint64_t mismatches() const { return mismatches_.load(std::memory_order_relaxed); }
+
+  void resetCounters() {
+    checked_.store(0, std::memory_order_relaxed);
+    mismatches_.store(0, std::memory_order_relaxed);
+    seen_.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<ChecksumVerifyMode> mode_{ChecksumVerifyMode::kOff};
+  std::atomic<uint32_t> sampleEvery_{1};
+  std::atomic<uint64_t> seen_{0};
+  std::atomic<uint64_t> checked_{0};
+  std::atomic<uint64_t> mismatches_{0};
+};
@@ -1,12 +1,21 @@
 // Copyright 2025 xinchentechnote
 #pragma once
 
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+#include <variant>
 #include <vector>
 
+#include "arena.hpp"
 #include "bytebuf.hpp"
+#include "fixed_string.hpp"
+#include "simd.hpp"
 
 namespace codec {
 
@@ -16,7 +25,9 @@ namespace codec {
 struct BinaryCodec {
   virtual ~BinaryCodec() = default;
   virtual void encode(ByteBuf& buf) const = 0;
-  virtual void decode(ByteBuf& buf) = 0;
+  virtual void decode(ByteBufView& buf) = 0;
+  // Exact number of bytes encode() will append to the buffer
+  virtual size_t encodedSize() const = 0;
   virtual std::string toString() const = 0;
   // Add virtual equality comparison
   virtual bool equals(const BinaryCodec& other) const = 0;
@@ -25,97 +36,272 @@ struct BinaryCodec {
   bool operator!=(const BinaryCodec& other) const { return !(*this == other); }
 };
 
+// ----------------------------
+// FieldMask
+// ----------------------------
+// Set of fields for a partial decode: `msg.decode(buf, codec::FieldMask<NewOrder::Field>{
+// NewOrder::Field::clOrdId, NewOrder::Field::price})` reads only those fields and skips over the
+// rest. Every generated message declares its own `enum class Field` (at most 64 fields).
+template <typename Field>
+class FieldMask {
+ public:
+  constexpr FieldMask() = default;
+  constexpr FieldMask(std::initializer_list<Field> fields) {
+    for (Field f : fields) bits_ |= bit(f);
+  }
+
+  static constexpr FieldMask all() {
+    FieldMask mask;
+    mask.bits_ = ~uint64_t{0};
+    return mask;
+  }
+
+  constexpr FieldMask& set(Field f) {
+    bits_ |= bit(f);
+    return *this;
+  }
+  constexpr bool has(Field f) const { return (bits_ & bit(f)) != 0; }
+
+ private:
+  static constexpr uint64_t bit(Field f) { return uint64_t{1} << static_cast<unsigned>(f); }
+
+  uint64_t bits_ = 0;
+};
+
+// ----------------------------
+// InlineMessage
+// ----------------------------
+// Holds one of a fixed set of message types in place, without a heap allocation. Generated frames
+// use it for body/applExtend fields: -> and * reach the active message through the BinaryCodec
+// interface, visit() reaches it as its concrete type.
+template <typename... Ts>
+class InlineMessage {
+  template <typename T>
+  using EnableIfAlternative = std::enable_if_t<(std::is_same_v<T, Ts> || ...)>;
+
+ public:
+  using variant_type = std::variant<std::monostate, Ts...>;
+
+  InlineMessage() = default;
+
+  // Takes over a message that was built on the heap, e.g. `frame.body = std::make_unique<Logon>()`.
+  template <typename T, typename = EnableIfAlternative<T>>
+  InlineMessage(std::unique_ptr<T> msg) {
+    *this = std::move(msg);
+  }
+
+  template <typename T, typename = EnableIfAlternative<T>>
+  InlineMessage& operator=(std::unique_ptr<T> msg) {
+    if (msg) {
+      value_.template emplace<T>(std::move(*msg));
+    } else {
+      reset();
+    }
+    return *this;
+  }
+
+  template <typename T, typename... Args, typename = EnableIfAlternative<T>>
+  T& emplace(Args&&... args) {
+    return value_.template emplace<T>(std::forward<Args>(args)...);
+  }
+
+  void reset() { value_.template emplace<std::monostate>(); }
+
+  bool has_value() const { return value_.index() != 0; }
+  explicit operator bool() const { return has_value(); }
+
+  BinaryCodec* get() { return std::visit(AsCodec{}, value_); }
+  const BinaryCodec* get() const { return std::visit(AsCodec{}, value_); }
+  BinaryCodec* operator->() { return get(); }
+  const BinaryCodec* operator->() const { return get(); }
+  BinaryCodec& operator*() { return *get(); }
+  const BinaryCodec& operator*() const { return *get(); }
+
+  template <typename T>
+  T* get_if() {
+    return std::get_if<T>(&value_);
+  }
+  template <typename T>
+  const T* get_if() const {
+    return std::get_if<T>(&value_);
+  }
+
+  // Calls f with the active message as its concrete type (std::monostate when empty).
+  template <typename F>
+  decltype(auto) visit(F&& f) {
+    return std::visit(std::forward<F>(f), value_);
+  }
+  template <typename F>
+  decltype(auto) visit(F&& f) const {
+    return std::visit(std::forward<F>(f), value_);
+  }
+
+  variant_type& value() { return value_; }
+  const variant_type& value() const { return value_; }
+
+ private:
+  struct AsCodec {
+    BinaryCodec* operator()(std::monostate&) const { return nullptr; }
+    const BinaryCodec* operator()(const std::monostate&) const { return nullptr; }
+    template <typename T>
+    BinaryCodec* operator()(T& msg) const {
+      return &msg;
+    }
+    template <typename T>
+    const BinaryCodec* operator()(const T& msg) const {
+      return &msg;
+    }
+  };
+
+  variant_type value_;
+};
+
+// ----------------------------
+// encoded size of variable-length fields
+// ----------------------------
+template <typename T>
+size_t string_size(const std::string& s) {
+  return sizeof(T) + s.size();
+}
+
+template <typename T, typename K, typename S, typename A>
+size_t string_list_size(const std::vector<S, A>& list) {
+  size_t size = sizeof(T) + list.size() * sizeof(K);
+  for (const auto& s : list) {
+    size += s.size();
+  }
+  return size;
+}
+
+template <typename T, typename S, typename A>
+size_t fixed_string_list_size(const std::vector<S, A>& list, size_t fixedLen) {
+  return sizeof(T) + list.size() * fixedLen;
+}
+
+template <typename T, typename K, typename A = std::allocator<K>>
+size_t basic_type_list_size(const std::vector<K, A>& list) {
+  return sizeof(T) + list.size() * sizeof(K);
+}
+
+template <typename T, typename K, typename A = std::allocator<K>>
+size_t object_list_size(const std::vector<K, A>& list) {
+  size_t size = sizeof(T);
+  for (const auto& obj : list) {
+    size += obj.encodedSize();
+  }
+  return size;
+}
+
 // ----------------------------
 // put/get dynamic string
 // ----------------------------
 template <typename T>
 void write_string_le(ByteBuf& buf, const std::string& s) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned integral");
-  buf.write_le<T>(static_cast<T>(s.size()));
-  buf.write_bytes(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+  auto out = buf.claim(sizeof(T) + s.size());
+  out.write_as<LittleEndian>(static_cast<T>(s.size()));
+  out.write_bytes(s.data(), s.size());
 }
 
 template <typename T>
-std::string read_string_le(ByteBuf& buf) {
+std::string read_string_le(ByteBufView& buf) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned integral");
   T length = buf.read_le<T>();
-  std::vector<uint8_t> bytes(length);
-  buf.read_bytes(bytes.data(), length);
-  return std::string(reinterpret_cast<char*>(bytes.data()), length);
+  return std::string(reinterpret_cast<const char*>(buf.read_span(length)), length);
 }
 
 template <typename T>
 void write_string(ByteBuf& buf, const std::string& s) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned integral");
-  buf.write<T>(static_cast<T>(s.size()));
-  buf.write_bytes(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+  auto out = buf.claim(sizeof(T) + s.size());
+  out.write_as<DefaultByteOrder>(static_cast<T>(s.size()));
+  out.write_bytes(s.data(), s.size());
 }
 
 template <typename T>
-std::string read_string(ByteBuf& buf) {
+std::string read_string(ByteBufView& buf) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned integral");
-  T length = buf.read<T>();
-  std::vector<uint8_t> bytes(length);
-  buf.read_bytes(bytes.data(), length);
-  return std::string(reinterpret_cast<char*>(bytes.data()), length);
+  T length = buf.read_as<DefaultByteOrder, T>();
+  return std::string(reinterpret_cast<const char*>(buf.read_span(length)), length);
 }
 
 // ----------------------------
 // put/get Fixed-length string
 // ----------------------------
 
-inline void write_fixed_string(ByteBuf& buf, const std::string& s, size_t fixedLen, char padChar,
-                             bool padLeft) {
+inline void write_fixed_string(ByteBufCursor& out, std::string_view s, size_t fixedLen,
+                               char padChar, bool padLeft) {
   if (s.size() >= fixedLen) {
-    buf.write_bytes(reinterpret_cast<const uint8_t*>(s.data()), fixedLen);
+    out.write_bytes(s.data(), fixedLen);
   } else {
-    std::vector<uint8_t> padCharBytes(fixedLen - s.size(), padChar);
+    size_t padLen = fixedLen - s.size();
     if (padLeft) {
-      buf.write_bytes(padCharBytes.data(), padCharBytes.size());
+      out.fill(static_cast<uint8_t>(padChar), padLen);
     }
-    buf.write_bytes(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+    out.write_bytes(s.data(), s.size());
     if (!padLeft) {
-      buf.write_bytes(padCharBytes.data(), padCharBytes.size());
+      out.fill(static_cast<uint8_t>(padChar), padLen);
     }
   }
 }
 
-inline void write_fixed_string(ByteBuf& buf, const std::string& s, size_t fixedLen) {
-  write_fixed_string(buf, s, fixedLen, ' ', false);
+inline void write_fixed_string(ByteBufCursor& out, std::string_view s, size_t fixedLen) {
+  write_fixed_string(out, s, fixedLen, ' ', false);
 }
 
-inline std::string read_fixed_string(ByteBuf& buf, size_t fixedLen, char trimPadChar,
-                                    bool padLeft) {
-  std::vector<uint8_t> bytes(fixedLen);
-  buf.read_bytes(bytes.data(), fixedLen);
-  std::string s(reinterpret_cast<char*>(bytes.data()), fixedLen);
+inline void write_fixed_string(ByteBuf& buf, std::string_view s, size_t fixedLen, char padChar,
+                               bool padLeft) {
+  auto out = buf.claim(fixedLen);
+  write_fixed_string(out, s, fixedLen, padChar, padLeft);
+}
+
+inline void write_fixed_string(ByteBuf& buf, std::string_view s, size_t fixedLen) {
+  write_fixed_string(buf, s, fixedLen, ' ', false);
+}
 
+// Strips the pad run that write_fixed_string added on the padded side.
+inline std::string_view trim_fixed_string(std::string_view s, char trimPadChar, bool padLeft) {
   if (padLeft) {
-    size_t start = s.find_first_not_of(trimPadChar);
-    if (start != std::string::npos)
-      s.erase(0, start);
-    else
-      s.clear();
-  } else {
-    size_t end = s.find_last_not_of(trimPadChar);
-    if (end != std::string::npos)
-      s.erase(end + 1);
-    else
-      s.clear();
+    return s.substr(simd::find_first_not_of(s.data(), s.size(), trimPadChar));
   }
+  return s.substr(0, simd::find_last_not_of(s.data(), s.size(), trimPadChar));
+}
 
-  return s;
+// Trimmed value of a fixed-width field sitting at `p`, without copying it (used by the generated
+// View classes).
+inline std::string_view fixed_string_view(const uint8_t* p, size_t fixedLen, char trimPadChar = ' ',
+                                          bool padLeft = false) {
+  return trim_fixed_string(std::string_view(reinterpret_cast<const char*>(p), fixedLen),
+                           trimPadChar, padLeft);
+}
+
+inline std::string read_fixed_string(ByteBufView& buf, size_t fixedLen, char trimPadChar,
+                                    bool padLeft) {
+  const char* raw = reinterpret_cast<const char*>(buf.read_span(fixedLen));
+  return std::string(trim_fixed_string(std::string_view(raw, fixedLen), trimPadChar, padLeft));
 }
 
-inline std::string read_fixed_string(ByteBuf& buf, size_t fixedLen) {
+inline std::string read_fixed_string(ByteBufView& buf, size_t fixedLen) {
   return read_fixed_string(buf, fixedLen, ' ', false);
 }
 
+// Decodes an N-byte fixed-width field straight into inline storage, without allocating.
+template <size_t N>
+FixedString<N> read_fixed_string(ByteBufView& buf, char trimPadChar, bool padLeft) {
+  const char* raw = reinterpret_cast<const char*>(buf.read_span(N));
+  return FixedString<N>(trim_fixed_string(std::string_view(raw, N), trimPadChar, padLeft));
+}
+
+template <size_t N>
+FixedString<N> read_fixed_string(ByteBufView& buf) {
+  return read_fixed_string<N>(buf, ' ', false);
+}
+
 // ----------------------------
 // String List
 // ----------------------------
-template <typename T, typename K>
-void write_string_list_le(ByteBuf& buf, const std::vector<std::string>& list) {
+template <typename T, typename K, typename S, typename A>
+void write_string_list_le(ByteBuf& buf, const std::vector<S, A>& list) {
   static_assert(std::is_unsigned<T>::value && std::is_unsigned<K>::value,
                 "T and K must be unsigned");
   buf.write_le<T>(static_cast<T>(list.size()));
@@ -125,47 +311,43 @@ void write_string_list_le(ByteBuf& buf, const std::vector<std::string>& list) {
   }
 }
 
-template <typename T, typename K>
-std::vector<std::string> read_string_list_le(ByteBuf& buf) {
+template <typename T, typename K, typename List = std::vector<std::string>>
+List read_string_list_le(ByteBufView& buf) {
   static_assert(std::is_unsigned<T>::value && std::is_unsigned<K>::value,
                 "T and K must be unsigned");
   T count = buf.read_le<T>();
-  std::vector<std::string> result;
+  List result;
   result.reserve(count);
 
   for (size_t i = 0; i < count; ++i) {
     K len = buf.read_le<K>();
-    std::vector<uint8_t> bytes(len);
-    buf.read_bytes(bytes.data(), len);
-    result.emplace_back(reinterpret_cast<char*>(bytes.data()), len);
+    result.emplace_back(reinterpret_cast<const char*>(buf.read_span(len)), len);
   }
   return result;
 }
 
-template <typename T, typename K>
-void write_string_list(ByteBuf& buf, const std::vector<std::string>& list) {
+template <typename T, typename K, typename S, typename A>
+void write_string_list(ByteBuf& buf, const std::vector<S, A>& list) {
   static_assert(std::is_unsigned<T>::value && std::is_unsigned<K>::value,
                 "T and K must be unsigned");
-  buf.write<T>(static_cast<T>(list.size()));
+  buf.write_as<DefaultByteOrder, T>(static_cast<T>(list.size()));
   for (const auto& s : list) {
-    buf.write<K>(static_cast<K>(s.size()));
+    buf.write_as<DefaultByteOrder, K>(static_cast<K>(s.size()));
     buf.write_bytes(reinterpret_cast<const uint8_t*>(s.data()), s.size());
   }
 }
 
-template <typename T, typename K>
-std::vector<std::string> read_string_list(ByteBuf& buf) {
+template <typename T, typename K, typename List = std::vector<std::string>>
+List read_string_list(ByteBufView& buf) {
   static_assert(std::is_unsigned<T>::value && std::is_unsigned<K>::value,
                 "T and K must be unsigned");
-  T count = buf.read<T>();
-  std::vector<std::string> result;
+  T count = buf.read_as<DefaultByteOrder, T>();
+  List result;
   result.reserve(count);
 
   for (size_t i = 0; i < count; ++i) {
-    K len = buf.read<K>();
-    std::vector<uint8_t> bytes(len);
-    buf.read_bytes(bytes.data(), len);
-    result.emplace_back(reinterpret_cast<char*>(bytes.data()), len);
+    K len = buf.read_as<DefaultByteOrder, K>();
+    result.emplace_back(reinterpret_cast<const char*>(buf.read_span(len)), len);
   }
   return result;
 }
@@ -174,126 +356,125 @@ std::vector<std::string> read_string_list(ByteBuf& buf) {
 // fixed String List
 // ----------------------------
 
-template <typename T>
-void write_fixed_string_list_le(ByteBuf& buf, const std::vector<std::string>& list, size_t fixedLen,
-                              char padChar, bool padLeft) {
+template <typename T, typename S, typename A>
+void write_fixed_string_list_le(ByteBuf& buf, const std::vector<S, A>& list,
+                                size_t fixedLen, char padChar, bool padLeft) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  buf.write_le<T>(static_cast<T>(list.size()));
+  ByteBufCursor out = buf.claim(sizeof(T) + list.size() * fixedLen);
+  out.write_as<LittleEndian>(static_cast<T>(list.size()));
   for (const auto& s : list) {
-    write_fixed_string(buf, s, fixedLen, padChar, padLeft);
+    write_fixed_string(out, s, fixedLen, padChar, padLeft);
   }
 }
 
-template <typename T>
-void write_fixed_string_list_le(ByteBuf& buf, const std::vector<std::string>& list, size_t fixedLen) {
-  write_fixed_string_list_le<T>(buf, list, fixedLen, ' ', false);
+template <typename T, typename S, typename A>
+void write_fixed_string_list_le(ByteBuf& buf, const std::vector<S, A>& list,
+                                size_t fixedLen) {
+  write_fixed_string_list_le<T, S, A>(buf, list, fixedLen, ' ', false);
 }
 
-template <typename T>
-std::vector<std::string> read_fixed_string_list_le(ByteBuf& buf, size_t fixedLen, char trimPadChar,
-                                                  bool padLeft) {
+template <typename T, typename List = std::vector<std::string>>
+List read_fixed_string_list_le(ByteBufView& buf, size_t fixedLen, char trimPadChar, bool padLeft) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
   T count = buf.read_le<T>();
-  std::vector<std::string> result;
+  List result;
   result.reserve(count);
   for (size_t i = 0; i < count; ++i) {
-    result.push_back(read_fixed_string(buf, fixedLen, trimPadChar, padLeft));
+    result.emplace_back(fixed_string_view(buf.read_span(fixedLen), fixedLen, trimPadChar, padLeft));
   }
   return result;
 }
 
-template <typename T>
-std::vector<std::string> read_fixed_string_list_le(ByteBuf& buf, size_t fixedLen) {
-  return read_fixed_string_list_le<T>(buf, fixedLen, ' ', false);
+template <typename T, typename List = std::vector<std::string>>
+List read_fixed_string_list_le(ByteBufView& buf, size_t fixedLen) {
+  return read_fixed_string_list_le<T, List>(buf, fixedLen, ' ', false);
 }
 
-template <typename T>
-void write_fixed_string_list(ByteBuf& buf, const std::vector<std::string>& list, size_t fixedLen,
-                           char padChar, bool padLeft) {
+template <typename T, typename S, typename A>
+void write_fixed_string_list(ByteBuf& buf, const std::vector<S, A>& list,
+                             size_t fixedLen, char padChar, bool padLeft) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  buf.write<T>(static_cast<T>(list.size()));
+  ByteBufCursor out = buf.claim(sizeof(T) + list.size() * fixedLen);
+  out.write_as<DefaultByteOrder>(static_cast<T>(list.size()));
   for (const auto& s : list) {
-    write_fixed_string(buf, s, fixedLen, padChar, padLeft);
+    write_fixed_string(out, s, fixedLen, padChar, padLeft);
   }
 }
 
-template <typename T>
-void write_fixed_string_list(ByteBuf& buf, const std::vector<std::string>& list, size_t fixedLen) {
-  write_fixed_string_list<T>(buf, list, fixedLen, ' ', false);
+template <typename T, typename S, typename A>
+void write_fixed_string_list(ByteBuf& buf, const std::vector<S, A>& list,
+                             size_t fixedLen) {
+  write_fixed_string_list<T, S, A>(buf, list, fixedLen, ' ', false);
 }
 
-template <typename T>
-std::vector<std::string> read_fixed_string_list(ByteBuf& buf, size_t fixedLen, char trimPadChar,
-                                               bool padLeft) {
+template <typename T, typename List = std::vector<std::string>>
+List read_fixed_string_list(ByteBufView& buf, size_t fixedLen, char trimPadChar, bool padLeft) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  T count = buf.read<T>();
-  std::vector<std::string> result;
+  T count = buf.read_as<DefaultByteOrder, T>();
+  List result;
   result.reserve(count);
   for (size_t i = 0; i < count; ++i) {
-    result.push_back(read_fixed_string(buf, fixedLen, trimPadChar, padLeft));
+    result.emplace_back(fixed_string_view(buf.read_span(fixedLen), fixedLen, trimPadChar, padLeft));
   }
   return result;
 }
 
-template <typename T>
-std::vector<std::string> read_fixed_string_list(ByteBuf& buf, size_t fixedLen) {
-  return read_fixed_string_list<T>(buf, fixedLen, ' ', false);
+template <typename T, typename List = std::vector<std::string>>
+List read_fixed_string_list(ByteBufView& buf, size_t fixedLen) {
+  return read_fixed_string_list<T, List>(buf, fixedLen, ' ', false);
 }
 
 // ----------------------------
 // basic type List
 // ----------------------------
-template <typename T, typename K>
-void write_basic_type_le(ByteBuf& buf, const std::vector<K>& list) {
+// The elements are copied in bulk: one memcpy when Order is the host order, a vectorized
+// byteswap otherwise.
+template <typename Order, typename T, typename K, typename A = std::allocator<K>>
+void write_basic_type_as(ByteBuf& buf, const std::vector<K, A>& list) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  buf.write_le<T>(static_cast<T>(list.size()));
-  for (const auto& v : list) {
-    buf.write_le<K>(static_cast<K>(v));
-  }
+  ByteBufCursor out = buf.claim(basic_type_list_size<T, K, A>(list));
+  out.write_as<Order>(static_cast<T>(list.size()));
+  out.write_array_as<Order>(list.data(), list.size());
 }
 
-template <typename T, typename K>
-std::vector<K> read_basic_type_le(ByteBuf& buf) {
+template <typename Order, typename T, typename K, typename List = std::vector<K>>
+List read_basic_type_as(ByteBufView& buf) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  T count = buf.read_le<T>();
-  std::vector<K> result;
-  result.reserve(count);
-  for (size_t i = 0; i < count; ++i) {
-    result.push_back(buf.read_le<K>());
-  }
+  T count = buf.read_as<Order, T>();
+  List result(count);
+  buf.read_array_as<Order>(result.data(), result.size());
   return result;
 }
 
-template <typename T, typename K>
-void write_basic_type(ByteBuf& buf, const std::vector<K>& list) {
-  static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  buf.write<T>(static_cast<T>(list.size()));
-  for (const auto& v : list) {
-    buf.write<K>(static_cast<K>(v));
-  }
+template <typename T, typename K, typename A = std::allocator<K>>
+void write_basic_type_le(ByteBuf& buf, const std::vector<K, A>& list) {
+  write_basic_type_as<LittleEndian, T, K, A>(buf, list);
 }
 
-template <typename T, typename K>
-std::vector<K> read_basic_type(ByteBuf& buf) {
-  static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  T count = buf.read<T>();
-  std::vector<K> result;
-  result.reserve(count);
-  for (size_t i = 0; i < count; ++i) {
-    result.push_back(buf.read<K>());
-  }
-  return result;
+template <typename T, typename K, typename List = std::vector<K>>
+List read_basic_type_le(ByteBufView& buf) {
+  return read_basic_type_as<LittleEndian, T, K, List>(buf);
 }
 
-template <typename T>
-std::string join_vector(const std::vector<T>& vec, const std::string& sep = ", ") {
+template <typename T, typename K, typename A = std::allocator<K>>
+void write_basic_type(ByteBuf& buf, const std::vector<K, A>& list) {
+  write_basic_type_as<DefaultByteOrder, T, K, A>(buf, list);
+}
+
+template <typename T, typename K, typename List = std::vector<K>>
+List read_basic_type(ByteBufView& buf) {
+  return read_basic_type_as<DefaultByteOrder, T, K, List>(buf);
+}
+
+template <typename T, typename A>
+std::string join_vector(const std::vector<T, A>& vec, const std::string& sep = ", ") {
   std::ostringstream vss;
   vss << "[";
   for (size_t i = 0; i < vec.size(); ++i) {
     if (i > 0) vss << sep;
     if constexpr (std::is_same_v<T, int8_t> || std::is_same_v<T, uint8_t>) {
       vss << static_cast<int>(vec[i]);
-    } else if constexpr (std::is_same_v<T, std::string>) {
+    } else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, ArenaString>) {
       // Handle strings with escaping
       vss << "\"" << vec[i] << "\"";
     } else if constexpr (std::is_same_v<T, char>) {
@@ -310,31 +491,29 @@ std::string join_vector(const std::vector<T>& vec, const std::string& sep = ", "
 // ----------------------------
 // object List
 // ----------------------------
-template <typename T, typename K>
-void write_object_List(ByteBuf& buf, const std::vector<K>& list) {
+template <typename T, typename K, typename A = std::allocator<K>>
+void write_object_List(ByteBuf& buf, const std::vector<K, A>& list) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  buf.write<T>(static_cast<T>(list.size()));
+  buf.write_as<DefaultByteOrder, T>(static_cast<T>(list.size()));
   for (const auto& obj : list) {
     obj.encode(buf);
   }
 }
 
-template <typename T, typename K>
-std::vector<K> read_object_List(ByteBuf& buf) {
+template <typename T, typename K, typename List = std::vector<K>>
+List read_object_List(ByteBufView& buf) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
-  T count = buf.read<T>();
-  std::vector<K> result;
+  T count = buf.read_as<DefaultByteOrder, T>();
+  List result;
   result.reserve(count);
   for (size_t i = 0; i < count; ++i) {
-    K obj;
-    obj.decode(buf);
-    result.push_back(obj);
+    result.emplace_back().decode(buf);
   }
   return result;
 }
 
-template <typename T, typename K>
-void write_object_List_le(ByteBuf& buf, const std::vector<K>& list) {
+template <typename T, typename K, typename A = std::allocator<K>>
+void write_object_List_le(ByteBuf& buf, const std::vector<K, A>& list) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
   buf.write_le<T>(static_cast<T>(list.size()));
   for (const auto& obj : list) {
@@ -342,18 +521,106 @@ void write_object_List_le(ByteBuf& buf, const std::vector<K>& list) {
   }
 }
 
-template <typename T, typename K>
-std::vector<K> read_object_List_le(ByteBuf& buf) {
+template <typename T, typename K, typename List = std::vector<K>>
+List read_object_List_le(ByteBufView& buf) {
   static_assert(std::is_unsigned<T>::value, "T must be unsigned");
   T count = buf.read_le<T>();
-  std::vector<K> result;
+  List result;
   result.reserve(count);
   for (size_t i = 0; i < count; ++i) {
-    K obj;
-    obj.decode(buf);
-    result.push_back(obj);
+    result.emplace_back().decode(buf);
   }
   return result;
 }
 
+// ----------------------------
+// skip (partial decode)
+// ----------------------------
+// Counterparts of the read_* helpers for fields left out of a FieldMask: they move the reader
+// past the field without materializing it, but still read every length prefix, so a truncated or
+// inconsistent frame throws exactly where the full decode would.
+template <typename Order, typename T>
+void skip_string_as(ByteBufView& buf) {
+  static_assert(std::is_unsigned<T>::value, "T must be unsigned integral");
+  buf.skip_bytes(buf.read_as<Order, T>());
+}
+
+template <typename T>
+void skip_string(ByteBufView& buf) {
+  skip_string_as<DefaultByteOrder, T>(buf);
+}
+
+template <typename T>
+void skip_string_le(ByteBufView& buf) {
+  skip_string_as<LittleEndian, T>(buf);
+}
+
+template <typename Order, typename T, typename K>
+void skip_string_list_as(ByteBufView& buf) {
+  static_assert(std::is_unsigned<T>::value && std::is_unsigned<K>::value,
+                "T and K must be unsigned");
+  T count = buf.read_as<Order, T>();
+  for (size_t i = 0; i < count; ++i) {
+    buf.skip_bytes(buf.read_as<Order, K>());
+  }
+}
+
+template <typename T, typename K>
+void skip_string_list(ByteBufView& buf) {
+  skip_string_list_as<DefaultByteOrder, T, K>(buf);
+}
+
+template <typename T, typename K>
+void skip_string_list_le(ByteBufView& buf) {
+  skip_string_list_as<LittleEndian, T, K>(buf);
+}
+
+template <typename Order, typename T>
+void skip_fixed_string_list_as(ByteBufView& buf, size_t fixedLen) {
+  static_assert(std::is_unsigned<T>::value, "T must be unsigned");
+  T count = buf.read_as<Order, T>();
+  buf.skip_bytes(static_cast<size_t>(count) * fixedLen);
+}
+
+template <typename T>
+void skip_fixed_string_list(ByteBufView& buf, size_t fixedLen) {
+  skip_fixed_string_list_as<DefaultByteOrder, T>(buf, fixedLen);
+}
+
+template <typename T>
+void skip_fixed_string_list_le(ByteBufView& buf, size_t fixedLen) {
+  skip_fixed_string_list_as<LittleEndian, T>(buf, fixedLen);
+}
+
+template <typename T, typename K>
+void skip_basic_type(ByteBufView& buf) {
+  skip_fixed_string_list_as<DefaultByteOrder, T>(buf, sizeof(K));
+}
+
+template <typename T, typename K>
+void skip_basic_type_le(ByteBufView& buf) {
+  skip_fixed_string_list_as<LittleEndian, T>(buf, sizeof(K));
+}
+
+// Elements are walked with an empty mask: nothing is stored, but nested lengths are still checked.
+template <typename Order, typename T, typename K>
+void skip_object_List_as(ByteBufView& buf) {
+  static_assert(std::is_unsigned<T>::value, "T must be unsigned");
+  T count = buf.read_as<Order, T>();
+  K scratch;
+  for (size_t i = 0; i < count; ++i) {
+    scratch.decode(buf, FieldMask<typename K::Field>());
+  }
+}
+
+template <typename T, typename K>
+void skip_object_List(ByteBufView& buf) {
+  skip_object_List_as<DefaultByteOrder, T, K>(buf);
+}
+
+template <typename T, typename K>
+void skip_object_List_le(ByteBufView& buf) {
+  skip_object_List_as<LittleEndian, T, K>(buf);
+}
+
 }  // namespace codec
@@ -0,0 +1,159 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+#include <zlib.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// CRC kernels behind Crc16ChecksumService and Crc32ChecksumService. CRC16/MODBUS runs
+// slicing-by-8 over constexpr tables; CRC32 folds 64-byte blocks with PCLMULQDQ when the CPU has
+// it (checked once at runtime) and leaves short inputs and the tail to zlib.
+namespace crc {
+
+namespace detail {
+
+using Crc16Tables = std::array<std::array<uint16_t, 256>, 8>;
+
+constexpr Crc16Tables make_crc16_tables(uint16_t poly) {
+  Crc16Tables t{};
+  for (uint32_t b = 0; b < 256; ++b) {
+    uint16_t crc = static_cast<uint16_t>(b);
+    for (int i = 0; i < 8; ++i) {
+      crc = (crc & 1) ? static_cast<uint16_t>((crc >> 1) ^ poly) : static_cast<uint16_t>(crc >> 1);
+    }
+    t[0][b] = crc;
+  }
+  for (size_t k = 1; k < 8; ++k) {
+    for (uint32_t b = 0; b < 256; ++b) {
+      uint16_t prev = t[k - 1][b];
+      t[k][b] = static_cast<uint16_t>((prev >> 8) ^ t[0][prev & 0xFF]);
+    }
+  }
+  return t;
+}
+
+inline constexpr Crc16Tables kCrc16Modbus = make_crc16_tables(0xA001);
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define CRC_HAVE_RUNTIME_PCLMUL 1
+// Folds the 128-bit accumulator 128 bits forward onto the next block.
+__attribute__((target("sse4.1,pclmul"))) inline __m128i fold16_pclmul(__m128i acc, __m128i next,
+                                                                       __m128i k3k4) {
+  __m128i lo = _mm_clmulepi64_si128(acc, k3k4, 0x00);
+  __m128i hi = _mm_clmulepi64_si128(acc, k3k4, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(hi, next), lo);
+}
+
+// Folds len bytes (a multiple of 16, at least 64) into the reflected CRC32 state `crc`, using the
+// constants from Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ".
+// Takes and returns the state without the final inversion, like zlib's internal register.
+__attribute__((target("sse4.1,pclmul"))) inline uint32_t crc32_fold_pclmul(const uint8_t* buf,
+                                                                             size_t len,
+                                                                             uint32_t crc) {
+  const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+  const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+  const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+  const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+  const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+  __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x00));
+  __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x10));
+  __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x20));
+  __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x30));
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+  buf += 64;
+  len -= 64;
+
+  // Four independent 128-bit lanes, each folded 512 bits forward per block.
+  while (len >= 64) {
+    __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+    __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+    __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+    __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+    x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+    x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+    x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x00)));
+    x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x10)));
+    x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x20)));
+    x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x30)));
+    buf += 64;
+    len -= 64;
+  }
+
+  // Fold the four lanes into one, then any remaining 16-byte blocks.
+  x1 = fold16_pclmul(x1, x2, k3k4);
+  x1 = fold16_pclmul(x1, x3, k3k4);
+  x1 = fold16_pclmul(x1, x4, k3k4);
+  while (len >= 16) {
+    x1 = fold16_pclmul(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf)), k3k4);
+    buf += 16;
+    len -= 16;
+  }
+
+  // 128 -> 64 bits.
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_and_si128(x1, mask32);
+  x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits.
+  x2 = _mm_and_si128(x1, mask32);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+  x2 = _mm_and_si128(x2, mask32);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+inline bool has_pclmul() {
+  static const bool supported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+  return supported;
+}
+#endif
+
+}  // namespace detail
+
+// CRC16/MODBUS (reflected poly 0xA001, init 0xFFFF, no final xor), eight bytes per table step.
+inline uint16_t crc16_modbus(const uint8_t* p, size_t len, uint16_t crc = 0xFFFF) {
+  const auto& t = detail::kCrc16Modbus;
+  for (; len >= 8; p += 8, len -= 8) {
+    const uint8_t b0 = static_cast<uint8_t>(p[0] ^ (crc & 0xFF));
+    const uint8_t b1 = static_cast<uint8_t>(p[1] ^ (crc >> 8));
+    crc = t[7][b0] ^ t[6][b1] ^ t[5][p[2]] ^ t[4][p[3]] ^ t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^
+          t[0][p[7]];
+  }
+  for (; len > 0; ++p, --len) {
+    crc = static_cast<uint16_t>((crc >> 8) ^ t[0][(crc ^ *p) & 0xFF]);
+  }
+  return crc;
+}
+
+// Same contract as zlib's crc32(crc, p, len): pass 0 to start, or a previous result to continue.
+inline uint32_t crc32(uint32_t crc, const uint8_t* p, size_t len) {
+#if defined(CRC_HAVE_RUNTIME_PCLMUL)
+  if (len >= 64 && detail::has_pclmul()) {
+    const size_t chunk = len & ~static_cast<size_t>(15);
+    crc = ~detail::crc32_fold_pclmul(p, chunk, ~crc);
+    p += chunk;
+    len -= chunk;
+  }
+#endif
+  if (len == 0) return crc;
+  return static_cast<uint32_t>(::crc32(crc, p, static_cast<uInt>(len)));
+}
+
+}  // namespace crc
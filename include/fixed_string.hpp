@@ -0,0 +1,89 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace codec {
+
+// ----------------------------
+// FixedString
+// ----------------------------
+// Inline, fixed-capacity value for a fixed-width wire field. It holds the trimmed value (at most N
+// bytes, longer input is truncated the same way write_fixed_string truncates), never allocates,
+// and is trivially copyable.
+template <size_t N>
+class FixedString {
+ public:
+  static constexpr size_t kCapacity = N;
+
+  FixedString() = default;
+  FixedString(const char* s) { assign(std::string_view(s)); }
+  FixedString(const std::string& s) { assign(std::string_view(s)); }
+  FixedString(std::string_view s) { assign(s); }
+
+  void assign(std::string_view s) {
+    size_ = s.size() < N ? s.size() : N;
+    if (size_ > 0) std::memcpy(data_, s.data(), size_);
+  }
+
+  void clear() { size_ = 0; }
+
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  std::string_view view() const { return std::string_view(data_, size_); }
+  operator std::string_view() const { return view(); }
+  std::string str() const { return std::string(data_, size_); }
+
+  friend bool operator==(const FixedString& a, const FixedString& b) { return a.view() == b.view(); }
+  friend bool operator!=(const FixedString& a, const FixedString& b) { return !(a == b); }
+  friend bool operator==(const FixedString& a, std::string_view b) { return a.view() == b; }
+  friend bool operator!=(const FixedString& a, std::string_view b) { return a.view() != b; }
+  friend bool operator==(std::string_view a, const FixedString& b) { return a == b.view(); }
+  friend bool operator!=(std::string_view a, const FixedString& b) { return a != b.view(); }
+  friend bool operator==(const FixedString& a, const std::string& b) { return a.view() == b; }
+  friend bool operator!=(const FixedString& a, const std::string& b) { return a.view() != b; }
+  friend bool operator==(const FixedString& a, const char* b) { return a.view() == b; }
+  friend bool operator!=(const FixedString& a, const char* b) { return a.view() != b; }
+
+  friend std::ostream& operator<<(std::ostream& os, const FixedString& s) { return os << s.view(); }
+
+ private:
+  char data_[N] = {};
+  size_t size_ = 0;
+};
+
+// ----------------------------
+// pack_key
+// ----------------------------
+// Packs a short code (applId "010", "417", ...) into an integer, first character in the most
+// significant byte, so generated applExtend switches can dispatch on it without string hashing.
+namespace detail {
+constexpr uint32_t pack_chars(const char* s, size_t len) {
+  uint32_t key = 0;
+  for (size_t i = 0; i < len; ++i) {
+    key = (key << 8) | static_cast<uint8_t>(s[i]);
+  }
+  return key;
+}
+}  // namespace detail
+
+template <size_t N>
+constexpr uint32_t pack_key(const char (&s)[N]) {
+  static_assert(N - 1 <= sizeof(uint32_t), "key must fit in 4 characters");
+  return detail::pack_chars(s, N - 1);
+}
+
+template <size_t N>
+uint32_t pack_key(const FixedString<N>& s) {
+  static_assert(N <= sizeof(uint32_t), "key must fit in 4 characters");
+  return detail::pack_chars(s.data(), s.size());
+}
+
+}  // namespace codec
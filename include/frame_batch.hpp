@@ -0,0 +1,98 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "bytebuf.hpp"
+#include "codec.hpp"
+
+namespace codec {
+
+namespace detail {
+// Batch elements may be frames or (smart) pointers to frames.
+template <typename T>
+const auto& frame_ref(const T& element) {
+  if constexpr (std::is_base_of_v<BinaryCodec, T>) {
+    return element;
+  } else {
+    return *element;
+  }
+}
+}  // namespace detail
+
+// ----------------------------
+// FrameBatch
+// ----------------------------
+// Encodes bursts of frames (mass cancels, quote refreshes) back to back into one contiguous
+// buffer, ready for a single write(). encode() sizes the buffer once for the whole range, each
+// frame still gets its own length and checksum, and offsets() tells where every frame starts.
+//
+//   codec::FrameBatch batch;
+//   batch.encode(cancels);  // e.g. std::vector<SzseBinaryFrame<OrderCancelRequest>>
+//   ::write(fd, batch.data(), batch.bytes());
+//   batch.clear();
+//
+// clear() keeps the capacity, so a batch reused across bursts stops allocating after the first.
+class FrameBatch {
+ public:
+  explicit FrameBatch(size_t initialCapacity = 4096) : buf_(initialCapacity) {}
+
+  // Appends every frame of `frames`. Elements are encoded through their static type, so ranges of
+  // XFrame<Body> skip the virtual calls.
+  template <typename Range>
+  void encode(const Range& frames) {
+    size_t total = 0;
+    size_t count = 0;
+    for (const auto& frame : frames) {
+      total += detail::frame_ref(frame).encodedSize();
+      ++count;
+    }
+    buf_.ensure_writable(total);
+    offsets_.reserve(offsets_.size() + count);
+    for (const auto& frame : frames) {
+      offsets_.push_back(buf_.size());
+      detail::frame_ref(frame).encode(buf_);
+    }
+  }
+
+  template <typename Frame>
+  void add(const Frame& frame) {
+    offsets_.push_back(buf_.size());
+    detail::frame_ref(frame).encode(buf_);
+  }
+
+  // Number of frames in the batch.
+  size_t size() const { return offsets_.size(); }
+  bool empty() const { return offsets_.empty(); }
+
+  // Start of each frame in data(); frame i ends where frame i + 1 starts, the last at bytes().
+  const std::vector<size_t>& offsets() const { return offsets_; }
+
+  ByteBufView frame(size_t i) const {
+    if (i >= offsets_.size()) {
+      throw std::out_of_range("Frame index out of range");
+    }
+    size_t end = i + 1 < offsets_.size() ? offsets_[i + 1] : buf_.size();
+    return ByteBufView(buf_.data() + offsets_[i], end - offsets_[i]);
+  }
+
+  const uint8_t* data() const { return buf_.data(); }
+  size_t bytes() const { return buf_.size(); }
+  ByteBuf& buffer() { return buf_; }
+  const ByteBuf& buffer() const { return buf_; }
+
+  void clear() {
+    buf_.reset();
+    offsets_.clear();
+  }
+
+ private:
+  ByteBuf buf_;
+  std::vector<size_t> offsets_;
+};
+
+}  // namespace codec
@@ -0,0 +1,137 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+#include "bytebuf.hpp"
+#include "checksum.hpp"
+#include "codec.hpp"
+#include "simd.hpp"
+#include "stream_framer.hpp"
+
+namespace codec {
+
+// How the trailer of a frame follows a patch.
+enum class TrailerUpdate : uint8_t {
+  kNone,     // no checksum, or one the library does not compute (BJSE)
+  kByteSum,  // SSE_BIN / SZSE_BIN: adjusted by the byte-sum difference of the patched range
+};
+
+// ----------------------------
+// FramePatcher
+// ----------------------------
+// Rewrites fields of an already encoded frame in place, for retransmits and template sends that
+// change only a sequence number, a timestamp or an order id. Offsets are from the start of the
+// frame; the generated XWire setters (`NewOrderSingleWire::setPrice(frame, px)`) supply them.
+// Fields that select the layout of what follows (msgType, applId) have no setters: the bytes
+// after them would still follow the old layout, so changing one takes a full re-encode.
+// Each patch updates the trailer in O(patch) instead of re-encoding and re-summing the frame.
+// kByteSum assumes the trailer holds the checksum of the frame as encoded, i.e. the checksum
+// service was registered when it was encoded.
+class FramePatcher {
+ public:
+  FramePatcher(uint8_t* frame, size_t len, const FrameSpec& spec, TrailerUpdate update)
+      : frame_(frame), spec_(spec), update_(update) {
+    if (len < spec_.headerSize || len < spec_.frameSize(frame_)) {
+      throw std::out_of_range("Not enough data to read");
+    }
+    trailer_ = spec_.headerSize + spec_.bodyLength(frame_);
+  }
+
+  uint8_t* data() { return frame_; }
+  size_t size() const { return trailer_ + spec_.trailerSize; }
+  const FrameSpec& spec() const { return spec_; }
+
+  template <typename Order, typename T>
+  void put(size_t offset, T value) {
+    patch(offset, sizeof(T), [&](uint8_t* p) { Order::store(p, value); });
+  }
+
+  void put_fixed_string(size_t offset, std::string_view s, size_t fixedLen, char padChar = ' ',
+                        bool padLeft = false) {
+    patch(offset, fixedLen, [&](uint8_t* p) {
+      ByteBufCursor out(p, p + fixedLen);
+      write_fixed_string(out, s, fixedLen, padChar, padLeft);
+    });
+  }
+
+  void put_bytes(size_t offset, const void* data, size_t len) {
+    patch(offset, len, [&](uint8_t* p) { std::memcpy(p, data, len); });
+  }
+
+ private:
+  // Header and body bytes may change; the length field and the trailer may not.
+  template <typename Write>
+  void patch(size_t offset, size_t len, Write&& write) {
+    if (offset + len > trailer_ ||
+        (offset < spec_.lengthOffset + sizeof(uint32_t) && offset + len > spec_.lengthOffset)) {
+      throw std::out_of_range("Patch outside the frame fields");
+    }
+    uint8_t* p = frame_ + offset;
+    if (update_ == TrailerUpdate::kByteSum) {
+      uint64_t before = simd::byte_sum(p, len);
+      write(p);
+      uint8_t* trailer = frame_ + trailer_;
+      LittleEndian::store(trailer, byte_sum_checksum_patch(LittleEndian::load<uint32_t>(trailer),
+                                                           before, simd::byte_sum(p, len)));
+    } else {
+      write(p);
+    }
+  }
+
+  uint8_t* frame_;
+  FrameSpec spec_;
+  TrailerUpdate update_;
+  size_t trailer_;
+};
+
+// ----------------------------
+// FrameTemplate
+// ----------------------------
+// Pre-encoded frame for the send hot path. Everything that stays the same from order to order
+// (account, PBU, security, side, ...) is encoded once; each send copies the bytes and patches only
+// the variable slots through the XWire setters:
+//
+//   codec::FrameTemplate tmpl = SseBinaryWire::makeTemplate(prototype);
+//   codec::FramePatcher order = tmpl.stamp(sendBuf);
+//   SseBinaryWire::setMsgSeqNum(order, seq);
+//   NewOrderSingleWire::setClOrdId(order, clOrdId);
+//   NewOrderSingleWire::setPrice(order, price);
+//
+// The slots are fixed-width, so the length never changes, and the checksum is carried over from
+// the template and adjusted patch by patch.
+class FrameTemplate {
+ public:
+  FrameTemplate(const BinaryCodec& frame, const FrameSpec& spec, TrailerUpdate update)
+      : spec_(spec), update_(update) {
+    frame.encode(bytes_);
+  }
+
+  size_t size() const { return bytes_.size(); }
+  const uint8_t* data() const { return bytes_.data(); }
+
+  // Appends a copy of the template to `out` and returns a patcher over the copy, valid until `out`
+  // is next written to.
+  FramePatcher stamp(ByteBuf& out) const {
+    const size_t start = out.size();
+    out.write_bytes(bytes_.data(), bytes_.size());
+    return FramePatcher(out.mutable_data() + start, bytes_.size(), spec_, update_);
+  }
+
+  // Copies the template into `dst`, which must hold size() bytes.
+  FramePatcher stamp(uint8_t* dst) const {
+    std::memcpy(dst, bytes_.data(), bytes_.size());
+    return FramePatcher(dst, bytes_.size(), spec_, update_);
+  }
+
+ private:
+  ByteBuf bytes_;
+  FrameSpec spec_;
+  TrailerUpdate update_;
+};
+
+}  // namespace codec
@@ -1,9 +1,26 @@
+#pragma once
 
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+
+template <typename Message, typename T>
+std::unique_ptr<Message> makeMessage() {
+  return std::make_unique<T>();
+}
+
+// Messages of a factory whose keys are all known when the headers are generated. The generator
+// specializes this per factory Tag with a switch built from the protocol's message list, so
+// those keys are resolved without hashing and without a static registration per message.
+template <typename Tag>
+struct GeneratedMessages {
+  static constexpr bool kEnabled = false;
+};
 
 template <typename Key, typename Message, typename Tag>
 class MessageFactory {
  public:
-  using Creator = std::function<std::unique_ptr<Message>()>;
+  using Creator = std::unique_ptr<Message> (*)();
   using key_type = Key;
 
   static MessageFactory& getInstance() {
@@ -12,16 +29,30 @@ class MessageFactory {
   }
 
   std::unique_ptr<Message> create(const Key& key) {
-    auto it = creators_.find(key);
-    if (it == creators_.end()) {
+    auto msg = tryCreate(key);
+    if (!msg) {
       throw std::runtime_error("No such message type");
     }
-    return it->second();
+    return msg;
+  }
+
+  // Like create(), but an unknown key yields nullptr instead of an exception. Messages registered
+  // at runtime take precedence; the generated switch answers every other key.
+  std::unique_ptr<Message> tryCreate(const Key& key) {
+    if (!creators_.empty()) {
+      auto it = creators_.find(key);
+      if (it != creators_.end()) return it->second();
+    }
+    if constexpr (GeneratedMessages<Tag>::kEnabled) {
+      return GeneratedMessages<Tag>::create(key);
+    } else {
+      return nullptr;
+    }
   }
 
   template <typename T>
   void registerMessage(const Key& key) { 
-    creators_[key] = []{ return std::make_unique<T>();}; 
+    creators_[key] = &makeMessage<Message, T>;
 }
 
   void removeMessage(const Key& key) { creators_.erase(key); }
@@ -46,4 +77,4 @@ struct AutoRegister {
 #define CONCAT(x, y) CONCAT_IMPL(x, y)
 
 #define REGISTER_MESSAGE(factory, key, type) \
-    static AutoRegister<factory, type> CONCAT(reg_##type##_, __LINE__)(key);
\ No newline at end of file
+    static AutoRegister<factory, type> CONCAT(reg_##type##_, __LINE__)(key);
@@ -6,15 +6,18 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 #include <iostream>
 #include "include/codec.hpp"
 #include "include/bytebuf.hpp"
 #include "include/checksum.hpp"
+#include "include/stream_framer.hpp"
 #include "message_factory.hpp"
 
-struct NewOrder : public codec::BinaryCodec {
+struct NewOrder final : public codec::BinaryCodec {
     std::string uniqueOrderId;
     std::string clOrdId;
     std::string securityId;
@@ -24,19 +27,31 @@ struct NewOrder : public codec::BinaryCodec {
     std::string ordType;
     std::string account;
 
+    enum class Field : uint8_t {
+        uniqueOrderId,
+        clOrdId,
+        securityId,
+        side,
+        price,
+        orderQty,
+        ordType,
+        account,
+    };
+
     void encode(ByteBuf& buf) const override {
         codec::write_string<uint32_t>(buf, uniqueOrderId);
         codec::write_string<uint32_t>(buf, clOrdId);
         codec::write_string<uint32_t>(buf, securityId);
-        codec::write_fixed_string(buf, side, 1);
-        buf.write_u64(price);
-        buf.write_u64(orderQty);
-        codec::write_fixed_string(buf, ordType, 1);
+        auto out = buf.claim(18);
+        codec::write_fixed_string(out, side, 1);
+        out.write_u64(price);
+        out.write_u64(orderQty);
+        codec::write_fixed_string(out, ordType, 1);
         codec::write_string<uint32_t>(buf, account);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         uniqueOrderId = codec::read_string<uint32_t>(buf);
         clOrdId = codec::read_string<uint32_t>(buf);
         securityId = codec::read_string<uint32_t>(buf);
@@ -48,9 +63,40 @@ struct NewOrder : public codec::BinaryCodec {
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::uniqueOrderId)) uniqueOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::securityId)) securityId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::side)) side = codec::read_fixed_string(buf, 1);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::price)) price = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::ordType)) ordType = codec::read_fixed_string(buf, 1);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::account)) account = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 18
+               + codec::string_size<uint32_t>(uniqueOrderId)
+               + codec::string_size<uint32_t>(clOrdId)
+               + codec::string_size<uint32_t>(securityId)
+               + codec::string_size<uint32_t>(account);
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const NewOrder*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(NewOrder)) return false;
+        const auto* checkType = static_cast<const NewOrder*>(&other);
         return uniqueOrderId == checkType->uniqueOrderId
                && clOrdId == checkType->clOrdId
                && securityId == checkType->securityId
@@ -90,7 +136,7 @@ inline std::ostream& operator<<(std::ostream& os, const NewOrder& pkt) {
 }
 
 
-struct OrderConfirm : public codec::BinaryCodec {
+struct OrderConfirm final : public codec::BinaryCodec {
     std::string uniqueOrderId;
     std::string uniqueOrigOrderId;
     std::string clOrdId;
@@ -98,17 +144,27 @@ struct OrderConfirm : public codec::BinaryCodec {
     uint32_t ordRejReason;
     std::string ordCnfmId;
 
+    enum class Field : uint8_t {
+        uniqueOrderId,
+        uniqueOrigOrderId,
+        clOrdId,
+        execType,
+        ordRejReason,
+        ordCnfmId,
+    };
+
     void encode(ByteBuf& buf) const override {
         codec::write_string<uint32_t>(buf, uniqueOrderId);
         codec::write_string<uint32_t>(buf, uniqueOrigOrderId);
         codec::write_string<uint32_t>(buf, clOrdId);
-        codec::write_fixed_string(buf, execType, 1);
-        buf.write_u32(ordRejReason);
+        auto out = buf.claim(5);
+        codec::write_fixed_string(out, execType, 1);
+        out.write_u32(ordRejReason);
         codec::write_string<uint32_t>(buf, ordCnfmId);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         uniqueOrderId = codec::read_string<uint32_t>(buf);
         uniqueOrigOrderId = codec::read_string<uint32_t>(buf);
         clOrdId = codec::read_string<uint32_t>(buf);
@@ -118,9 +174,36 @@ struct OrderConfirm : public codec::BinaryCodec {
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::uniqueOrderId)) uniqueOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::uniqueOrigOrderId)) uniqueOrigOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::execType)) execType = codec::read_fixed_string(buf, 1);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::ordRejReason)) ordRejReason = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ordCnfmId)) ordCnfmId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 5
+               + codec::string_size<uint32_t>(uniqueOrderId)
+               + codec::string_size<uint32_t>(uniqueOrigOrderId)
+               + codec::string_size<uint32_t>(clOrdId)
+               + codec::string_size<uint32_t>(ordCnfmId);
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const OrderConfirm*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(OrderConfirm)) return false;
+        const auto* checkType = static_cast<const OrderConfirm*>(&other);
         return uniqueOrderId == checkType->uniqueOrderId
                && uniqueOrigOrderId == checkType->uniqueOrigOrderId
                && clOrdId == checkType->clOrdId
@@ -154,7 +237,7 @@ inline std::ostream& operator<<(std::ostream& os, const OrderConfirm& pkt) {
 }
 
 
-struct ExecutionReport : public codec::BinaryCodec {
+struct ExecutionReport final : public codec::BinaryCodec {
     std::string uniqueOrderId;
     std::string clOrdId;
     std::string ordCnfmId;
@@ -162,17 +245,27 @@ struct ExecutionReport : public codec::BinaryCodec {
     uint64_t lastQty;
     std::string ordStatus;
 
+    enum class Field : uint8_t {
+        uniqueOrderId,
+        clOrdId,
+        ordCnfmId,
+        lastPx,
+        lastQty,
+        ordStatus,
+    };
+
     void encode(ByteBuf& buf) const override {
         codec::write_string<uint32_t>(buf, uniqueOrderId);
         codec::write_string<uint32_t>(buf, clOrdId);
         codec::write_string<uint32_t>(buf, ordCnfmId);
-        buf.write_u64(lastPx);
-        buf.write_u64(lastQty);
-        codec::write_fixed_string(buf, ordStatus, 1);
+        auto out = buf.claim(17);
+        out.write_u64(lastPx);
+        out.write_u64(lastQty);
+        codec::write_fixed_string(out, ordStatus, 1);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         uniqueOrderId = codec::read_string<uint32_t>(buf);
         clOrdId = codec::read_string<uint32_t>(buf);
         ordCnfmId = codec::read_string<uint32_t>(buf);
@@ -182,9 +275,35 @@ struct ExecutionReport : public codec::BinaryCodec {
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::uniqueOrderId)) uniqueOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::ordCnfmId)) ordCnfmId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::lastPx)) lastPx = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::lastQty)) lastQty = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::ordStatus)) ordStatus = codec::read_fixed_string(buf, 1);
+        else buf.skip_bytes(1);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 17
+               + codec::string_size<uint32_t>(uniqueOrderId)
+               + codec::string_size<uint32_t>(clOrdId)
+               + codec::string_size<uint32_t>(ordCnfmId);
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExecutionReport*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExecutionReport)) return false;
+        const auto* checkType = static_cast<const ExecutionReport*>(&other);
         return uniqueOrderId == checkType->uniqueOrderId
                && clOrdId == checkType->clOrdId
                && ordCnfmId == checkType->ordCnfmId
@@ -218,13 +337,21 @@ inline std::ostream& operator<<(std::ostream& os, const ExecutionReport& pkt) {
 }
 
 
-struct OrderCancel : public codec::BinaryCodec {
+struct OrderCancel final : public codec::BinaryCodec {
     std::string uniqueOrderId;
     std::string uniqueOrigOrderId;
     std::string clOrdId;
     std::string origClOrdId;
     std::string securityId;
 
+    enum class Field : uint8_t {
+        uniqueOrderId,
+        uniqueOrigOrderId,
+        clOrdId,
+        origClOrdId,
+        securityId,
+    };
+
     void encode(ByteBuf& buf) const override {
         codec::write_string<uint32_t>(buf, uniqueOrderId);
         codec::write_string<uint32_t>(buf, uniqueOrigOrderId);
@@ -234,7 +361,7 @@ struct OrderCancel : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         uniqueOrderId = codec::read_string<uint32_t>(buf);
         uniqueOrigOrderId = codec::read_string<uint32_t>(buf);
         clOrdId = codec::read_string<uint32_t>(buf);
@@ -243,9 +370,34 @@ struct OrderCancel : public codec::BinaryCodec {
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::uniqueOrderId)) uniqueOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::uniqueOrigOrderId)) uniqueOrigOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::securityId)) securityId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return codec::string_size<uint32_t>(uniqueOrderId)
+               + codec::string_size<uint32_t>(uniqueOrigOrderId)
+               + codec::string_size<uint32_t>(clOrdId)
+               + codec::string_size<uint32_t>(origClOrdId)
+               + codec::string_size<uint32_t>(securityId);
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const OrderCancel*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(OrderCancel)) return false;
+        const auto* checkType = static_cast<const OrderCancel*>(&other);
         return uniqueOrderId == checkType->uniqueOrderId
                && uniqueOrigOrderId == checkType->uniqueOrigOrderId
                && clOrdId == checkType->clOrdId
@@ -276,13 +428,21 @@ inline std::ostream& operator<<(std::ostream& os, const OrderCancel& pkt) {
 }
 
 
-struct CancelReject : public codec::BinaryCodec {
+struct CancelReject final : public codec::BinaryCodec {
     std::string uniqueOrderId;
     std::string uniqueOrigOrderId;
     std::string clOrdId;
     std::string origClOrdId;
     uint32_t cxlRejReason;
 
+    enum class Field : uint8_t {
+        uniqueOrderId,
+        uniqueOrigOrderId,
+        clOrdId,
+        origClOrdId,
+        cxlRejReason,
+    };
+
     void encode(ByteBuf& buf) const override {
         codec::write_string<uint32_t>(buf, uniqueOrderId);
         codec::write_string<uint32_t>(buf, uniqueOrigOrderId);
@@ -292,7 +452,7 @@ struct CancelReject : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         uniqueOrderId = codec::read_string<uint32_t>(buf);
         uniqueOrigOrderId = codec::read_string<uint32_t>(buf);
         clOrdId = codec::read_string<uint32_t>(buf);
@@ -301,9 +461,34 @@ struct CancelReject : public codec::BinaryCodec {
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::uniqueOrderId)) uniqueOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::uniqueOrigOrderId)) uniqueOrigOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::cxlRejReason)) cxlRejReason = buf.read_u32();
+        else buf.skip_bytes(4);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 4
+               + codec::string_size<uint32_t>(uniqueOrderId)
+               + codec::string_size<uint32_t>(uniqueOrigOrderId)
+               + codec::string_size<uint32_t>(clOrdId)
+               + codec::string_size<uint32_t>(origClOrdId);
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const CancelReject*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(CancelReject)) return false;
+        const auto* checkType = static_cast<const CancelReject*>(&other);
         return uniqueOrderId == checkType->uniqueOrderId
                && uniqueOrigOrderId == checkType->uniqueOrigOrderId
                && clOrdId == checkType->clOrdId
@@ -334,11 +519,17 @@ inline std::ostream& operator<<(std::ostream& os, const CancelReject& pkt) {
 }
 
 
-struct RiskResult : public codec::BinaryCodec {
+struct RiskResult final : public codec::BinaryCodec {
     std::string uniqueOrderId;
     uint8_t riskStatus;
     std::string riskReason;
 
+    enum class Field : uint8_t {
+        uniqueOrderId,
+        riskStatus,
+        riskReason,
+    };
+
     void encode(ByteBuf& buf) const override {
         codec::write_string<uint32_t>(buf, uniqueOrderId);
         buf.write_u8(riskStatus);
@@ -346,16 +537,35 @@ struct RiskResult : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         uniqueOrderId = codec::read_string<uint32_t>(buf);
         riskStatus = buf.read_u8();
         riskReason = codec::read_string<uint32_t>(buf);
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::uniqueOrderId)) uniqueOrderId = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+        if(mask.has(Field::riskStatus)) riskStatus = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::riskReason)) riskReason = codec::read_string<uint32_t>(buf);
+        else codec::skip_string<uint32_t>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 1
+               + codec::string_size<uint32_t>(uniqueOrderId)
+               + codec::string_size<uint32_t>(riskReason);
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const RiskResult*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(RiskResult)) return false;
+        const auto* checkType = static_cast<const RiskResult*>(&other);
         return uniqueOrderId == checkType->uniqueOrderId
                && riskStatus == checkType->riskStatus
                && riskReason == checkType->riskReason;
@@ -382,45 +592,97 @@ inline std::ostream& operator<<(std::ostream& os, const RiskResult& pkt) {
 
 struct RcBinaryTag{};
 using RcBinaryMessageFactory = MessageFactory<uint32_t, codec::BinaryCodec, RcBinaryTag>;
-REGISTER_MESSAGE(RcBinaryMessageFactory, 100101, NewOrder);
-REGISTER_MESSAGE(RcBinaryMessageFactory, 200102, OrderConfirm);
-REGISTER_MESSAGE(RcBinaryMessageFactory, 200115, ExecutionReport);
-REGISTER_MESSAGE(RcBinaryMessageFactory, 190007, OrderCancel);
-REGISTER_MESSAGE(RcBinaryMessageFactory, 290008, CancelReject);
-REGISTER_MESSAGE(RcBinaryMessageFactory, 800001, RiskResult);
+template <>
+struct GeneratedMessages<RcBinaryTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(uint32_t key) {
+        switch(key) {
+            case 100101:
+                return std::make_unique<NewOrder>();
+            case 200102:
+                return std::make_unique<OrderConfirm>();
+            case 200115:
+                return std::make_unique<ExecutionReport>();
+            case 190007:
+                return std::make_unique<OrderCancel>();
+            case 290008:
+                return std::make_unique<CancelReject>();
+            case 800001:
+                return std::make_unique<RiskResult>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using RcBinaryBody = codec::InlineMessage<NewOrder, OrderConfirm, ExecutionReport, OrderCancel, CancelReject, RiskResult>;
+
 
+// Header/length/trailer layout of a RcBinary frame, for codec::StreamFramer.
+inline constexpr codec::FrameSpec RcBinaryFrameSpec{12, 8, 0};
 
-struct RcBinary : public codec::BinaryCodec {
+struct RcBinary final : public codec::BinaryCodec {
     uint32_t msgType;
     uint32_t version;
     uint32_t msgBodyLen;
-    std::unique_ptr<codec::BinaryCodec> body;
+    RcBinaryBody body;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u32(msgType);
-        buf.write_u32(version);
-        auto msgBodyLenPos = buf.writer_index();
-        buf.write_u32(0);
-        auto bodyStart = buf.writer_index();
+        auto bodyLen_ = static_cast<uint32_t>(body->encodedSize());
+        buf.ensure_writable(12 + bodyLen_);
+        auto out = buf.claim(12);
+        out.write_u32(msgType);
+        out.write_u32(version);
+        out.write_u32(bodyLen_);
         body->encode(buf);
-        auto bodyEnd = buf.writer_index();
-        auto bodyLen_ = static_cast<unsigned int>(bodyEnd - bodyStart);
-        buf.write_u32_at(msgBodyLenPos, bodyLen_);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but a msgType without a body returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
         msgType = buf.read_u32();
         version = buf.read_u32();
         msgBodyLen = buf.read_u32();
-        body = RcBinaryMessageFactory::getInstance().create(msgType);
-        body->decode(buf);
+        switch(msgType) {
+            case 100101:
+                body.emplace<NewOrder>().decode(buf);
+                break;
+            case 200102:
+                body.emplace<OrderConfirm>().decode(buf);
+                break;
+            case 200115:
+                body.emplace<ExecutionReport>().decode(buf);
+                break;
+            case 190007:
+                body.emplace<OrderCancel>().decode(buf);
+                break;
+            case 290008:
+                body.emplace<CancelReject>().decode(buf);
+                break;
+            case 800001:
+                body.emplace<RiskResult>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 12 + body->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const RcBinary*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(RcBinary)) return false;
+        const auto* checkType = static_cast<const RcBinary*>(&other);
         return msgType == checkType->msgType
                && version == checkType->version
                && msgBodyLen == checkType->msgBodyLen
@@ -447,4 +709,91 @@ inline std::ostream& operator<<(std::ostream& os, const RcBinary& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded RcBinary frame: header fields, the body bytes and the trailer,
+// without decoding the body. Pair it with the body type's own View to route on a few fields.
+class RcBinaryView {
+public:
+    static constexpr size_t kHeaderSize = 12;
+    static constexpr size_t kTrailerSize = 0;
+
+    explicit RcBinaryView(const ByteBufView& buf)
+        : data_(buf.data() + buf.reader_index()), size_(buf.readable_bytes()) {
+        if(size_ < kHeaderSize || size_ < frameSize()) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t msgType() const { return DefaultByteOrder::load<uint32_t>(data_ + 0); }
+    uint32_t version() const { return DefaultByteOrder::load<uint32_t>(data_ + 4); }
+    uint32_t msgBodyLen() const { return DefaultByteOrder::load<uint32_t>(data_ + 8); }
+    ByteBufView body() const { return ByteBufView(data_ + kHeaderSize, msgBodyLen()); }
+    size_t frameSize() const { return kHeaderSize + msgBodyLen() + kTrailerSize; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+};
+
+// RcBinary with the body type fixed at compile time: same wire format, but the body is held
+// by value and its encode/decode/encodedSize calls bind statically, so the whole frame encode
+// can be inlined. Still a codec::BinaryCodec for callers that only have the virtual interface.
+template <typename Body>
+struct RcBinaryFrame final : public codec::BinaryCodec {
+    uint32_t msgType;
+    uint32_t version;
+    uint32_t msgBodyLen;
+    Body body;
+
+    void encode(ByteBuf& buf) const override {
+        auto bodyLen_ = static_cast<uint32_t>(body.encodedSize());
+        buf.ensure_writable(12 + bodyLen_);
+        auto out = buf.claim(12);
+        out.write_u32(msgType);
+        out.write_u32(version);
+        out.write_u32(bodyLen_);
+        body.encode(buf);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        msgType = buf.read_u32();
+        version = buf.read_u32();
+        msgBodyLen = buf.read_u32();
+        body.decode(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 12 + body.encodedSize();
+    }
+    
+
+    bool equals(const BinaryCodec& other) const override {
+        if(typeid(other) != typeid(RcBinaryFrame)) return false;
+        const auto* checkType = static_cast<const RcBinaryFrame*>(&other);
+        return msgType == checkType->msgType
+               && version == checkType->version
+               && msgBodyLen == checkType->msgBodyLen
+               && body.equals(checkType->body);
+    }
+    
+    std::string toString() const override {
+        std::ostringstream oss;
+        oss << "RcBinary { "
+        << "MsgType: " << std::to_string(msgType)
+        << ", "
+        << "Version: " << std::to_string(version)
+        << ", "
+        << "MsgBodyLen: " << std::to_string(msgBodyLen)
+        << ", "
+        << "Body: " << body.toString()
+        << " }";
+        return oss.str();
+    }
+    
+};
+
+template <typename Body>
+inline std::ostream& operator<<(std::ostream& os, const RcBinaryFrame<Body>& pkt) {
+    return os << pkt.toString();
+}
+
 
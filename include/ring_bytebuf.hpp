@@ -0,0 +1,140 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "bytebuf.hpp"
+
+// Fixed-capacity receive buffer for long-lived sessions. The producer appends at the writer end
+// (recv() into write_ptr(), then commit()); the consumer reads through the usual ByteBufView API,
+// so generated decode() runs on it directly, and discard_read_bytes() hands consumed space back.
+//
+// On Linux the storage is one memfd mapped twice back to back, so the readable and writable
+// regions are always contiguous and neither reads nor writes ever wrap. Where that mapping is not
+// available the buffer falls back to plain memory and discard_read_bytes() moves the unread tail
+// to the front instead. Either way memory use stays at capacity() for the life of the session.
+class RingByteBuf : public ByteBufView {
+ public:
+  explicit RingByteBuf(size_t capacity = 64 * 1024) {
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    capacity_ = (capacity + page - 1) / page * page;
+    if (capacity_ == 0) capacity_ = page;
+    mirrored_ = map_mirrored();
+    if (!mirrored_) base_ = new uint8_t[capacity_];
+    data_ = base_;
+    size_ = 0;
+    reader_index_ = 0;
+  }
+
+  RingByteBuf(const RingByteBuf&) = delete;
+  RingByteBuf& operator=(const RingByteBuf&) = delete;
+
+  RingByteBuf(RingByteBuf&& other) noexcept
+      : ByteBufView(other), base_(other.base_), capacity_(other.capacity_),
+        mirrored_(other.mirrored_) {
+    other.base_ = nullptr;
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.reader_index_ = 0;
+  }
+
+  ~RingByteBuf() { release(); }
+
+  size_t capacity() const { return capacity_; }
+  bool mirrored() const { return mirrored_; }
+
+  // Free space after the writer index. Consumed bytes count towards it only once discarded.
+  size_t writable_bytes() const { return capacity_ - size_; }
+
+  // Contiguous space for the next writable_bytes() bytes, e.g. the target of a recv() call.
+  uint8_t* write_ptr() { return const_cast<uint8_t*>(data_) + size_; }
+
+  // Publishes `len` bytes written through write_ptr() to the reader.
+  void commit(size_t len) {
+    check_write(len);
+    size_ += len;
+  }
+
+  void write_bytes(const void* data, size_t len) {
+    check_write(len);
+    std::memcpy(write_ptr(), data, len);
+    size_ += len;
+  }
+
+  // Releases the bytes already read so the producer can reuse their space. Call it between
+  // frames: views and spans into the consumed region are invalid afterwards.
+  void discard_read_bytes() {
+    if (reader_index_ == 0) return;
+    size_t start = static_cast<size_t>(data_ - base_) + reader_index_;
+    size_ -= reader_index_;
+    reader_index_ = 0;
+    if (mirrored_) {
+      data_ = base_ + (start % capacity_);
+    } else {
+      if (size_ > 0) std::memmove(base_, base_ + start, size_);
+      data_ = base_;
+    }
+  }
+
+  void reset() {
+    data_ = base_;
+    size_ = 0;
+    reader_index_ = 0;
+  }
+
+ private:
+  void check_write(size_t len) const {
+    if (len > writable_bytes()) {
+      throw std::out_of_range("Not enough space to write");
+    }
+  }
+
+  // Reserves 2 * capacity of address space, then maps the same memfd pages over both halves.
+  bool map_mirrored() {
+#if defined(__linux__)
+    int fd = memfd_create("fin-proto-ring", MFD_CLOEXEC);
+    if (fd < 0) return false;
+    bool ok = false;
+    void* region = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(capacity_)) == 0) {
+      region = mmap(nullptr, 2 * capacity_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    if (region != MAP_FAILED) {
+      auto* lo = static_cast<uint8_t*>(region);
+      void* first = mmap(lo, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+      void* second =
+          mmap(lo + capacity_, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+      ok = first == lo && second == lo + capacity_;
+      if (ok) {
+        base_ = lo;
+      } else {
+        munmap(region, 2 * capacity_);
+      }
+    }
+    close(fd);
+    return ok;
+#else
+    return false;
+#endif
+  }
+
+  void release() {
+    if (base_ == nullptr) return;
+    if (mirrored_) {
+      munmap(base_, 2 * capacity_);
+    } else {
+      delete[] base_;
+    }
+    base_ = nullptr;
+  }
+
+  uint8_t* base_ = nullptr;
+  size_t capacity_ = 0;
+  bool mirrored_ = false;
+};
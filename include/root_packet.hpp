@@ -6,15 +6,18 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 #include <iostream>
 #include "include/codec.hpp"
 #include "include/bytebuf.hpp"
 #include "include/checksum.hpp"
+#include "include/stream_framer.hpp"
 #include "message_factory.hpp"
 
-struct BasicPacket : public codec::BinaryCodec {
+struct BasicPacket final : public codec::BinaryCodec {
     int8_t fieldI8;
     int16_t fieldI16;
     int32_t fieldI32;
@@ -26,30 +29,56 @@ struct BasicPacket : public codec::BinaryCodec {
     uint64_t fieldU64;
     float fieldF32;
     double fieldF64;
-    std::vector<int8_t> fieldI8List;
-    std::vector<int16_t> fieldI16List;
-    std::vector<int32_t> fieldI32List;
-    std::vector<int64_t> fieldI64List;
-    std::vector<std::string> fieldCharList;
-    std::vector<uint8_t> fieldU8List;
-    std::vector<uint16_t> fieldU16List;
-    std::vector<uint32_t> fieldU32List;
-    std::vector<uint64_t> fieldU64List;
-    std::vector<float> fieldF32List;
-    std::vector<double> fieldF64List;
+    codec::List<int8_t> fieldI8List;
+    codec::List<int16_t> fieldI16List;
+    codec::List<int32_t> fieldI32List;
+    codec::List<int64_t> fieldI64List;
+    codec::StringList fieldCharList;
+    codec::List<uint8_t> fieldU8List;
+    codec::List<uint16_t> fieldU16List;
+    codec::List<uint32_t> fieldU32List;
+    codec::List<uint64_t> fieldU64List;
+    codec::List<float> fieldF32List;
+    codec::List<double> fieldF64List;
+
+    enum class Field : uint8_t {
+        fieldI8,
+        fieldI16,
+        fieldI32,
+        fieldI64,
+        fieldChar,
+        fieldU8,
+        fieldU16,
+        fieldU32,
+        fieldU64,
+        fieldF32,
+        fieldF64,
+        fieldI8List,
+        fieldI16List,
+        fieldI32List,
+        fieldI64List,
+        fieldCharList,
+        fieldU8List,
+        fieldU16List,
+        fieldU32List,
+        fieldU64List,
+        fieldF32List,
+        fieldF64List,
+    };
 
     void encode(ByteBuf& buf) const override {
-        buf.write_i8(fieldI8);
-        buf.write_i16_le(fieldI16);
-        buf.write_i32_le(fieldI32);
-        buf.write_i64_le(fieldI64);
-        codec::write_fixed_string(buf, fieldChar, 1, '0', true);
-        buf.write_u8(fieldU8);
-        buf.write_u16_le(fieldU16);
-        buf.write_u32_le(fieldU32);
-        buf.write_u64_le(fieldU64);
-        buf.write_f32_le(fieldF32);
-        buf.write_f64_le(fieldF64);
+        auto out = buf.claim(43);
+        out.write_i8(fieldI8);
+        out.write_i16_le(fieldI16);
+        out.write_i32_le(fieldI32);
+        out.write_i64_le(fieldI64);
+        codec::write_fixed_string(out, fieldChar, 1, '0', true);
+        out.write_u8(fieldU8);
+        out.write_u16_le(fieldU16);
+        out.write_u32_le(fieldU32);
+        out.write_u64_le(fieldU64);
+        out.write_f32_le(fieldF32);
+        out.write_f64_le(fieldF64);
         codec::write_basic_type_le<uint16_t,int8_t>(buf,fieldI8List);
         codec::write_basic_type_le<uint16_t,int16_t>(buf,fieldI16List);
         codec::write_basic_type_le<uint16_t,int32_t>(buf,fieldI32List);
@@ -64,7 +93,7 @@ struct BasicPacket : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         fieldI8 = buf.read_i8();
         fieldI16 = buf.read_i16_le();
         fieldI32 = buf.read_i32_le();
@@ -76,23 +105,89 @@ struct BasicPacket : public codec::BinaryCodec {
         fieldU64 = buf.read_u64_le();
         fieldF32 = buf.read_f32_le();
         fieldF64 = buf.read_f64_le();
-        fieldI8List = codec::read_basic_type_le<uint16_t,int8_t>(buf);
-        fieldI16List = codec::read_basic_type_le<uint16_t,int16_t>(buf);
-        fieldI32List = codec::read_basic_type_le<uint16_t,int32_t>(buf);
-        fieldI64List = codec::read_basic_type_le<uint16_t,int64_t>(buf);
-        fieldCharList = codec::read_fixed_string_list_le<uint16_t>(buf, 1, '0', true);
-        fieldU8List = codec::read_basic_type_le<uint16_t,uint8_t>(buf);
-        fieldU16List = codec::read_basic_type_le<uint16_t,uint16_t>(buf);
-        fieldU32List = codec::read_basic_type_le<uint16_t,uint32_t>(buf);
-        fieldU64List = codec::read_basic_type_le<uint16_t,uint64_t>(buf);
-        fieldF32List = codec::read_basic_type_le<uint16_t,float>(buf);
-        fieldF64List = codec::read_basic_type_le<uint16_t,double>(buf);
+        fieldI8List = codec::read_basic_type_le<uint16_t,int8_t,codec::List<int8_t>>(buf);
+        fieldI16List = codec::read_basic_type_le<uint16_t,int16_t,codec::List<int16_t>>(buf);
+        fieldI32List = codec::read_basic_type_le<uint16_t,int32_t,codec::List<int32_t>>(buf);
+        fieldI64List = codec::read_basic_type_le<uint16_t,int64_t,codec::List<int64_t>>(buf);
+        fieldCharList = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 1, '0', true);
+        fieldU8List = codec::read_basic_type_le<uint16_t,uint8_t,codec::List<uint8_t>>(buf);
+        fieldU16List = codec::read_basic_type_le<uint16_t,uint16_t,codec::List<uint16_t>>(buf);
+        fieldU32List = codec::read_basic_type_le<uint16_t,uint32_t,codec::List<uint32_t>>(buf);
+        fieldU64List = codec::read_basic_type_le<uint16_t,uint64_t,codec::List<uint64_t>>(buf);
+        fieldF32List = codec::read_basic_type_le<uint16_t,float,codec::List<float>>(buf);
+        fieldF64List = codec::read_basic_type_le<uint16_t,double,codec::List<double>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::fieldI8)) fieldI8 = buf.read_i8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::fieldI16)) fieldI16 = buf.read_i16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::fieldI32)) fieldI32 = buf.read_i32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::fieldI64)) fieldI64 = buf.read_i64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::fieldChar)) fieldChar = codec::read_fixed_string(buf, 1, '0', true);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::fieldU8)) fieldU8 = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::fieldU16)) fieldU16 = buf.read_u16_le();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::fieldU32)) fieldU32 = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::fieldU64)) fieldU64 = buf.read_u64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::fieldF32)) fieldF32 = buf.read_f32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::fieldF64)) fieldF64 = buf.read_f64_le();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::fieldI8List)) fieldI8List = codec::read_basic_type_le<uint16_t,int8_t,codec::List<int8_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,int8_t>(buf);
+        if(mask.has(Field::fieldI16List)) fieldI16List = codec::read_basic_type_le<uint16_t,int16_t,codec::List<int16_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,int16_t>(buf);
+        if(mask.has(Field::fieldI32List)) fieldI32List = codec::read_basic_type_le<uint16_t,int32_t,codec::List<int32_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,int32_t>(buf);
+        if(mask.has(Field::fieldI64List)) fieldI64List = codec::read_basic_type_le<uint16_t,int64_t,codec::List<int64_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,int64_t>(buf);
+        if(mask.has(Field::fieldCharList)) fieldCharList = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 1, '0', true);
+        else codec::skip_fixed_string_list_le<uint16_t>(buf, 1);
+        if(mask.has(Field::fieldU8List)) fieldU8List = codec::read_basic_type_le<uint16_t,uint8_t,codec::List<uint8_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,uint8_t>(buf);
+        if(mask.has(Field::fieldU16List)) fieldU16List = codec::read_basic_type_le<uint16_t,uint16_t,codec::List<uint16_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,uint16_t>(buf);
+        if(mask.has(Field::fieldU32List)) fieldU32List = codec::read_basic_type_le<uint16_t,uint32_t,codec::List<uint32_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,uint32_t>(buf);
+        if(mask.has(Field::fieldU64List)) fieldU64List = codec::read_basic_type_le<uint16_t,uint64_t,codec::List<uint64_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,uint64_t>(buf);
+        if(mask.has(Field::fieldF32List)) fieldF32List = codec::read_basic_type_le<uint16_t,float,codec::List<float>>(buf);
+        else codec::skip_basic_type_le<uint16_t,float>(buf);
+        if(mask.has(Field::fieldF64List)) fieldF64List = codec::read_basic_type_le<uint16_t,double,codec::List<double>>(buf);
+        else codec::skip_basic_type_le<uint16_t,double>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 43
+               + codec::basic_type_list_size<uint16_t, int8_t>(fieldI8List)
+               + codec::basic_type_list_size<uint16_t, int16_t>(fieldI16List)
+               + codec::basic_type_list_size<uint16_t, int32_t>(fieldI32List)
+               + codec::basic_type_list_size<uint16_t, int64_t>(fieldI64List)
+               + codec::fixed_string_list_size<uint16_t>(fieldCharList, 1)
+               + codec::basic_type_list_size<uint16_t, uint8_t>(fieldU8List)
+               + codec::basic_type_list_size<uint16_t, uint16_t>(fieldU16List)
+               + codec::basic_type_list_size<uint16_t, uint32_t>(fieldU32List)
+               + codec::basic_type_list_size<uint16_t, uint64_t>(fieldU64List)
+               + codec::basic_type_list_size<uint16_t, float>(fieldF32List)
+               + codec::basic_type_list_size<uint16_t, double>(fieldF64List);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const BasicPacket*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(BasicPacket)) return false;
+        const auto* checkType = static_cast<const BasicPacket*>(&other);
         return fieldI8 == checkType->fieldI8
                && fieldI16 == checkType->fieldI16
                && fieldI32 == checkType->fieldI32
@@ -150,7 +245,7 @@ struct BasicPacket : public codec::BinaryCodec {
         << ", "
         << "fieldI64List: " << codec::join_vector<int64_t>(fieldI64List)
         << ", "
-        << "fieldCharList: " << codec::join_vector<std::string>(fieldCharList)
+        << "fieldCharList: " << codec::join_vector<codec::ListString>(fieldCharList)
         << ", "
         << "fieldU8List: " << codec::join_vector<uint8_t>(fieldU8List)
         << ", "
@@ -173,25 +268,65 @@ inline std::ostream& operator<<(std::ostream& os, const BasicPacket& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded BasicPacket: each accessor decodes one field in place from the
+// wire bytes. Covers the first 43 bytes, the part of the layout with fixed offsets.
+class BasicPacketView {
+public:
+    static constexpr size_t kFixedSize = 43;
+
+    explicit BasicPacketView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    int8_t fieldI8() const { return DefaultByteOrder::load<int8_t>(data_ + 0); }
+    int16_t fieldI16() const { return LittleEndian::load<int16_t>(data_ + 1); }
+    int32_t fieldI32() const { return LittleEndian::load<int32_t>(data_ + 3); }
+    int64_t fieldI64() const { return LittleEndian::load<int64_t>(data_ + 7); }
+    std::string_view fieldChar() const { return codec::fixed_string_view(data_ + 15, 1, '0', true); }
+    uint8_t fieldU8() const { return DefaultByteOrder::load<uint8_t>(data_ + 16); }
+    uint16_t fieldU16() const { return LittleEndian::load<uint16_t>(data_ + 17); }
+    uint32_t fieldU32() const { return LittleEndian::load<uint32_t>(data_ + 19); }
+    uint64_t fieldU64() const { return LittleEndian::load<uint64_t>(data_ + 23); }
+    float fieldF32() const { return LittleEndian::load<float>(data_ + 31); }
+    double fieldF64() const { return LittleEndian::load<double>(data_ + 35); }
+
+private:
+    const uint8_t* data_;
+};
+
 
-struct StringPacket : public codec::BinaryCodec {
+struct StringPacket final : public codec::BinaryCodec {
     std::string fieldDynamicString;
     std::string fieldDynamicString1;
     std::string fieldFixedString1;
     std::string fieldFixedString10;
     std::string fieldFixedString10Pad;
-    std::vector<std::string> fieldDynamicStringList;
-    std::vector<std::string> fieldDynamicString1List;
-    std::vector<std::string> fieldFixedString1List;
-    std::vector<std::string> fieldFixedString10List;
-    std::vector<std::string> fieldFixedString10ListPad;
+    codec::StringList fieldDynamicStringList;
+    codec::StringList fieldDynamicString1List;
+    codec::StringList fieldFixedString1List;
+    codec::StringList fieldFixedString10List;
+    codec::StringList fieldFixedString10ListPad;
+
+    enum class Field : uint8_t {
+        fieldDynamicString,
+        fieldDynamicString1,
+        fieldFixedString1,
+        fieldFixedString10,
+        fieldFixedString10Pad,
+        fieldDynamicStringList,
+        fieldDynamicString1List,
+        fieldFixedString1List,
+        fieldFixedString10List,
+        fieldFixedString10ListPad,
+    };
 
     void encode(ByteBuf& buf) const override {
         codec::write_string_le<uint16_t>(buf, fieldDynamicString);
         codec::write_string_le<uint16_t>(buf, fieldDynamicString1);
-        codec::write_fixed_string(buf, fieldFixedString1, 1, '0', true);
-        codec::write_fixed_string(buf, fieldFixedString10, 10, '0', true);
-        codec::write_fixed_string(buf, fieldFixedString10Pad, 10, ' ', true);
+        auto out = buf.claim(21);
+        codec::write_fixed_string(out, fieldFixedString1, 1, '0', true);
+        codec::write_fixed_string(out, fieldFixedString10, 10, '0', true);
+        codec::write_fixed_string(out, fieldFixedString10Pad, 10, ' ', true);
         codec::write_string_list_le<uint16_t,uint16_t>(buf, fieldDynamicStringList);
         codec::write_string_list_le<uint16_t,uint16_t>(buf, fieldDynamicString1List);
         codec::write_fixed_string_list_le<uint16_t>(buf, fieldFixedString1List, 1, '0', true);
@@ -200,23 +335,61 @@ struct StringPacket : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         fieldDynamicString = codec::read_string_le<uint16_t>(buf);
         fieldDynamicString1 = codec::read_string_le<uint16_t>(buf);
         fieldFixedString1 = codec::read_fixed_string(buf, 1, '0', true);
         fieldFixedString10 = codec::read_fixed_string(buf, 10, '0', true);
         fieldFixedString10Pad = codec::read_fixed_string(buf, 10, ' ', true);
-        fieldDynamicStringList = codec::read_string_list_le<uint16_t,uint16_t>(buf);
-        fieldDynamicString1List = codec::read_string_list_le<uint16_t,uint16_t>(buf);
-        fieldFixedString1List = codec::read_fixed_string_list_le<uint16_t>(buf, 1, '0', true);
-        fieldFixedString10List = codec::read_fixed_string_list_le<uint16_t>(buf, 10, '0', true);
-        fieldFixedString10ListPad = codec::read_fixed_string_list_le<uint16_t>(buf, 10, '0', false);
+        fieldDynamicStringList = codec::read_string_list_le<uint16_t,uint16_t,codec::StringList>(buf);
+        fieldDynamicString1List = codec::read_string_list_le<uint16_t,uint16_t,codec::StringList>(buf);
+        fieldFixedString1List = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 1, '0', true);
+        fieldFixedString10List = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 10, '0', true);
+        fieldFixedString10ListPad = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 10, '0', false);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::fieldDynamicString)) fieldDynamicString = codec::read_string_le<uint16_t>(buf);
+        else codec::skip_string_le<uint16_t>(buf);
+        if(mask.has(Field::fieldDynamicString1)) fieldDynamicString1 = codec::read_string_le<uint16_t>(buf);
+        else codec::skip_string_le<uint16_t>(buf);
+        if(mask.has(Field::fieldFixedString1)) fieldFixedString1 = codec::read_fixed_string(buf, 1, '0', true);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::fieldFixedString10)) fieldFixedString10 = codec::read_fixed_string(buf, 10, '0', true);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::fieldFixedString10Pad)) fieldFixedString10Pad = codec::read_fixed_string(buf, 10, ' ', true);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::fieldDynamicStringList)) fieldDynamicStringList = codec::read_string_list_le<uint16_t,uint16_t,codec::StringList>(buf);
+        else codec::skip_string_list_le<uint16_t,uint16_t>(buf);
+        if(mask.has(Field::fieldDynamicString1List)) fieldDynamicString1List = codec::read_string_list_le<uint16_t,uint16_t,codec::StringList>(buf);
+        else codec::skip_string_list_le<uint16_t,uint16_t>(buf);
+        if(mask.has(Field::fieldFixedString1List)) fieldFixedString1List = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 1, '0', true);
+        else codec::skip_fixed_string_list_le<uint16_t>(buf, 1);
+        if(mask.has(Field::fieldFixedString10List)) fieldFixedString10List = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 10, '0', true);
+        else codec::skip_fixed_string_list_le<uint16_t>(buf, 10);
+        if(mask.has(Field::fieldFixedString10ListPad)) fieldFixedString10ListPad = codec::read_fixed_string_list_le<uint16_t,codec::StringList>(buf, 10, '0', false);
+        else codec::skip_fixed_string_list_le<uint16_t>(buf, 10);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 21
+               + codec::string_size<uint16_t>(fieldDynamicString)
+               + codec::string_size<uint16_t>(fieldDynamicString1)
+               + codec::string_list_size<uint16_t, uint16_t>(fieldDynamicStringList)
+               + codec::string_list_size<uint16_t, uint16_t>(fieldDynamicString1List)
+               + codec::fixed_string_list_size<uint16_t>(fieldFixedString1List, 1)
+               + codec::fixed_string_list_size<uint16_t>(fieldFixedString10List, 10)
+               + codec::fixed_string_list_size<uint16_t>(fieldFixedString10ListPad, 10);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const StringPacket*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(StringPacket)) return false;
+        const auto* checkType = static_cast<const StringPacket*>(&other);
         return fieldDynamicString == checkType->fieldDynamicString
                && fieldDynamicString1 == checkType->fieldDynamicString1
                && fieldFixedString1 == checkType->fieldFixedString1
@@ -242,15 +415,15 @@ struct StringPacket : public codec::BinaryCodec {
         << ", "
         << "fieldFixedString10Pad: " << fieldFixedString10Pad
         << ", "
-        << "fieldDynamicStringList: " << codec::join_vector<std::string>(fieldDynamicStringList)
+        << "fieldDynamicStringList: " << codec::join_vector<codec::ListString>(fieldDynamicStringList)
         << ", "
-        << "fieldDynamicString1List: " << codec::join_vector<std::string>(fieldDynamicString1List)
+        << "fieldDynamicString1List: " << codec::join_vector<codec::ListString>(fieldDynamicString1List)
         << ", "
-        << "fieldFixedString1List: " << codec::join_vector<std::string>(fieldFixedString1List)
+        << "fieldFixedString1List: " << codec::join_vector<codec::ListString>(fieldFixedString1List)
         << ", "
-        << "fieldFixedString10List: " << codec::join_vector<std::string>(fieldFixedString10List)
+        << "fieldFixedString10List: " << codec::join_vector<codec::ListString>(fieldFixedString10List)
         << ", "
-        << "fieldFixedString10ListPad: " << codec::join_vector<std::string>(fieldFixedString10ListPad)
+        << "fieldFixedString10ListPad: " << codec::join_vector<codec::ListString>(fieldFixedString10ListPad)
         << " }";
         return oss.str();
     }
@@ -262,9 +435,14 @@ inline std::ostream& operator<<(std::ostream& os, const StringPacket& pkt) {
 }
 
 
-struct SubPacket : public codec::BinaryCodec {
+struct SubPacket final : public codec::BinaryCodec {
     uint32_t fieldU32;
-    std::vector<int16_t> fieldI16List;
+    codec::List<int16_t> fieldI16List;
+
+    enum class Field : uint8_t {
+        fieldU32,
+        fieldI16List,
+    };
 
     void encode(ByteBuf& buf) const override {
         buf.write_u32_le(fieldU32);
@@ -272,15 +450,31 @@ struct SubPacket : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         fieldU32 = buf.read_u32_le();
-        fieldI16List = codec::read_basic_type_le<uint16_t,int16_t>(buf);
+        fieldI16List = codec::read_basic_type_le<uint16_t,int16_t,codec::List<int16_t>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::fieldU32)) fieldU32 = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::fieldI16List)) fieldI16List = codec::read_basic_type_le<uint16_t,int16_t,codec::List<int16_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,int16_t>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 4
+               + codec::basic_type_list_size<uint16_t, int16_t>(fieldI16List);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const SubPacket*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(SubPacket)) return false;
+        const auto* checkType = static_cast<const SubPacket*>(&other);
         return fieldU32 == checkType->fieldU32
                && fieldI16List == checkType->fieldI16List;
     }
@@ -301,11 +495,32 @@ inline std::ostream& operator<<(std::ostream& os, const SubPacket& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded SubPacket: each accessor decodes one field in place from the
+// wire bytes. Covers the first 4 bytes, the part of the layout with fixed offsets.
+class SubPacketView {
+public:
+    static constexpr size_t kFixedSize = 4;
+
+    explicit SubPacketView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t fieldU32() const { return LittleEndian::load<uint32_t>(data_ + 0); }
+
+private:
+    const uint8_t* data_;
+};
+
 
 
-struct InerPacket : public codec::BinaryCodec {
+struct InerPacket final : public codec::BinaryCodec {
     uint32_t fieldU32;
-    std::vector<int16_t> fieldI16List;
+    codec::List<int16_t> fieldI16List;
+
+    enum class Field : uint8_t {
+        fieldU32,
+        fieldI16List,
+    };
 
     void encode(ByteBuf& buf) const override {
         buf.write_u32_le(fieldU32);
@@ -313,15 +528,31 @@ struct InerPacket : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         fieldU32 = buf.read_u32_le();
-        fieldI16List = codec::read_basic_type_le<uint16_t,int16_t>(buf);
+        fieldI16List = codec::read_basic_type_le<uint16_t,int16_t,codec::List<int16_t>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::fieldU32)) fieldU32 = buf.read_u32_le();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::fieldI16List)) fieldI16List = codec::read_basic_type_le<uint16_t,int16_t,codec::List<int16_t>>(buf);
+        else codec::skip_basic_type_le<uint16_t,int16_t>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 4
+               + codec::basic_type_list_size<uint16_t, int16_t>(fieldI16List);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const InerPacket*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(InerPacket)) return false;
+        const auto* checkType = static_cast<const InerPacket*>(&other);
         return fieldU32 == checkType->fieldU32
                && fieldI16List == checkType->fieldI16List;
     }
@@ -342,12 +573,34 @@ inline std::ostream& operator<<(std::ostream& os, const InerPacket& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded InerPacket: each accessor decodes one field in place from the
+// wire bytes. Covers the first 4 bytes, the part of the layout with fixed offsets.
+class InerPacketView {
+public:
+    static constexpr size_t kFixedSize = 4;
+
+    explicit InerPacketView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t fieldU32() const { return LittleEndian::load<uint32_t>(data_ + 0); }
+
+private:
+    const uint8_t* data_;
+};
 
-struct NestedPacket : public codec::BinaryCodec {
+
+struct NestedPacket final : public codec::BinaryCodec {
     SubPacket subPacket;
-    std::vector<SubPacket> subPacketList;
+    codec::List<SubPacket> subPacketList;
     InerPacket inerPacket;
 
+    enum class Field : uint8_t {
+        subPacket,
+        subPacketList,
+        inerPacket,
+    };
+
     void encode(ByteBuf& buf) const override {
         subPacket.encode(buf);
         codec::write_object_List_le<uint16_t>(buf,subPacketList);
@@ -355,16 +608,35 @@ struct NestedPacket : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         subPacket.decode(buf);
-        subPacketList = codec::read_object_List_le<uint16_t,SubPacket>(buf);
+        subPacketList = codec::read_object_List_le<uint16_t,SubPacket,codec::List<SubPacket>>(buf);
         inerPacket.decode(buf);
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::subPacket)) subPacket.decode(buf);
+        else subPacket.decode(buf, codec::FieldMask<SubPacket::Field>());
+        if(mask.has(Field::subPacketList)) subPacketList = codec::read_object_List_le<uint16_t,SubPacket,codec::List<SubPacket>>(buf);
+        else codec::skip_object_List_le<uint16_t,SubPacket>(buf);
+        if(mask.has(Field::inerPacket)) inerPacket.decode(buf);
+        else inerPacket.decode(buf, codec::FieldMask<InerPacket::Field>());
+    }
+    
+
+    size_t encodedSize() const override {
+        return subPacket.encodedSize()
+               + codec::object_list_size<uint16_t>(subPacketList)
+               + inerPacket.encodedSize();
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const NestedPacket*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(NestedPacket)) return false;
+        const auto* checkType = static_cast<const NestedPacket*>(&other);
         return subPacket == checkType->subPacket
                && subPacketList == checkType->subPacketList
                && inerPacket == checkType->inerPacket;
@@ -390,20 +662,30 @@ inline std::ostream& operator<<(std::ostream& os, const NestedPacket& pkt) {
 
 
 
-struct EmptyPacket : public codec::BinaryCodec {
+struct EmptyPacket final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const EmptyPacket*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(EmptyPacket);
     }
     
     std::string toString() const override {
@@ -422,49 +704,104 @@ inline std::ostream& operator<<(std::ostream& os, const EmptyPacket& pkt) {
 
 struct RootPacketTag{};
 using RootPacketMessageFactory = MessageFactory<uint16_t, codec::BinaryCodec, RootPacketTag>;
-REGISTER_MESSAGE(RootPacketMessageFactory, 1, BasicPacket);
-REGISTER_MESSAGE(RootPacketMessageFactory, 2, StringPacket);
-REGISTER_MESSAGE(RootPacketMessageFactory, 3, NestedPacket);
-REGISTER_MESSAGE(RootPacketMessageFactory, 4, EmptyPacket);
+template <>
+struct GeneratedMessages<RootPacketTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(uint16_t key) {
+        switch(key) {
+            case 1:
+                return std::make_unique<BasicPacket>();
+            case 2:
+                return std::make_unique<StringPacket>();
+            case 3:
+                return std::make_unique<NestedPacket>();
+            case 4:
+                return std::make_unique<EmptyPacket>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using RootPacketPayload = codec::InlineMessage<BasicPacket, StringPacket, NestedPacket, EmptyPacket>;
+
 
+// Header/length/trailer layout of a RootPacket frame, for codec::StreamFramer.
+inline constexpr codec::FrameSpec RootPacketFrameSpec{6, 2, 4};
 
-struct RootPacket : public codec::BinaryCodec {
+// Decode-time checksum verification for RootPacket frames (off unless enabled with setMode()).
+inline ChecksumVerifier<uint32_t> RootPacketChecksumVerifier;
+
+struct RootPacket final : public codec::BinaryCodec {
     uint16_t msgType;
     uint32_t payloadLen;
-    std::unique_ptr<codec::BinaryCodec> payload;
+    RootPacketPayload payload;
     uint32_t checksum;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u16_le(msgType);
-        auto payloadLenPos = buf.writer_index();
-        buf.write_u32_le(0);
-        auto payloadStart = buf.writer_index();
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("CRC32");
+        ChecksumWriteTap<uint32_t> checksumTap(checksumHandle.get(), buf);
+        auto payloadLen_ = static_cast<uint32_t>(payload->encodedSize());
+        buf.ensure_writable(10 + payloadLen_);
+        auto out = buf.claim(6);
+        out.write_u16_le(msgType);
+        out.write_u32_le(payloadLen_);
         payload->encode(buf);
-        auto payloadEnd = buf.writer_index();
-        auto payloadLen_ = static_cast<unsigned int>(payloadEnd - payloadStart);
-        buf.write_u32_le_at(payloadLenPos, payloadLen_);
-        auto service = ChecksumServiceContext::instance().get<ByteBuf, uint32_t>("CRC32");
-        if(service != nullptr){
-            auto cs = service->calc(buf);
-            buf.write_u32_le(cs);
+        if(checksumTap.enabled()){
+            buf.write_u32_le(checksumTap.value());
         } else {
             buf.write_u32_le(checksum);
         }
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but a msgType without a body returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("CRC32");
+        ChecksumReadTap<uint32_t> checksumTap(RootPacketChecksumVerifier.sample() ? checksumHandle.get() : nullptr, buf);
         msgType = buf.read_u16_le();
         payloadLen = buf.read_u32_le();
-        payload = RootPacketMessageFactory::getInstance().create(msgType);
-        payload->decode(buf);
-        checksum = buf.read_u32_le();
+        switch(msgType) {
+            case 1:
+                payload.emplace<BasicPacket>().decode(buf);
+                break;
+            case 2:
+                payload.emplace<StringPacket>().decode(buf);
+                break;
+            case 3:
+                payload.emplace<NestedPacket>().decode(buf);
+                break;
+            case 4:
+                payload.emplace<EmptyPacket>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        if(checksumTap.enabled()){
+            const uint32_t actual = checksumTap.value();
+            checksum = buf.read_u32_le();
+            RootPacketChecksumVerifier.verify(actual, checksum);
+        } else {
+            checksum = buf.read_u32_le();
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 10 + payload->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const RootPacket*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(RootPacket)) return false;
+        const auto* checkType = static_cast<const RootPacket*>(&other);
         return msgType == checkType->msgType
                && payloadLen == checkType->payloadLen
                && payload->equals(*checkType->payload)
@@ -491,4 +828,105 @@ inline std::ostream& operator<<(std::ostream& os, const RootPacket& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded RootPacket frame: header fields, the payload bytes and the trailer,
+// without decoding the payload. Pair it with the payload type's own View to route on a few fields.
+class RootPacketView {
+public:
+    static constexpr size_t kHeaderSize = 6;
+    static constexpr size_t kTrailerSize = 4;
+
+    explicit RootPacketView(const ByteBufView& buf)
+        : data_(buf.data() + buf.reader_index()), size_(buf.readable_bytes()) {
+        if(size_ < kHeaderSize || size_ < frameSize()) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t msgType() const { return LittleEndian::load<uint16_t>(data_ + 0); }
+    uint32_t payloadLen() const { return LittleEndian::load<uint32_t>(data_ + 2); }
+    ByteBufView payload() const { return ByteBufView(data_ + kHeaderSize, payloadLen()); }
+    uint32_t checksum() const { return LittleEndian::load<uint32_t>(data_ + kHeaderSize + payloadLen()); }
+    size_t frameSize() const { return kHeaderSize + payloadLen() + kTrailerSize; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+};
+
+// RootPacket with the payload type fixed at compile time: same wire format, but the payload is held
+// by value and its encode/decode/encodedSize calls bind statically, so the whole frame encode
+// can be inlined. Still a codec::BinaryCodec for callers that only have the virtual interface.
+template <typename Body>
+struct RootPacketFrame final : public codec::BinaryCodec {
+    uint16_t msgType;
+    uint32_t payloadLen;
+    Body payload;
+    uint32_t checksum;
+
+    void encode(ByteBuf& buf) const override {
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("CRC32");
+        ChecksumWriteTap<uint32_t> checksumTap(checksumHandle.get(), buf);
+        auto payloadLen_ = static_cast<uint32_t>(payload.encodedSize());
+        buf.ensure_writable(10 + payloadLen_);
+        auto out = buf.claim(6);
+        out.write_u16_le(msgType);
+        out.write_u32_le(payloadLen_);
+        payload.encode(buf);
+        if(checksumTap.enabled()){
+            buf.write_u32_le(checksumTap.value());
+        } else {
+            buf.write_u32_le(checksum);
+        }
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("CRC32");
+        ChecksumReadTap<uint32_t> checksumTap(RootPacketChecksumVerifier.sample() ? checksumHandle.get() : nullptr, buf);
+        msgType = buf.read_u16_le();
+        payloadLen = buf.read_u32_le();
+        payload.decode(buf);
+        if(checksumTap.enabled()){
+            const uint32_t actual = checksumTap.value();
+            checksum = buf.read_u32_le();
+            RootPacketChecksumVerifier.verify(actual, checksum);
+        } else {
+            checksum = buf.read_u32_le();
+        }
+    }
+    
+
+    size_t encodedSize() const override {
+        return 10 + payload.encodedSize();
+    }
+    
+
+    bool equals(const BinaryCodec& other) const override {
+        if(typeid(other) != typeid(RootPacketFrame)) return false;
+        const auto* checkType = static_cast<const RootPacketFrame*>(&other);
+        return msgType == checkType->msgType
+               && payloadLen == checkType->payloadLen
+               && payload.equals(checkType->payload)
+               && checksum == checkType->checksum;
+    }
+    
+    std::string toString() const override {
+        std::ostringstream oss;
+        oss << "RootPacket { "
+        << "MsgType: " << std::to_string(msgType)
+        << ", "
+        << "PayloadLen: " << std::to_string(payloadLen)
+        << ", "
+        << "Payload: " << payload.toString()
+        << ", "
+        << "Checksum: " << std::to_string(checksum)
+        << " }";
+        return oss.str();
+    }
+    
+};
+
+template <typename Body>
+inline std::ostream& operator<<(std::ostream& os, const RootPacketFrame<Body>& pkt) {
+    return os << pkt.toString();
+}
+
 
@@ -0,0 +1,339 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+
+#include <endian.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Byte kernels behind the fixed-width string and primitive list codecs and the checksum services.
+// The padding and trim kernels pick their vector path at compile time (SSE2 is the x86-64
+// baseline, AVX2 when built with -mavx2 or -march=native). byteswap_copy() and byte_sum() also
+// dispatch at runtime, so a baseline build still gets pshufb/AVX2 on CPUs that have them. Every
+// path is bit-exact with the scalar loop it replaces.
+namespace simd {
+
+namespace detail {
+
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+inline constexpr bool kSwar = true;
+#else
+inline constexpr bool kSwar = false;
+#endif
+
+inline uint64_t broadcast(uint8_t c) { return 0x0101010101010101ULL * c; }
+
+inline uint64_t load_u64(const void* p) {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+template <size_t Width>
+inline void bswap_one(uint8_t* dst, const uint8_t* src) {
+  if constexpr (Width == 2) {
+    uint16_t v;
+    std::memcpy(&v, src, 2);
+    v = __builtin_bswap16(v);
+    std::memcpy(dst, &v, 2);
+  } else if constexpr (Width == 4) {
+    uint32_t v;
+    std::memcpy(&v, src, 4);
+    v = __builtin_bswap32(v);
+    std::memcpy(dst, &v, 4);
+  } else {
+    uint64_t v;
+    std::memcpy(&v, src, 8);
+    v = __builtin_bswap64(v);
+    std::memcpy(dst, &v, 8);
+  }
+}
+
+#if defined(__SSE2__)
+// pshufb control that reverses every Width-byte lane of a 16-byte block.
+template <size_t Width>
+inline __m128i bswap_mask() {
+  if constexpr (Width == 2) {
+    return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  } else if constexpr (Width == 4) {
+    return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  } else {
+    return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  }
+}
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && !defined(__SSSE3__)
+// Baseline builds: the pshufb kernels are compiled for their own target and picked on first use.
+// Each returns how many leading bytes it swapped (a multiple of 16).
+#define SIMD_HAVE_RUNTIME_PSHUFB 1
+template <size_t Width>
+__attribute__((target("ssse3"))) inline size_t byteswap_ssse3(uint8_t* d, const uint8_t* s,
+                                                              size_t bytes) {
+  const __m128i mask16 = bswap_mask<Width>();
+  size_t i = 0;
+  for (; i + 16 <= bytes; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_shuffle_epi8(v, mask16));
+  }
+  return i;
+}
+
+template <size_t Width>
+__attribute__((target("avx2"))) inline size_t byteswap_avx2(uint8_t* d, const uint8_t* s,
+                                                            size_t bytes) {
+  const __m256i mask32 = _mm256_broadcastsi128_si256(bswap_mask<Width>());
+  size_t i = 0;
+  for (; i + 32 <= bytes; i += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), _mm256_shuffle_epi8(v, mask32));
+  }
+  if (i + 16 <= bytes) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i),
+                     _mm_shuffle_epi8(v, _mm256_castsi256_si128(mask32)));
+    i += 16;
+  }
+  return i;
+}
+
+using ByteswapFn = size_t (*)(uint8_t*, const uint8_t*, size_t);
+
+template <size_t Width>
+inline ByteswapFn resolve_byteswap() {
+  if (__builtin_cpu_supports("avx2")) return &byteswap_avx2<Width>;
+  if (__builtin_cpu_supports("ssse3")) return &byteswap_ssse3<Width>;
+  return nullptr;
+}
+#endif
+
+}  // namespace detail
+
+// memset for the short pad runs of fixed-width fields: a couple of overlapping stores instead of
+// a call into libc.
+inline void fill(uint8_t* dst, uint8_t c, size_t len) {
+#if defined(__SSE2__)
+  if (len >= 16) {
+    const __m128i pat = _mm_set1_epi8(static_cast<char>(c));
+    for (size_t i = 0; i + 16 <= len; i += 16) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), pat);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + len - 16), pat);
+    return;
+  }
+#endif
+  if (len >= 8) {
+    uint64_t pat = detail::broadcast(c);
+    for (size_t i = 0; i + 8 <= len; i += 8) std::memcpy(dst + i, &pat, 8);
+    std::memcpy(dst + len - 8, &pat, 8);
+    return;
+  }
+  if (len >= 4) {
+    uint32_t pat = 0x01010101U * c;
+    std::memcpy(dst, &pat, 4);
+    std::memcpy(dst + len - 4, &pat, 4);
+    return;
+  }
+  for (size_t i = 0; i < len; ++i) dst[i] = c;
+}
+
+// Index of the first byte in [p, p + len) that is not `c`, or `len` if there is none.
+inline size_t find_first_not_of(const char* p, size_t len, char c) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i pat32 = _mm256_set1_epi8(c);
+  for (; i + 32 <= len; i += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    uint32_t eq = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, pat32)));
+    if (eq != 0xFFFFFFFFU) return i + __builtin_ctz(~eq);
+  }
+#endif
+#if defined(__SSE2__)
+  const __m128i pat16 = _mm_set1_epi8(c);
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    uint32_t eq = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, pat16)));
+    if (eq != 0xFFFFU) return i + __builtin_ctz(~eq);
+  }
+#endif
+  if constexpr (detail::kSwar) {
+    const uint64_t pat = detail::broadcast(static_cast<uint8_t>(c));
+    for (; i + 8 <= len; i += 8) {
+      uint64_t diff = detail::load_u64(p + i) ^ pat;
+      if (diff != 0) return i + __builtin_ctzll(diff) / 8;
+    }
+  }
+  for (; i < len; ++i) {
+    if (p[i] != c) return i;
+  }
+  return len;
+}
+
+// Length of [p, p + len) once the trailing run of `c` is dropped (0 if every byte is `c`).
+inline size_t find_last_not_of(const char* p, size_t len, char c) {
+  size_t end = len;
+#if defined(__AVX2__)
+  const __m256i pat32 = _mm256_set1_epi8(c);
+  for (; end >= 32; end -= 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + end - 32));
+    uint32_t ne = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, pat32)));
+    if (ne != 0) return end - 32 + (32 - __builtin_clz(ne));
+  }
+#endif
+#if defined(__SSE2__)
+  const __m128i pat16 = _mm_set1_epi8(c);
+  for (; end >= 16; end -= 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + end - 16));
+    uint32_t ne = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, pat16))) & 0xFFFFU;
+    if (ne != 0) return end - 16 + (32 - __builtin_clz(ne));
+  }
+#endif
+  if constexpr (detail::kSwar) {
+    const uint64_t pat = detail::broadcast(static_cast<uint8_t>(c));
+    for (; end >= 8; end -= 8) {
+      uint64_t diff = detail::load_u64(p + end - 8) ^ pat;
+      if (diff != 0) return end - 8 + (64 - __builtin_clzll(diff) + 7) / 8;
+    }
+  }
+  for (; end > 0; --end) {
+    if (p[end - 1] != c) return end;
+  }
+  return 0;
+}
+
+// Copies `count` elements of `Width` bytes from src to dst, reversing the bytes of each one. Runs
+// 32 bytes per step with AVX2 and 16 with SSSE3 (pshufb), then finishes element by element. When
+// the build does not already assume SSSE3, lists of 16 bytes or more go through a kernel chosen
+// from the CPU on first use; shorter ones stay on the inline scalar loop.
+template <size_t Width>
+inline void byteswap_copy(void* dst, const void* src, size_t count) {
+  static_assert(Width == 2 || Width == 4 || Width == 8, "Width must be 2, 4 or 8");
+  auto* d = static_cast<uint8_t*>(dst);
+  const auto* s = static_cast<const uint8_t*>(src);
+  const size_t bytes = count * Width;
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i mask32 = _mm256_broadcastsi128_si256(detail::bswap_mask<Width>());
+  for (; i + 32 <= bytes; i += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), _mm256_shuffle_epi8(v, mask32));
+  }
+#endif
+#if defined(__SSSE3__)
+  const __m128i mask16 = detail::bswap_mask<Width>();
+  for (; i + 16 <= bytes; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_shuffle_epi8(v, mask16));
+  }
+#elif defined(SIMD_HAVE_RUNTIME_PSHUFB)
+  if (bytes >= 16) {
+    static const detail::ByteswapFn fn = detail::resolve_byteswap<Width>();
+    if (fn != nullptr) i = fn(d, s, bytes);
+  }
+#endif
+  for (; i < bytes; i += Width) {
+    detail::bswap_one<Width>(d + i, s + i);
+  }
+}
+
+namespace detail {
+
+inline uint64_t byte_sum_scalar(const uint8_t* p, size_t len) {
+  uint64_t sum = 0;
+  for (size_t i = 0; i < len; ++i) sum += p[i];
+  return sum;
+}
+
+// Eight bytes at a time in a general register: pairs of bytes are added into 16-bit lanes, then
+// one multiply adds up the four lanes. Byte order does not matter for a sum.
+inline uint64_t byte_sum_swar(const uint8_t* p, size_t len) {
+  constexpr uint64_t kLow = 0x00FF00FF00FF00FFULL;
+  uint64_t sum = 0;
+  size_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint64_t v = load_u64(p + i);
+    v = (v & kLow) + ((v >> 8) & kLow);
+    sum += (v * 0x0001000100010001ULL) >> 48;
+  }
+  return sum + byte_sum_scalar(p + i, len - i);
+}
+
+#if defined(__SSE2__)
+// psadbw against zero adds up each group of 8 bytes into a 64-bit lane, so the accumulators
+// cannot overflow.
+inline uint64_t byte_sum_sse2(const uint8_t* p, size_t len) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 32 <= len; i += 32) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 16));
+    acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(a, zero));
+    acc1 = _mm_add_epi64(acc1, _mm_sad_epu8(b, zero));
+  }
+  for (; i + 16 <= len; i += 16) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(a, zero));
+  }
+  __m128i acc = _mm_add_epi64(acc0, acc1);
+  uint64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  return lanes[0] + lanes[1] + byte_sum_scalar(p + i, len - i);
+}
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define SIMD_HAVE_RUNTIME_AVX2 1
+__attribute__((target("avx2"))) inline uint64_t byte_sum_avx2(const uint8_t* p, size_t len) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 32));
+    acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+    acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(b, zero));
+  }
+  for (; i + 32 <= len; i += 32) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+  }
+  __m256i acc = _mm256_add_epi64(acc0, acc1);
+  uint64_t lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] + byte_sum_scalar(p + i, len - i);
+}
+#endif
+
+using ByteSumFn = uint64_t (*)(const uint8_t*, size_t);
+
+inline ByteSumFn resolve_byte_sum() {
+#if defined(SIMD_HAVE_RUNTIME_AVX2)
+  if (__builtin_cpu_supports("avx2")) return &byte_sum_avx2;
+#endif
+#if defined(__SSE2__)
+  return &byte_sum_sse2;
+#else
+  return &byte_sum_scalar;
+#endif
+}
+
+}  // namespace detail
+
+// Sum of all bytes in [p, p + len), picking the widest kernel the CPU supports on first use.
+// Field-sized ranges (checksum patches) stay inline: the call through the kernel pointer would
+// cost more than the loop.
+inline uint64_t byte_sum(const uint8_t* p, size_t len) {
+  if (len < 32) return detail::byte_sum_swar(p, len);
+  static const detail::ByteSumFn fn = detail::resolve_byte_sum();
+  return fn(p, len);
+}
+
+}  // namespace simd
@@ -6,28 +6,42 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 #include <iostream>
 #include "include/codec.hpp"
 #include "include/bytebuf.hpp"
 #include "include/checksum.hpp"
+#include "include/frame_patcher.hpp"
+#include "include/stream_framer.hpp"
 #include "message_factory.hpp"
 
-struct Heartbeat : public codec::BinaryCodec {
+struct Heartbeat final : public codec::BinaryCodec {
+
+    enum class Field : uint8_t {};
+
+    static constexpr size_t kWireSize = 0;
 
     void encode(ByteBuf& buf) const override {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
+    }
+    
+
+    // Masked decode of a message without fields: there is nothing to read or skip.
+    void decode(ByteBufView&, codec::FieldMask<Field>) {}
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Heartbeat*>(&other);
-        if(!checkType) return false;
-        return true;
+        return typeid(other) == typeid(Heartbeat);
     }
     
     std::string toString() const override {
@@ -44,37 +58,72 @@ inline std::ostream& operator<<(std::ostream& os, const Heartbeat& pkt) {
 }
 
 
-struct Logon : public codec::BinaryCodec {
-    std::string senderCompId;
-    std::string targetCompId;
+struct Logon final : public codec::BinaryCodec {
+    codec::FixedString<32> senderCompId;
+    codec::FixedString<32> targetCompId;
     uint16_t heartBtInt;
-    std::string prtclVersion;
+    codec::FixedString<8> prtclVersion;
     uint32_t tradeDate;
     uint32_t qsize;
 
+    enum class Field : uint8_t {
+        senderCompId,
+        targetCompId,
+        heartBtInt,
+        prtclVersion,
+        tradeDate,
+        qsize,
+    };
+
+    static constexpr size_t kWireSize = 82;
+
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, senderCompId, 32);
-        codec::write_fixed_string(buf, targetCompId, 32);
-        buf.write_u16(heartBtInt);
-        codec::write_fixed_string(buf, prtclVersion, 8);
-        buf.write_u32(tradeDate);
-        buf.write_u32(qsize);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, senderCompId, 32);
+        codec::write_fixed_string(out, targetCompId, 32);
+        out.write_u16(heartBtInt);
+        codec::write_fixed_string(out, prtclVersion, 8);
+        out.write_u32(tradeDate);
+        out.write_u32(qsize);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        senderCompId = codec::read_fixed_string(buf, 32);
-        targetCompId = codec::read_fixed_string(buf, 32);
+    void decode(ByteBufView& buf) override {
+        senderCompId = codec::read_fixed_string<32>(buf);
+        targetCompId = codec::read_fixed_string<32>(buf);
         heartBtInt = buf.read_u16();
-        prtclVersion = codec::read_fixed_string(buf, 8);
+        prtclVersion = codec::read_fixed_string<8>(buf);
         tradeDate = buf.read_u32();
         qsize = buf.read_u32();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::senderCompId)) senderCompId = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::targetCompId)) targetCompId = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+        if(mask.has(Field::heartBtInt)) heartBtInt = buf.read_u16();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::prtclVersion)) prtclVersion = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::tradeDate)) tradeDate = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::qsize)) qsize = buf.read_u32();
+        else buf.skip_bytes(4);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Logon*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Logon)) return false;
+        const auto* checkType = static_cast<const Logon*>(&other);
         return senderCompId == checkType->senderCompId
                && targetCompId == checkType->targetCompId
                && heartBtInt == checkType->heartBtInt
@@ -107,26 +156,80 @@ inline std::ostream& operator<<(std::ostream& os, const Logon& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Logon: each accessor decodes one field in place from the
+// wire bytes. Covers the first 82 bytes, the part of the layout with fixed offsets.
+class LogonView {
+public:
+    static constexpr size_t kFixedSize = 82;
+
+    explicit LogonView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view senderCompId() const { return codec::fixed_string_view(data_ + 0, 32); }
+    std::string_view targetCompId() const { return codec::fixed_string_view(data_ + 32, 32); }
+    uint16_t heartBtInt() const { return DefaultByteOrder::load<uint16_t>(data_ + 64); }
+    std::string_view prtclVersion() const { return codec::fixed_string_view(data_ + 66, 8); }
+    uint32_t tradeDate() const { return DefaultByteOrder::load<uint32_t>(data_ + 74); }
+    uint32_t qsize() const { return DefaultByteOrder::load<uint32_t>(data_ + 78); }
+
+private:
+    const uint8_t* data_;
+};
 
-struct Logout : public codec::BinaryCodec {
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a Logon.
+struct LogonWire {
+    static void setSenderCompId(codec::FramePatcher& frame, std::string_view senderCompId) { frame.put_fixed_string(frame.spec().headerSize + 0, senderCompId, 32); }
+    static void setTargetCompId(codec::FramePatcher& frame, std::string_view targetCompId) { frame.put_fixed_string(frame.spec().headerSize + 32, targetCompId, 32); }
+    static void setHeartBtInt(codec::FramePatcher& frame, uint16_t heartBtInt) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 64, heartBtInt); }
+    static void setPrtclVersion(codec::FramePatcher& frame, std::string_view prtclVersion) { frame.put_fixed_string(frame.spec().headerSize + 66, prtclVersion, 8); }
+    static void setTradeDate(codec::FramePatcher& frame, uint32_t tradeDate) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 74, tradeDate); }
+    static void setQsize(codec::FramePatcher& frame, uint32_t qsize) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 78, qsize); }
+};
+
+
+struct Logout final : public codec::BinaryCodec {
     uint32_t sessionStatus;
-    std::string text;
+    codec::FixedString<64> text;
+
+    enum class Field : uint8_t {
+        sessionStatus,
+        text,
+    };
+
+    static constexpr size_t kWireSize = 68;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u32(sessionStatus);
-        codec::write_fixed_string(buf, text, 64);
+        auto out = buf.claim(kWireSize);
+        out.write_u32(sessionStatus);
+        codec::write_fixed_string(out, text, 64);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         sessionStatus = buf.read_u32();
-        text = codec::read_fixed_string(buf, 64);
+        text = codec::read_fixed_string<64>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::sessionStatus)) sessionStatus = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::text)) text = codec::read_fixed_string<64>(buf);
+        else buf.skip_bytes(64);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Logout*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Logout)) return false;
+        const auto* checkType = static_cast<const Logout*>(&other);
         return sessionStatus == checkType->sessionStatus
                && text == checkType->text;
     }
@@ -147,68 +250,156 @@ inline std::ostream& operator<<(std::ostream& os, const Logout& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Logout: each accessor decodes one field in place from the
+// wire bytes. Covers the first 68 bytes, the part of the layout with fixed offsets.
+class LogoutView {
+public:
+    static constexpr size_t kFixedSize = 68;
+
+    explicit LogoutView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t sessionStatus() const { return DefaultByteOrder::load<uint32_t>(data_ + 0); }
+    std::string_view text() const { return codec::fixed_string_view(data_ + 4, 64); }
+
+private:
+    const uint8_t* data_;
+};
 
-struct NewOrderSingle : public codec::BinaryCodec {
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a Logout.
+struct LogoutWire {
+    static void setSessionStatus(codec::FramePatcher& frame, uint32_t sessionStatus) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 0, sessionStatus); }
+    static void setText(codec::FramePatcher& frame, std::string_view text) { frame.put_fixed_string(frame.spec().headerSize + 4, text, 64); }
+};
+
+
+struct NewOrderSingle final : public codec::BinaryCodec {
     uint32_t bizId;
-    std::string bizPbu;
-    std::string clOrdId;
-    std::string securityId;
-    std::string account;
+    codec::FixedString<8> bizPbu;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<12> securityId;
+    codec::FixedString<13> account;
     uint8_t ownerType;
-    std::string side;
+    codec::FixedString<1> side;
     int64_t price;
     int64_t orderQty;
-    std::string ordType;
-    std::string timeInForce;
+    codec::FixedString<1> ordType;
+    codec::FixedString<1> timeInForce;
     uint64_t transactTime;
-    std::string creditTag;
-    std::string clearingFirm;
-    std::string branchId;
-    std::string userInfo;
+    codec::FixedString<2> creditTag;
+    codec::FixedString<8> clearingFirm;
+    codec::FixedString<8> branchId;
+    codec::FixedString<32> userInfo;
+
+    enum class Field : uint8_t {
+        bizId,
+        bizPbu,
+        clOrdId,
+        securityId,
+        account,
+        ownerType,
+        side,
+        price,
+        orderQty,
+        ordType,
+        timeInForce,
+        transactTime,
+        creditTag,
+        clearingFirm,
+        branchId,
+        userInfo,
+    };
+
+    static constexpr size_t kWireSize = 125;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u32(bizId);
-        codec::write_fixed_string(buf, bizPbu, 8);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, securityId, 12);
-        codec::write_fixed_string(buf, account, 13);
-        buf.write_u8(ownerType);
-        codec::write_fixed_string(buf, side, 1);
-        buf.write_i64(price);
-        buf.write_i64(orderQty);
-        codec::write_fixed_string(buf, ordType, 1);
-        codec::write_fixed_string(buf, timeInForce, 1);
-        buf.write_u64(transactTime);
-        codec::write_fixed_string(buf, creditTag, 2);
-        codec::write_fixed_string(buf, clearingFirm, 8);
-        codec::write_fixed_string(buf, branchId, 8);
-        codec::write_fixed_string(buf, userInfo, 32);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
+        auto out = buf.claim(kWireSize);
+        out.write_u32(bizId);
+        codec::write_fixed_string(out, bizPbu, 8);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, securityId, 12);
+        codec::write_fixed_string(out, account, 13);
+        out.write_u8(ownerType);
+        codec::write_fixed_string(out, side, 1);
+        out.write_i64(price);
+        out.write_i64(orderQty);
+        codec::write_fixed_string(out, ordType, 1);
+        codec::write_fixed_string(out, timeInForce, 1);
+        out.write_u64(transactTime);
+        codec::write_fixed_string(out, creditTag, 2);
+        codec::write_fixed_string(out, clearingFirm, 8);
+        codec::write_fixed_string(out, branchId, 8);
+        codec::write_fixed_string(out, userInfo, 32);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
         bizId = buf.read_u32();
-        bizPbu = codec::read_fixed_string(buf, 8);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        securityId = codec::read_fixed_string(buf, 12);
-        account = codec::read_fixed_string(buf, 13);
+        bizPbu = codec::read_fixed_string<8>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        securityId = codec::read_fixed_string<12>(buf);
+        account = codec::read_fixed_string<13>(buf);
         ownerType = buf.read_u8();
-        side = codec::read_fixed_string(buf, 1);
+        side = codec::read_fixed_string<1>(buf);
         price = buf.read_i64();
         orderQty = buf.read_i64();
-        ordType = codec::read_fixed_string(buf, 1);
-        timeInForce = codec::read_fixed_string(buf, 1);
+        ordType = codec::read_fixed_string<1>(buf);
+        timeInForce = codec::read_fixed_string<1>(buf);
         transactTime = buf.read_u64();
-        creditTag = codec::read_fixed_string(buf, 2);
-        clearingFirm = codec::read_fixed_string(buf, 8);
-        branchId = codec::read_fixed_string(buf, 8);
-        userInfo = codec::read_fixed_string(buf, 32);
+        creditTag = codec::read_fixed_string<2>(buf);
+        clearingFirm = codec::read_fixed_string<8>(buf);
+        branchId = codec::read_fixed_string<8>(buf);
+        userInfo = codec::read_fixed_string<32>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::bizId)) bizId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::bizPbu)) bizPbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<12>(buf);
+        else buf.skip_bytes(12);
+        if(mask.has(Field::account)) account = codec::read_fixed_string<13>(buf);
+        else buf.skip_bytes(13);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::price)) price = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::ordType)) ordType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::timeInForce)) timeInForce = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::creditTag)) creditTag = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const NewOrderSingle*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(NewOrderSingle)) return false;
+        const auto* checkType = static_cast<const NewOrderSingle*>(&other);
         return bizId == checkType->bizId
                && bizPbu == checkType->bizPbu
                && clOrdId == checkType->clOrdId
@@ -271,53 +462,154 @@ inline std::ostream& operator<<(std::ostream& os, const NewOrderSingle& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded NewOrderSingle: each accessor decodes one field in place from the
+// wire bytes. Covers the first 125 bytes, the part of the layout with fixed offsets.
+class NewOrderSingleView {
+public:
+    static constexpr size_t kFixedSize = 125;
+
+    explicit NewOrderSingleView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t bizId() const { return DefaultByteOrder::load<uint32_t>(data_ + 0); }
+    std::string_view bizPbu() const { return codec::fixed_string_view(data_ + 4, 8); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 12, 10); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 22, 12); }
+    std::string_view account() const { return codec::fixed_string_view(data_ + 34, 13); }
+    uint8_t ownerType() const { return DefaultByteOrder::load<uint8_t>(data_ + 47); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 48, 1); }
+    int64_t price() const { return DefaultByteOrder::load<int64_t>(data_ + 49); }
+    int64_t orderQty() const { return DefaultByteOrder::load<int64_t>(data_ + 57); }
+    std::string_view ordType() const { return codec::fixed_string_view(data_ + 65, 1); }
+    std::string_view timeInForce() const { return codec::fixed_string_view(data_ + 66, 1); }
+    uint64_t transactTime() const { return DefaultByteOrder::load<uint64_t>(data_ + 67); }
+    std::string_view creditTag() const { return codec::fixed_string_view(data_ + 75, 2); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 77, 8); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 85, 8); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 93, 32); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a NewOrderSingle.
+struct NewOrderSingleWire {
+    static void setBizId(codec::FramePatcher& frame, uint32_t bizId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 0, bizId); }
+    static void setBizPbu(codec::FramePatcher& frame, std::string_view bizPbu) { frame.put_fixed_string(frame.spec().headerSize + 4, bizPbu, 8); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 12, clOrdId, 10); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 22, securityId, 12); }
+    static void setAccount(codec::FramePatcher& frame, std::string_view account) { frame.put_fixed_string(frame.spec().headerSize + 34, account, 13); }
+    static void setOwnerType(codec::FramePatcher& frame, uint8_t ownerType) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 47, ownerType); }
+    static void setSide(codec::FramePatcher& frame, std::string_view side) { frame.put_fixed_string(frame.spec().headerSize + 48, side, 1); }
+    static void setPrice(codec::FramePatcher& frame, int64_t price) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 49, price); }
+    static void setOrderQty(codec::FramePatcher& frame, int64_t orderQty) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 57, orderQty); }
+    static void setOrdType(codec::FramePatcher& frame, std::string_view ordType) { frame.put_fixed_string(frame.spec().headerSize + 65, ordType, 1); }
+    static void setTimeInForce(codec::FramePatcher& frame, std::string_view timeInForce) { frame.put_fixed_string(frame.spec().headerSize + 66, timeInForce, 1); }
+    static void setTransactTime(codec::FramePatcher& frame, uint64_t transactTime) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 67, transactTime); }
+    static void setCreditTag(codec::FramePatcher& frame, std::string_view creditTag) { frame.put_fixed_string(frame.spec().headerSize + 75, creditTag, 2); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 77, clearingFirm, 8); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 85, branchId, 8); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 93, userInfo, 32); }
+};
+
 
-struct OrderCancel : public codec::BinaryCodec {
+struct OrderCancel final : public codec::BinaryCodec {
     uint32_t bizId;
-    std::string bizPbu;
-    std::string clOrdId;
-    std::string securityId;
-    std::string account;
+    codec::FixedString<8> bizPbu;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<12> securityId;
+    codec::FixedString<13> account;
     uint8_t ownerType;
-    std::string side;
-    std::string origClOrdId;
+    codec::FixedString<1> side;
+    codec::FixedString<10> origClOrdId;
     uint64_t transactTime;
-    std::string branchId;
-    std::string userInfo;
+    codec::FixedString<8> branchId;
+    codec::FixedString<32> userInfo;
+
+    enum class Field : uint8_t {
+        bizId,
+        bizPbu,
+        clOrdId,
+        securityId,
+        account,
+        ownerType,
+        side,
+        origClOrdId,
+        transactTime,
+        branchId,
+        userInfo,
+    };
+
+    static constexpr size_t kWireSize = 107;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u32(bizId);
-        codec::write_fixed_string(buf, bizPbu, 8);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, securityId, 12);
-        codec::write_fixed_string(buf, account, 13);
-        buf.write_u8(ownerType);
-        codec::write_fixed_string(buf, side, 1);
-        codec::write_fixed_string(buf, origClOrdId, 10);
-        buf.write_u64(transactTime);
-        codec::write_fixed_string(buf, branchId, 8);
-        codec::write_fixed_string(buf, userInfo, 32);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
+        auto out = buf.claim(kWireSize);
+        out.write_u32(bizId);
+        codec::write_fixed_string(out, bizPbu, 8);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, securityId, 12);
+        codec::write_fixed_string(out, account, 13);
+        out.write_u8(ownerType);
+        codec::write_fixed_string(out, side, 1);
+        codec::write_fixed_string(out, origClOrdId, 10);
+        out.write_u64(transactTime);
+        codec::write_fixed_string(out, branchId, 8);
+        codec::write_fixed_string(out, userInfo, 32);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
         bizId = buf.read_u32();
-        bizPbu = codec::read_fixed_string(buf, 8);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        securityId = codec::read_fixed_string(buf, 12);
-        account = codec::read_fixed_string(buf, 13);
+        bizPbu = codec::read_fixed_string<8>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        securityId = codec::read_fixed_string<12>(buf);
+        account = codec::read_fixed_string<13>(buf);
         ownerType = buf.read_u8();
-        side = codec::read_fixed_string(buf, 1);
-        origClOrdId = codec::read_fixed_string(buf, 10);
+        side = codec::read_fixed_string<1>(buf);
+        origClOrdId = codec::read_fixed_string<10>(buf);
         transactTime = buf.read_u64();
-        branchId = codec::read_fixed_string(buf, 8);
-        userInfo = codec::read_fixed_string(buf, 32);
+        branchId = codec::read_fixed_string<8>(buf);
+        userInfo = codec::read_fixed_string<32>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::bizId)) bizId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::bizPbu)) bizPbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<12>(buf);
+        else buf.skip_bytes(12);
+        if(mask.has(Field::account)) account = codec::read_fixed_string<13>(buf);
+        else buf.skip_bytes(13);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const OrderCancel*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(OrderCancel)) return false;
+        const auto* checkType = static_cast<const OrderCancel*>(&other);
         return bizId == checkType->bizId
                && bizPbu == checkType->bizPbu
                && clOrdId == checkType->clOrdId
@@ -365,104 +657,246 @@ inline std::ostream& operator<<(std::ostream& os, const OrderCancel& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded OrderCancel: each accessor decodes one field in place from the
+// wire bytes. Covers the first 107 bytes, the part of the layout with fixed offsets.
+class OrderCancelView {
+public:
+    static constexpr size_t kFixedSize = 107;
+
+    explicit OrderCancelView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t bizId() const { return DefaultByteOrder::load<uint32_t>(data_ + 0); }
+    std::string_view bizPbu() const { return codec::fixed_string_view(data_ + 4, 8); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 12, 10); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 22, 12); }
+    std::string_view account() const { return codec::fixed_string_view(data_ + 34, 13); }
+    uint8_t ownerType() const { return DefaultByteOrder::load<uint8_t>(data_ + 47); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 48, 1); }
+    std::string_view origClOrdId() const { return codec::fixed_string_view(data_ + 49, 10); }
+    uint64_t transactTime() const { return DefaultByteOrder::load<uint64_t>(data_ + 59); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 67, 8); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 75, 32); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a OrderCancel.
+struct OrderCancelWire {
+    static void setBizId(codec::FramePatcher& frame, uint32_t bizId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 0, bizId); }
+    static void setBizPbu(codec::FramePatcher& frame, std::string_view bizPbu) { frame.put_fixed_string(frame.spec().headerSize + 4, bizPbu, 8); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 12, clOrdId, 10); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 22, securityId, 12); }
+    static void setAccount(codec::FramePatcher& frame, std::string_view account) { frame.put_fixed_string(frame.spec().headerSize + 34, account, 13); }
+    static void setOwnerType(codec::FramePatcher& frame, uint8_t ownerType) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 47, ownerType); }
+    static void setSide(codec::FramePatcher& frame, std::string_view side) { frame.put_fixed_string(frame.spec().headerSize + 48, side, 1); }
+    static void setOrigClOrdId(codec::FramePatcher& frame, std::string_view origClOrdId) { frame.put_fixed_string(frame.spec().headerSize + 49, origClOrdId, 10); }
+    static void setTransactTime(codec::FramePatcher& frame, uint64_t transactTime) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 59, transactTime); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 67, branchId, 8); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 75, userInfo, 32); }
+};
+
 
-struct Confirm : public codec::BinaryCodec {
-    std::string pbu;
+struct Confirm final : public codec::BinaryCodec {
+    codec::FixedString<8> pbu;
     uint32_t setId;
     uint64_t reportIndex;
     uint32_t bizId;
-    std::string execType;
-    std::string bizPbu;
-    std::string clOrdId;
-    std::string securityId;
-    std::string account;
+    codec::FixedString<1> execType;
+    codec::FixedString<8> bizPbu;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<12> securityId;
+    codec::FixedString<13> account;
     uint8_t ownerType;
-    std::string side;
+    codec::FixedString<1> side;
     int64_t price;
     int64_t orderQty;
     int64_t leavesQty;
     int64_t cxlQty;
-    std::string ordType;
-    std::string timeInForce;
-    std::string ordStatus;
-    std::string creditTag;
-    std::string origClOrdId;
-    std::string clearingFirm;
-    std::string branchId;
+    codec::FixedString<1> ordType;
+    codec::FixedString<1> timeInForce;
+    codec::FixedString<1> ordStatus;
+    codec::FixedString<2> creditTag;
+    codec::FixedString<10> origClOrdId;
+    codec::FixedString<8> clearingFirm;
+    codec::FixedString<8> branchId;
     uint32_t ordRejReason;
-    std::string ordCnfmId;
-    std::string origOrdCnfmId;
+    codec::FixedString<16> ordCnfmId;
+    codec::FixedString<16> origOrdCnfmId;
     uint32_t tradeDate;
     uint64_t transactTime;
-    std::string userInfo;
+    codec::FixedString<32> userInfo;
+
+    enum class Field : uint8_t {
+        pbu,
+        setId,
+        reportIndex,
+        bizId,
+        execType,
+        bizPbu,
+        clOrdId,
+        securityId,
+        account,
+        ownerType,
+        side,
+        price,
+        orderQty,
+        leavesQty,
+        cxlQty,
+        ordType,
+        timeInForce,
+        ordStatus,
+        creditTag,
+        origClOrdId,
+        clearingFirm,
+        branchId,
+        ordRejReason,
+        ordCnfmId,
+        origOrdCnfmId,
+        tradeDate,
+        transactTime,
+        userInfo,
+    };
+
+    static constexpr size_t kWireSize = 213;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, pbu, 8);
-        buf.write_u32(setId);
-        buf.write_u64(reportIndex);
-        buf.write_u32(bizId);
-        codec::write_fixed_string(buf, execType, 1);
-        codec::write_fixed_string(buf, bizPbu, 8);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, securityId, 12);
-        codec::write_fixed_string(buf, account, 13);
-        buf.write_u8(ownerType);
-        codec::write_fixed_string(buf, side, 1);
-        buf.write_i64(price);
-        buf.write_i64(orderQty);
-        buf.write_i64(leavesQty);
-        buf.write_i64(cxlQty);
-        codec::write_fixed_string(buf, ordType, 1);
-        codec::write_fixed_string(buf, timeInForce, 1);
-        codec::write_fixed_string(buf, ordStatus, 1);
-        codec::write_fixed_string(buf, creditTag, 2);
-        codec::write_fixed_string(buf, origClOrdId, 10);
-        codec::write_fixed_string(buf, clearingFirm, 8);
-        codec::write_fixed_string(buf, branchId, 8);
-        buf.write_u32(ordRejReason);
-        codec::write_fixed_string(buf, ordCnfmId, 16);
-        codec::write_fixed_string(buf, origOrdCnfmId, 16);
-        buf.write_u32(tradeDate);
-        buf.write_u64(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
-        pbu = codec::read_fixed_string(buf, 8);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, pbu, 8);
+        out.write_u32(setId);
+        out.write_u64(reportIndex);
+        out.write_u32(bizId);
+        codec::write_fixed_string(out, execType, 1);
+        codec::write_fixed_string(out, bizPbu, 8);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, securityId, 12);
+        codec::write_fixed_string(out, account, 13);
+        out.write_u8(ownerType);
+        codec::write_fixed_string(out, side, 1);
+        out.write_i64(price);
+        out.write_i64(orderQty);
+        out.write_i64(leavesQty);
+        out.write_i64(cxlQty);
+        codec::write_fixed_string(out, ordType, 1);
+        codec::write_fixed_string(out, timeInForce, 1);
+        codec::write_fixed_string(out, ordStatus, 1);
+        codec::write_fixed_string(out, creditTag, 2);
+        codec::write_fixed_string(out, origClOrdId, 10);
+        codec::write_fixed_string(out, clearingFirm, 8);
+        codec::write_fixed_string(out, branchId, 8);
+        out.write_u32(ordRejReason);
+        codec::write_fixed_string(out, ordCnfmId, 16);
+        codec::write_fixed_string(out, origOrdCnfmId, 16);
+        out.write_u32(tradeDate);
+        out.write_u64(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        pbu = codec::read_fixed_string<8>(buf);
         setId = buf.read_u32();
         reportIndex = buf.read_u64();
         bizId = buf.read_u32();
-        execType = codec::read_fixed_string(buf, 1);
-        bizPbu = codec::read_fixed_string(buf, 8);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        securityId = codec::read_fixed_string(buf, 12);
-        account = codec::read_fixed_string(buf, 13);
+        execType = codec::read_fixed_string<1>(buf);
+        bizPbu = codec::read_fixed_string<8>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        securityId = codec::read_fixed_string<12>(buf);
+        account = codec::read_fixed_string<13>(buf);
         ownerType = buf.read_u8();
-        side = codec::read_fixed_string(buf, 1);
+        side = codec::read_fixed_string<1>(buf);
         price = buf.read_i64();
         orderQty = buf.read_i64();
         leavesQty = buf.read_i64();
         cxlQty = buf.read_i64();
-        ordType = codec::read_fixed_string(buf, 1);
-        timeInForce = codec::read_fixed_string(buf, 1);
-        ordStatus = codec::read_fixed_string(buf, 1);
-        creditTag = codec::read_fixed_string(buf, 2);
-        origClOrdId = codec::read_fixed_string(buf, 10);
-        clearingFirm = codec::read_fixed_string(buf, 8);
-        branchId = codec::read_fixed_string(buf, 8);
+        ordType = codec::read_fixed_string<1>(buf);
+        timeInForce = codec::read_fixed_string<1>(buf);
+        ordStatus = codec::read_fixed_string<1>(buf);
+        creditTag = codec::read_fixed_string<2>(buf);
+        origClOrdId = codec::read_fixed_string<10>(buf);
+        clearingFirm = codec::read_fixed_string<8>(buf);
+        branchId = codec::read_fixed_string<8>(buf);
         ordRejReason = buf.read_u32();
-        ordCnfmId = codec::read_fixed_string(buf, 16);
-        origOrdCnfmId = codec::read_fixed_string(buf, 16);
+        ordCnfmId = codec::read_fixed_string<16>(buf);
+        origOrdCnfmId = codec::read_fixed_string<16>(buf);
         tradeDate = buf.read_u32();
         transactTime = buf.read_u64();
-        userInfo = codec::read_fixed_string(buf, 32);
+        userInfo = codec::read_fixed_string<32>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::pbu)) pbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::setId)) setId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::bizId)) bizId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::execType)) execType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::bizPbu)) bizPbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<12>(buf);
+        else buf.skip_bytes(12);
+        if(mask.has(Field::account)) account = codec::read_fixed_string<13>(buf);
+        else buf.skip_bytes(13);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::price)) price = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::leavesQty)) leavesQty = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::cxlQty)) cxlQty = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::ordType)) ordType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::timeInForce)) timeInForce = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::ordStatus)) ordStatus = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::creditTag)) creditTag = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::ordRejReason)) ordRejReason = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::ordCnfmId)) ordCnfmId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::origOrdCnfmId)) origOrdCnfmId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::tradeDate)) tradeDate = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Confirm*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Confirm)) return false;
+        const auto* checkType = static_cast<const Confirm*>(&other);
         return pbu == checkType->pbu
                && setId == checkType->setId
                && reportIndex == checkType->reportIndex
@@ -561,59 +995,190 @@ inline std::ostream& operator<<(std::ostream& os, const Confirm& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Confirm: each accessor decodes one field in place from the
+// wire bytes. Covers the first 213 bytes, the part of the layout with fixed offsets.
+class ConfirmView {
+public:
+    static constexpr size_t kFixedSize = 213;
+
+    explicit ConfirmView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view pbu() const { return codec::fixed_string_view(data_ + 0, 8); }
+    uint32_t setId() const { return DefaultByteOrder::load<uint32_t>(data_ + 8); }
+    uint64_t reportIndex() const { return DefaultByteOrder::load<uint64_t>(data_ + 12); }
+    uint32_t bizId() const { return DefaultByteOrder::load<uint32_t>(data_ + 20); }
+    std::string_view execType() const { return codec::fixed_string_view(data_ + 24, 1); }
+    std::string_view bizPbu() const { return codec::fixed_string_view(data_ + 25, 8); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 33, 10); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 43, 12); }
+    std::string_view account() const { return codec::fixed_string_view(data_ + 55, 13); }
+    uint8_t ownerType() const { return DefaultByteOrder::load<uint8_t>(data_ + 68); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 69, 1); }
+    int64_t price() const { return DefaultByteOrder::load<int64_t>(data_ + 70); }
+    int64_t orderQty() const { return DefaultByteOrder::load<int64_t>(data_ + 78); }
+    int64_t leavesQty() const { return DefaultByteOrder::load<int64_t>(data_ + 86); }
+    int64_t cxlQty() const { return DefaultByteOrder::load<int64_t>(data_ + 94); }
+    std::string_view ordType() const { return codec::fixed_string_view(data_ + 102, 1); }
+    std::string_view timeInForce() const { return codec::fixed_string_view(data_ + 103, 1); }
+    std::string_view ordStatus() const { return codec::fixed_string_view(data_ + 104, 1); }
+    std::string_view creditTag() const { return codec::fixed_string_view(data_ + 105, 2); }
+    std::string_view origClOrdId() const { return codec::fixed_string_view(data_ + 107, 10); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 117, 8); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 125, 8); }
+    uint32_t ordRejReason() const { return DefaultByteOrder::load<uint32_t>(data_ + 133); }
+    std::string_view ordCnfmId() const { return codec::fixed_string_view(data_ + 137, 16); }
+    std::string_view origOrdCnfmId() const { return codec::fixed_string_view(data_ + 153, 16); }
+    uint32_t tradeDate() const { return DefaultByteOrder::load<uint32_t>(data_ + 169); }
+    uint64_t transactTime() const { return DefaultByteOrder::load<uint64_t>(data_ + 173); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 181, 32); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a Confirm.
+struct ConfirmWire {
+    static void setPbu(codec::FramePatcher& frame, std::string_view pbu) { frame.put_fixed_string(frame.spec().headerSize + 0, pbu, 8); }
+    static void setSetId(codec::FramePatcher& frame, uint32_t setId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 8, setId); }
+    static void setReportIndex(codec::FramePatcher& frame, uint64_t reportIndex) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 12, reportIndex); }
+    static void setBizId(codec::FramePatcher& frame, uint32_t bizId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 20, bizId); }
+    static void setExecType(codec::FramePatcher& frame, std::string_view execType) { frame.put_fixed_string(frame.spec().headerSize + 24, execType, 1); }
+    static void setBizPbu(codec::FramePatcher& frame, std::string_view bizPbu) { frame.put_fixed_string(frame.spec().headerSize + 25, bizPbu, 8); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 33, clOrdId, 10); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 43, securityId, 12); }
+    static void setAccount(codec::FramePatcher& frame, std::string_view account) { frame.put_fixed_string(frame.spec().headerSize + 55, account, 13); }
+    static void setOwnerType(codec::FramePatcher& frame, uint8_t ownerType) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 68, ownerType); }
+    static void setSide(codec::FramePatcher& frame, std::string_view side) { frame.put_fixed_string(frame.spec().headerSize + 69, side, 1); }
+    static void setPrice(codec::FramePatcher& frame, int64_t price) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 70, price); }
+    static void setOrderQty(codec::FramePatcher& frame, int64_t orderQty) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 78, orderQty); }
+    static void setLeavesQty(codec::FramePatcher& frame, int64_t leavesQty) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 86, leavesQty); }
+    static void setCxlQty(codec::FramePatcher& frame, int64_t cxlQty) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 94, cxlQty); }
+    static void setOrdType(codec::FramePatcher& frame, std::string_view ordType) { frame.put_fixed_string(frame.spec().headerSize + 102, ordType, 1); }
+    static void setTimeInForce(codec::FramePatcher& frame, std::string_view timeInForce) { frame.put_fixed_string(frame.spec().headerSize + 103, timeInForce, 1); }
+    static void setOrdStatus(codec::FramePatcher& frame, std::string_view ordStatus) { frame.put_fixed_string(frame.spec().headerSize + 104, ordStatus, 1); }
+    static void setCreditTag(codec::FramePatcher& frame, std::string_view creditTag) { frame.put_fixed_string(frame.spec().headerSize + 105, creditTag, 2); }
+    static void setOrigClOrdId(codec::FramePatcher& frame, std::string_view origClOrdId) { frame.put_fixed_string(frame.spec().headerSize + 107, origClOrdId, 10); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 117, clearingFirm, 8); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 125, branchId, 8); }
+    static void setOrdRejReason(codec::FramePatcher& frame, uint32_t ordRejReason) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 133, ordRejReason); }
+    static void setOrdCnfmId(codec::FramePatcher& frame, std::string_view ordCnfmId) { frame.put_fixed_string(frame.spec().headerSize + 137, ordCnfmId, 16); }
+    static void setOrigOrdCnfmId(codec::FramePatcher& frame, std::string_view origOrdCnfmId) { frame.put_fixed_string(frame.spec().headerSize + 153, origOrdCnfmId, 16); }
+    static void setTradeDate(codec::FramePatcher& frame, uint32_t tradeDate) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 169, tradeDate); }
+    static void setTransactTime(codec::FramePatcher& frame, uint64_t transactTime) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 173, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 181, userInfo, 32); }
+};
+
 
-struct CancelReject : public codec::BinaryCodec {
-    std::string pbu;
+struct CancelReject final : public codec::BinaryCodec {
+    codec::FixedString<8> pbu;
     uint32_t setId;
     uint64_t reportIndex;
     uint32_t bizId;
-    std::string bizPbu;
-    std::string clOrdId;
-    std::string securityId;
-    std::string origClOrdId;
-    std::string branchId;
+    codec::FixedString<8> bizPbu;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<12> securityId;
+    codec::FixedString<10> origClOrdId;
+    codec::FixedString<8> branchId;
     uint32_t cxlRejReason;
     uint32_t tradeDate;
     uint64_t transactTime;
-    std::string userInfo;
+    codec::FixedString<32> userInfo;
+
+    enum class Field : uint8_t {
+        pbu,
+        setId,
+        reportIndex,
+        bizId,
+        bizPbu,
+        clOrdId,
+        securityId,
+        origClOrdId,
+        branchId,
+        cxlRejReason,
+        tradeDate,
+        transactTime,
+        userInfo,
+    };
+
+    static constexpr size_t kWireSize = 120;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, pbu, 8);
-        buf.write_u32(setId);
-        buf.write_u64(reportIndex);
-        buf.write_u32(bizId);
-        codec::write_fixed_string(buf, bizPbu, 8);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, securityId, 12);
-        codec::write_fixed_string(buf, origClOrdId, 10);
-        codec::write_fixed_string(buf, branchId, 8);
-        buf.write_u32(cxlRejReason);
-        buf.write_u32(tradeDate);
-        buf.write_u64(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
-        pbu = codec::read_fixed_string(buf, 8);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, pbu, 8);
+        out.write_u32(setId);
+        out.write_u64(reportIndex);
+        out.write_u32(bizId);
+        codec::write_fixed_string(out, bizPbu, 8);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, securityId, 12);
+        codec::write_fixed_string(out, origClOrdId, 10);
+        codec::write_fixed_string(out, branchId, 8);
+        out.write_u32(cxlRejReason);
+        out.write_u32(tradeDate);
+        out.write_u64(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        pbu = codec::read_fixed_string<8>(buf);
         setId = buf.read_u32();
         reportIndex = buf.read_u64();
         bizId = buf.read_u32();
-        bizPbu = codec::read_fixed_string(buf, 8);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        securityId = codec::read_fixed_string(buf, 12);
-        origClOrdId = codec::read_fixed_string(buf, 10);
-        branchId = codec::read_fixed_string(buf, 8);
+        bizPbu = codec::read_fixed_string<8>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        securityId = codec::read_fixed_string<12>(buf);
+        origClOrdId = codec::read_fixed_string<10>(buf);
+        branchId = codec::read_fixed_string<8>(buf);
         cxlRejReason = buf.read_u32();
         tradeDate = buf.read_u32();
         transactTime = buf.read_u64();
-        userInfo = codec::read_fixed_string(buf, 32);
+        userInfo = codec::read_fixed_string<32>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::pbu)) pbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::setId)) setId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::bizId)) bizId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::bizPbu)) bizPbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<12>(buf);
+        else buf.skip_bytes(12);
+        if(mask.has(Field::origClOrdId)) origClOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::cxlRejReason)) cxlRejReason = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::tradeDate)) tradeDate = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const CancelReject*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(CancelReject)) return false;
+        const auto* checkType = static_cast<const CancelReject*>(&other);
         return pbu == checkType->pbu
                && setId == checkType->setId
                && reportIndex == checkType->reportIndex
@@ -667,98 +1232,238 @@ inline std::ostream& operator<<(std::ostream& os, const CancelReject& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded CancelReject: each accessor decodes one field in place from the
+// wire bytes. Covers the first 120 bytes, the part of the layout with fixed offsets.
+class CancelRejectView {
+public:
+    static constexpr size_t kFixedSize = 120;
+
+    explicit CancelRejectView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view pbu() const { return codec::fixed_string_view(data_ + 0, 8); }
+    uint32_t setId() const { return DefaultByteOrder::load<uint32_t>(data_ + 8); }
+    uint64_t reportIndex() const { return DefaultByteOrder::load<uint64_t>(data_ + 12); }
+    uint32_t bizId() const { return DefaultByteOrder::load<uint32_t>(data_ + 20); }
+    std::string_view bizPbu() const { return codec::fixed_string_view(data_ + 24, 8); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 32, 10); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 42, 12); }
+    std::string_view origClOrdId() const { return codec::fixed_string_view(data_ + 54, 10); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 64, 8); }
+    uint32_t cxlRejReason() const { return DefaultByteOrder::load<uint32_t>(data_ + 72); }
+    uint32_t tradeDate() const { return DefaultByteOrder::load<uint32_t>(data_ + 76); }
+    uint64_t transactTime() const { return DefaultByteOrder::load<uint64_t>(data_ + 80); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 88, 32); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a CancelReject.
+struct CancelRejectWire {
+    static void setPbu(codec::FramePatcher& frame, std::string_view pbu) { frame.put_fixed_string(frame.spec().headerSize + 0, pbu, 8); }
+    static void setSetId(codec::FramePatcher& frame, uint32_t setId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 8, setId); }
+    static void setReportIndex(codec::FramePatcher& frame, uint64_t reportIndex) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 12, reportIndex); }
+    static void setBizId(codec::FramePatcher& frame, uint32_t bizId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 20, bizId); }
+    static void setBizPbu(codec::FramePatcher& frame, std::string_view bizPbu) { frame.put_fixed_string(frame.spec().headerSize + 24, bizPbu, 8); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 32, clOrdId, 10); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 42, securityId, 12); }
+    static void setOrigClOrdId(codec::FramePatcher& frame, std::string_view origClOrdId) { frame.put_fixed_string(frame.spec().headerSize + 54, origClOrdId, 10); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 64, branchId, 8); }
+    static void setCxlRejReason(codec::FramePatcher& frame, uint32_t cxlRejReason) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 72, cxlRejReason); }
+    static void setTradeDate(codec::FramePatcher& frame, uint32_t tradeDate) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 76, tradeDate); }
+    static void setTransactTime(codec::FramePatcher& frame, uint64_t transactTime) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 80, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 88, userInfo, 32); }
+};
+
 
-struct Report : public codec::BinaryCodec {
-    std::string pbu;
+struct Report final : public codec::BinaryCodec {
+    codec::FixedString<8> pbu;
     uint32_t setId;
     uint64_t reportIndex;
     uint32_t bizId;
-    std::string execType;
-    std::string bizPbu;
-    std::string clOrdId;
-    std::string securityId;
-    std::string account;
+    codec::FixedString<1> execType;
+    codec::FixedString<8> bizPbu;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<12> securityId;
+    codec::FixedString<13> account;
     uint8_t ownerType;
     uint64_t orderEntryTime;
     int64_t lastPx;
     int64_t lastQty;
     int64_t grossTradeAmt;
-    std::string side;
+    codec::FixedString<1> side;
     int64_t orderQty;
     int64_t leavesQty;
-    std::string ordStatus;
-    std::string creditTag;
-    std::string clearingFirm;
-    std::string branchId;
-    std::string trdCnfmId;
-    std::string ordCnfmId;
+    codec::FixedString<1> ordStatus;
+    codec::FixedString<2> creditTag;
+    codec::FixedString<8> clearingFirm;
+    codec::FixedString<8> branchId;
+    codec::FixedString<16> trdCnfmId;
+    codec::FixedString<16> ordCnfmId;
     uint32_t tradeDate;
     uint64_t transactTime;
-    std::string userInfo;
+    codec::FixedString<32> userInfo;
+
+    enum class Field : uint8_t {
+        pbu,
+        setId,
+        reportIndex,
+        bizId,
+        execType,
+        bizPbu,
+        clOrdId,
+        securityId,
+        account,
+        ownerType,
+        orderEntryTime,
+        lastPx,
+        lastQty,
+        grossTradeAmt,
+        side,
+        orderQty,
+        leavesQty,
+        ordStatus,
+        creditTag,
+        clearingFirm,
+        branchId,
+        trdCnfmId,
+        ordCnfmId,
+        tradeDate,
+        transactTime,
+        userInfo,
+    };
+
+    static constexpr size_t kWireSize = 213;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, pbu, 8);
-        buf.write_u32(setId);
-        buf.write_u64(reportIndex);
-        buf.write_u32(bizId);
-        codec::write_fixed_string(buf, execType, 1);
-        codec::write_fixed_string(buf, bizPbu, 8);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, securityId, 12);
-        codec::write_fixed_string(buf, account, 13);
-        buf.write_u8(ownerType);
-        buf.write_u64(orderEntryTime);
-        buf.write_i64(lastPx);
-        buf.write_i64(lastQty);
-        buf.write_i64(grossTradeAmt);
-        codec::write_fixed_string(buf, side, 1);
-        buf.write_i64(orderQty);
-        buf.write_i64(leavesQty);
-        codec::write_fixed_string(buf, ordStatus, 1);
-        codec::write_fixed_string(buf, creditTag, 2);
-        codec::write_fixed_string(buf, clearingFirm, 8);
-        codec::write_fixed_string(buf, branchId, 8);
-        codec::write_fixed_string(buf, trdCnfmId, 16);
-        codec::write_fixed_string(buf, ordCnfmId, 16);
-        buf.write_u32(tradeDate);
-        buf.write_u64(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
-    }
-    
-
-    void decode(ByteBuf& buf) override {
-        pbu = codec::read_fixed_string(buf, 8);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, pbu, 8);
+        out.write_u32(setId);
+        out.write_u64(reportIndex);
+        out.write_u32(bizId);
+        codec::write_fixed_string(out, execType, 1);
+        codec::write_fixed_string(out, bizPbu, 8);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, securityId, 12);
+        codec::write_fixed_string(out, account, 13);
+        out.write_u8(ownerType);
+        out.write_u64(orderEntryTime);
+        out.write_i64(lastPx);
+        out.write_i64(lastQty);
+        out.write_i64(grossTradeAmt);
+        codec::write_fixed_string(out, side, 1);
+        out.write_i64(orderQty);
+        out.write_i64(leavesQty);
+        codec::write_fixed_string(out, ordStatus, 1);
+        codec::write_fixed_string(out, creditTag, 2);
+        codec::write_fixed_string(out, clearingFirm, 8);
+        codec::write_fixed_string(out, branchId, 8);
+        codec::write_fixed_string(out, trdCnfmId, 16);
+        codec::write_fixed_string(out, ordCnfmId, 16);
+        out.write_u32(tradeDate);
+        out.write_u64(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        pbu = codec::read_fixed_string<8>(buf);
         setId = buf.read_u32();
         reportIndex = buf.read_u64();
         bizId = buf.read_u32();
-        execType = codec::read_fixed_string(buf, 1);
-        bizPbu = codec::read_fixed_string(buf, 8);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        securityId = codec::read_fixed_string(buf, 12);
-        account = codec::read_fixed_string(buf, 13);
+        execType = codec::read_fixed_string<1>(buf);
+        bizPbu = codec::read_fixed_string<8>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        securityId = codec::read_fixed_string<12>(buf);
+        account = codec::read_fixed_string<13>(buf);
         ownerType = buf.read_u8();
         orderEntryTime = buf.read_u64();
         lastPx = buf.read_i64();
         lastQty = buf.read_i64();
         grossTradeAmt = buf.read_i64();
-        side = codec::read_fixed_string(buf, 1);
+        side = codec::read_fixed_string<1>(buf);
         orderQty = buf.read_i64();
         leavesQty = buf.read_i64();
-        ordStatus = codec::read_fixed_string(buf, 1);
-        creditTag = codec::read_fixed_string(buf, 2);
-        clearingFirm = codec::read_fixed_string(buf, 8);
-        branchId = codec::read_fixed_string(buf, 8);
-        trdCnfmId = codec::read_fixed_string(buf, 16);
-        ordCnfmId = codec::read_fixed_string(buf, 16);
+        ordStatus = codec::read_fixed_string<1>(buf);
+        creditTag = codec::read_fixed_string<2>(buf);
+        clearingFirm = codec::read_fixed_string<8>(buf);
+        branchId = codec::read_fixed_string<8>(buf);
+        trdCnfmId = codec::read_fixed_string<16>(buf);
+        ordCnfmId = codec::read_fixed_string<16>(buf);
         tradeDate = buf.read_u32();
         transactTime = buf.read_u64();
-        userInfo = codec::read_fixed_string(buf, 32);
+        userInfo = codec::read_fixed_string<32>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::pbu)) pbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::setId)) setId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::reportIndex)) reportIndex = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::bizId)) bizId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::execType)) execType = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::bizPbu)) bizPbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<12>(buf);
+        else buf.skip_bytes(12);
+        if(mask.has(Field::account)) account = codec::read_fixed_string<13>(buf);
+        else buf.skip_bytes(13);
+        if(mask.has(Field::ownerType)) ownerType = buf.read_u8();
+        else buf.skip_bytes(1);
+        if(mask.has(Field::orderEntryTime)) orderEntryTime = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::lastPx)) lastPx = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::lastQty)) lastQty = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::grossTradeAmt)) grossTradeAmt = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::side)) side = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::orderQty)) orderQty = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::leavesQty)) leavesQty = buf.read_i64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::ordStatus)) ordStatus = codec::read_fixed_string<1>(buf);
+        else buf.skip_bytes(1);
+        if(mask.has(Field::creditTag)) creditTag = codec::read_fixed_string<2>(buf);
+        else buf.skip_bytes(2);
+        if(mask.has(Field::clearingFirm)) clearingFirm = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::branchId)) branchId = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::trdCnfmId)) trdCnfmId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::ordCnfmId)) ordCnfmId = codec::read_fixed_string<16>(buf);
+        else buf.skip_bytes(16);
+        if(mask.has(Field::tradeDate)) tradeDate = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const Report*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(Report)) return false;
+        const auto* checkType = static_cast<const Report*>(&other);
         return pbu == checkType->pbu
                && setId == checkType->setId
                && reportIndex == checkType->reportIndex
@@ -851,44 +1556,156 @@ inline std::ostream& operator<<(std::ostream& os, const Report& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded Report: each accessor decodes one field in place from the
+// wire bytes. Covers the first 213 bytes, the part of the layout with fixed offsets.
+class ReportView {
+public:
+    static constexpr size_t kFixedSize = 213;
+
+    explicit ReportView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view pbu() const { return codec::fixed_string_view(data_ + 0, 8); }
+    uint32_t setId() const { return DefaultByteOrder::load<uint32_t>(data_ + 8); }
+    uint64_t reportIndex() const { return DefaultByteOrder::load<uint64_t>(data_ + 12); }
+    uint32_t bizId() const { return DefaultByteOrder::load<uint32_t>(data_ + 20); }
+    std::string_view execType() const { return codec::fixed_string_view(data_ + 24, 1); }
+    std::string_view bizPbu() const { return codec::fixed_string_view(data_ + 25, 8); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 33, 10); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 43, 12); }
+    std::string_view account() const { return codec::fixed_string_view(data_ + 55, 13); }
+    uint8_t ownerType() const { return DefaultByteOrder::load<uint8_t>(data_ + 68); }
+    uint64_t orderEntryTime() const { return DefaultByteOrder::load<uint64_t>(data_ + 69); }
+    int64_t lastPx() const { return DefaultByteOrder::load<int64_t>(data_ + 77); }
+    int64_t lastQty() const { return DefaultByteOrder::load<int64_t>(data_ + 85); }
+    int64_t grossTradeAmt() const { return DefaultByteOrder::load<int64_t>(data_ + 93); }
+    std::string_view side() const { return codec::fixed_string_view(data_ + 101, 1); }
+    int64_t orderQty() const { return DefaultByteOrder::load<int64_t>(data_ + 102); }
+    int64_t leavesQty() const { return DefaultByteOrder::load<int64_t>(data_ + 110); }
+    std::string_view ordStatus() const { return codec::fixed_string_view(data_ + 118, 1); }
+    std::string_view creditTag() const { return codec::fixed_string_view(data_ + 119, 2); }
+    std::string_view clearingFirm() const { return codec::fixed_string_view(data_ + 121, 8); }
+    std::string_view branchId() const { return codec::fixed_string_view(data_ + 129, 8); }
+    std::string_view trdCnfmId() const { return codec::fixed_string_view(data_ + 137, 16); }
+    std::string_view ordCnfmId() const { return codec::fixed_string_view(data_ + 153, 16); }
+    uint32_t tradeDate() const { return DefaultByteOrder::load<uint32_t>(data_ + 169); }
+    uint64_t transactTime() const { return DefaultByteOrder::load<uint64_t>(data_ + 173); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 181, 32); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a Report.
+struct ReportWire {
+    static void setPbu(codec::FramePatcher& frame, std::string_view pbu) { frame.put_fixed_string(frame.spec().headerSize + 0, pbu, 8); }
+    static void setSetId(codec::FramePatcher& frame, uint32_t setId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 8, setId); }
+    static void setReportIndex(codec::FramePatcher& frame, uint64_t reportIndex) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 12, reportIndex); }
+    static void setBizId(codec::FramePatcher& frame, uint32_t bizId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 20, bizId); }
+    static void setExecType(codec::FramePatcher& frame, std::string_view execType) { frame.put_fixed_string(frame.spec().headerSize + 24, execType, 1); }
+    static void setBizPbu(codec::FramePatcher& frame, std::string_view bizPbu) { frame.put_fixed_string(frame.spec().headerSize + 25, bizPbu, 8); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 33, clOrdId, 10); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 43, securityId, 12); }
+    static void setAccount(codec::FramePatcher& frame, std::string_view account) { frame.put_fixed_string(frame.spec().headerSize + 55, account, 13); }
+    static void setOwnerType(codec::FramePatcher& frame, uint8_t ownerType) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 68, ownerType); }
+    static void setOrderEntryTime(codec::FramePatcher& frame, uint64_t orderEntryTime) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 69, orderEntryTime); }
+    static void setLastPx(codec::FramePatcher& frame, int64_t lastPx) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 77, lastPx); }
+    static void setLastQty(codec::FramePatcher& frame, int64_t lastQty) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 85, lastQty); }
+    static void setGrossTradeAmt(codec::FramePatcher& frame, int64_t grossTradeAmt) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 93, grossTradeAmt); }
+    static void setSide(codec::FramePatcher& frame, std::string_view side) { frame.put_fixed_string(frame.spec().headerSize + 101, side, 1); }
+    static void setOrderQty(codec::FramePatcher& frame, int64_t orderQty) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 102, orderQty); }
+    static void setLeavesQty(codec::FramePatcher& frame, int64_t leavesQty) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 110, leavesQty); }
+    static void setOrdStatus(codec::FramePatcher& frame, std::string_view ordStatus) { frame.put_fixed_string(frame.spec().headerSize + 118, ordStatus, 1); }
+    static void setCreditTag(codec::FramePatcher& frame, std::string_view creditTag) { frame.put_fixed_string(frame.spec().headerSize + 119, creditTag, 2); }
+    static void setClearingFirm(codec::FramePatcher& frame, std::string_view clearingFirm) { frame.put_fixed_string(frame.spec().headerSize + 121, clearingFirm, 8); }
+    static void setBranchId(codec::FramePatcher& frame, std::string_view branchId) { frame.put_fixed_string(frame.spec().headerSize + 129, branchId, 8); }
+    static void setTrdCnfmId(codec::FramePatcher& frame, std::string_view trdCnfmId) { frame.put_fixed_string(frame.spec().headerSize + 137, trdCnfmId, 16); }
+    static void setOrdCnfmId(codec::FramePatcher& frame, std::string_view ordCnfmId) { frame.put_fixed_string(frame.spec().headerSize + 153, ordCnfmId, 16); }
+    static void setTradeDate(codec::FramePatcher& frame, uint32_t tradeDate) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 169, tradeDate); }
+    static void setTransactTime(codec::FramePatcher& frame, uint64_t transactTime) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 173, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 181, userInfo, 32); }
+};
+
 
-struct OrderReject : public codec::BinaryCodec {
+struct OrderReject final : public codec::BinaryCodec {
     uint32_t bizId;
-    std::string bizPbu;
-    std::string clOrdId;
-    std::string securityId;
+    codec::FixedString<8> bizPbu;
+    codec::FixedString<10> clOrdId;
+    codec::FixedString<12> securityId;
     uint32_t ordRejReason;
     uint32_t tradeDate;
     uint64_t transactTime;
-    std::string userInfo;
+    codec::FixedString<32> userInfo;
+
+    enum class Field : uint8_t {
+        bizId,
+        bizPbu,
+        clOrdId,
+        securityId,
+        ordRejReason,
+        tradeDate,
+        transactTime,
+        userInfo,
+    };
+
+    static constexpr size_t kWireSize = 82;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u32(bizId);
-        codec::write_fixed_string(buf, bizPbu, 8);
-        codec::write_fixed_string(buf, clOrdId, 10);
-        codec::write_fixed_string(buf, securityId, 12);
-        buf.write_u32(ordRejReason);
-        buf.write_u32(tradeDate);
-        buf.write_u64(transactTime);
-        codec::write_fixed_string(buf, userInfo, 32);
+        auto out = buf.claim(kWireSize);
+        out.write_u32(bizId);
+        codec::write_fixed_string(out, bizPbu, 8);
+        codec::write_fixed_string(out, clOrdId, 10);
+        codec::write_fixed_string(out, securityId, 12);
+        out.write_u32(ordRejReason);
+        out.write_u32(tradeDate);
+        out.write_u64(transactTime);
+        codec::write_fixed_string(out, userInfo, 32);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         bizId = buf.read_u32();
-        bizPbu = codec::read_fixed_string(buf, 8);
-        clOrdId = codec::read_fixed_string(buf, 10);
-        securityId = codec::read_fixed_string(buf, 12);
+        bizPbu = codec::read_fixed_string<8>(buf);
+        clOrdId = codec::read_fixed_string<10>(buf);
+        securityId = codec::read_fixed_string<12>(buf);
         ordRejReason = buf.read_u32();
         tradeDate = buf.read_u32();
         transactTime = buf.read_u64();
-        userInfo = codec::read_fixed_string(buf, 32);
+        userInfo = codec::read_fixed_string<32>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::bizId)) bizId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::bizPbu)) bizPbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::clOrdId)) clOrdId = codec::read_fixed_string<10>(buf);
+        else buf.skip_bytes(10);
+        if(mask.has(Field::securityId)) securityId = codec::read_fixed_string<12>(buf);
+        else buf.skip_bytes(12);
+        if(mask.has(Field::ordRejReason)) ordRejReason = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::tradeDate)) tradeDate = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::transactTime)) transactTime = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::userInfo)) userInfo = codec::read_fixed_string<32>(buf);
+        else buf.skip_bytes(32);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const OrderReject*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(OrderReject)) return false;
+        const auto* checkType = static_cast<const OrderReject*>(&other);
         return bizId == checkType->bizId
                && bizPbu == checkType->bizPbu
                && clOrdId == checkType->clOrdId
@@ -927,26 +1744,84 @@ inline std::ostream& operator<<(std::ostream& os, const OrderReject& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded OrderReject: each accessor decodes one field in place from the
+// wire bytes. Covers the first 82 bytes, the part of the layout with fixed offsets.
+class OrderRejectView {
+public:
+    static constexpr size_t kFixedSize = 82;
+
+    explicit OrderRejectView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t bizId() const { return DefaultByteOrder::load<uint32_t>(data_ + 0); }
+    std::string_view bizPbu() const { return codec::fixed_string_view(data_ + 4, 8); }
+    std::string_view clOrdId() const { return codec::fixed_string_view(data_ + 12, 10); }
+    std::string_view securityId() const { return codec::fixed_string_view(data_ + 22, 12); }
+    uint32_t ordRejReason() const { return DefaultByteOrder::load<uint32_t>(data_ + 34); }
+    uint32_t tradeDate() const { return DefaultByteOrder::load<uint32_t>(data_ + 38); }
+    uint64_t transactTime() const { return DefaultByteOrder::load<uint64_t>(data_ + 42); }
+    std::string_view userInfo() const { return codec::fixed_string_view(data_ + 50, 32); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a OrderReject.
+struct OrderRejectWire {
+    static void setBizId(codec::FramePatcher& frame, uint32_t bizId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 0, bizId); }
+    static void setBizPbu(codec::FramePatcher& frame, std::string_view bizPbu) { frame.put_fixed_string(frame.spec().headerSize + 4, bizPbu, 8); }
+    static void setClOrdId(codec::FramePatcher& frame, std::string_view clOrdId) { frame.put_fixed_string(frame.spec().headerSize + 12, clOrdId, 10); }
+    static void setSecurityId(codec::FramePatcher& frame, std::string_view securityId) { frame.put_fixed_string(frame.spec().headerSize + 22, securityId, 12); }
+    static void setOrdRejReason(codec::FramePatcher& frame, uint32_t ordRejReason) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 34, ordRejReason); }
+    static void setTradeDate(codec::FramePatcher& frame, uint32_t tradeDate) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 38, tradeDate); }
+    static void setTransactTime(codec::FramePatcher& frame, uint64_t transactTime) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 42, transactTime); }
+    static void setUserInfo(codec::FramePatcher& frame, std::string_view userInfo) { frame.put_fixed_string(frame.spec().headerSize + 50, userInfo, 32); }
+};
+
 
-struct PlatformState : public codec::BinaryCodec {
+struct PlatformState final : public codec::BinaryCodec {
     uint16_t platformId;
     uint16_t platformState;
 
+    enum class Field : uint8_t {
+        platformId,
+        platformState,
+    };
+
+    static constexpr size_t kWireSize = 4;
+
     void encode(ByteBuf& buf) const override {
-        buf.write_u16(platformId);
-        buf.write_u16(platformState);
+        auto out = buf.claim(kWireSize);
+        out.write_u16(platformId);
+        out.write_u16(platformState);
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         platformId = buf.read_u16();
         platformState = buf.read_u16();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::platformId)) platformId = buf.read_u16();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::platformState)) platformState = buf.read_u16();
+        else buf.skip_bytes(2);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const PlatformState*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(PlatformState)) return false;
+        const auto* checkType = static_cast<const PlatformState*>(&other);
         return platformId == checkType->platformId
                && platformState == checkType->platformState;
     }
@@ -967,11 +1842,40 @@ inline std::ostream& operator<<(std::ostream& os, const PlatformState& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded PlatformState: each accessor decodes one field in place from the
+// wire bytes. Covers the first 4 bytes, the part of the layout with fixed offsets.
+class PlatformStateView {
+public:
+    static constexpr size_t kFixedSize = 4;
+
+    explicit PlatformStateView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t platformId() const { return DefaultByteOrder::load<uint16_t>(data_ + 0); }
+    uint16_t platformState() const { return DefaultByteOrder::load<uint16_t>(data_ + 2); }
 
-struct ExecRptInfo : public codec::BinaryCodec {
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a PlatformState.
+struct PlatformStateWire {
+    static void setPlatformId(codec::FramePatcher& frame, uint16_t platformId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 0, platformId); }
+    static void setPlatformState(codec::FramePatcher& frame, uint16_t platformState) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 2, platformState); }
+};
+
+
+struct ExecRptInfo final : public codec::BinaryCodec {
     uint16_t platformId;
-    std::vector<std::string> pbu;
-    std::vector<uint32_t> setId;
+    codec::StringList pbu;
+    codec::List<uint32_t> setId;
+
+    enum class Field : uint8_t {
+        platformId,
+        pbu,
+        setId,
+    };
 
     void encode(ByteBuf& buf) const override {
         buf.write_u16(platformId);
@@ -980,16 +1884,35 @@ struct ExecRptInfo : public codec::BinaryCodec {
     }
     
 
-    void decode(ByteBuf& buf) override {
+    void decode(ByteBufView& buf) override {
         platformId = buf.read_u16();
-        pbu = codec::read_fixed_string_list<uint16_t>(buf, 8);
-        setId = codec::read_basic_type<uint16_t,uint32_t>(buf);
+        pbu = codec::read_fixed_string_list<uint16_t,codec::StringList>(buf, 8);
+        setId = codec::read_basic_type<uint16_t,uint32_t,codec::List<uint32_t>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::platformId)) platformId = buf.read_u16();
+        else buf.skip_bytes(2);
+        if(mask.has(Field::pbu)) pbu = codec::read_fixed_string_list<uint16_t,codec::StringList>(buf, 8);
+        else codec::skip_fixed_string_list<uint16_t>(buf, 8);
+        if(mask.has(Field::setId)) setId = codec::read_basic_type<uint16_t,uint32_t,codec::List<uint32_t>>(buf);
+        else codec::skip_basic_type<uint16_t,uint32_t>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return 2
+               + codec::fixed_string_list_size<uint16_t>(pbu, 8)
+               + codec::basic_type_list_size<uint16_t, uint32_t>(setId);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExecRptInfo*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExecRptInfo)) return false;
+        const auto* checkType = static_cast<const ExecRptInfo*>(&other);
         return platformId == checkType->platformId
                && pbu == checkType->pbu
                && setId == checkType->setId;
@@ -1000,7 +1923,7 @@ struct ExecRptInfo : public codec::BinaryCodec {
         oss << "ExecRptInfo { "
         << "PlatformID: " << std::to_string(platformId)
         << ", "
-        << "Pbu: " << codec::join_vector<std::string>(pbu)
+        << "Pbu: " << codec::join_vector<codec::ListString>(pbu)
         << ", "
         << "SetID: " << codec::join_vector<uint32_t>(setId)
         << " }";
@@ -1013,29 +1936,76 @@ inline std::ostream& operator<<(std::ostream& os, const ExecRptInfo& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ExecRptInfo: each accessor decodes one field in place from the
+// wire bytes. Covers the first 2 bytes, the part of the layout with fixed offsets.
+class ExecRptInfoView {
+public:
+    static constexpr size_t kFixedSize = 2;
+
+    explicit ExecRptInfoView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint16_t platformId() const { return DefaultByteOrder::load<uint16_t>(data_ + 0); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a ExecRptInfo.
+struct ExecRptInfoWire {
+    static void setPlatformId(codec::FramePatcher& frame, uint16_t platformId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 0, platformId); }
+};
+
 
-struct SubExecRptSync : public codec::BinaryCodec {
-    std::string pbu;
+struct SubExecRptSync final : public codec::BinaryCodec {
+    codec::FixedString<8> pbu;
     uint32_t setId;
     uint64_t beginReportIndex;
 
+    enum class Field : uint8_t {
+        pbu,
+        setId,
+        beginReportIndex,
+    };
+
+    static constexpr size_t kWireSize = 20;
+
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, pbu, 8);
-        buf.write_u32(setId);
-        buf.write_u64(beginReportIndex);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, pbu, 8);
+        out.write_u32(setId);
+        out.write_u64(beginReportIndex);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        pbu = codec::read_fixed_string(buf, 8);
+    void decode(ByteBufView& buf) override {
+        pbu = codec::read_fixed_string<8>(buf);
         setId = buf.read_u32();
         beginReportIndex = buf.read_u64();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::pbu)) pbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::setId)) setId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::beginReportIndex)) beginReportIndex = buf.read_u64();
+        else buf.skip_bytes(8);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const SubExecRptSync*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(SubExecRptSync)) return false;
+        const auto* checkType = static_cast<const SubExecRptSync*>(&other);
         return pbu == checkType->pbu
                && setId == checkType->setId
                && beginReportIndex == checkType->beginReportIndex;
@@ -1059,23 +2029,58 @@ inline std::ostream& operator<<(std::ostream& os, const SubExecRptSync& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded SubExecRptSync: each accessor decodes one field in place from the
+// wire bytes. Covers the first 20 bytes, the part of the layout with fixed offsets.
+class SubExecRptSyncView {
+public:
+    static constexpr size_t kFixedSize = 20;
 
-struct ExecRptSync : public codec::BinaryCodec {
-    std::vector<SubExecRptSync> subExecRptSync;
+    explicit SubExecRptSyncView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view pbu() const { return codec::fixed_string_view(data_ + 0, 8); }
+    uint32_t setId() const { return DefaultByteOrder::load<uint32_t>(data_ + 8); }
+    uint64_t beginReportIndex() const { return DefaultByteOrder::load<uint64_t>(data_ + 12); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct ExecRptSync final : public codec::BinaryCodec {
+    codec::List<SubExecRptSync> subExecRptSync;
+
+    enum class Field : uint8_t {
+        subExecRptSync,
+    };
 
     void encode(ByteBuf& buf) const override {
         codec::write_object_List<uint16_t>(buf,subExecRptSync);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        subExecRptSync = codec::read_object_List<uint16_t,SubExecRptSync>(buf);
+    void decode(ByteBufView& buf) override {
+        subExecRptSync = codec::read_object_List<uint16_t,SubExecRptSync,codec::List<SubExecRptSync>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::subExecRptSync)) subExecRptSync = codec::read_object_List<uint16_t,SubExecRptSync,codec::List<SubExecRptSync>>(buf);
+        else codec::skip_object_List<uint16_t,SubExecRptSync>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return codec::object_list_size<uint16_t>(subExecRptSync);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExecRptSync*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExecRptSync)) return false;
+        const auto* checkType = static_cast<const ExecRptSync*>(&other);
         return subExecRptSync == checkType->subExecRptSync;
     }
     
@@ -1094,37 +2099,72 @@ inline std::ostream& operator<<(std::ostream& os, const ExecRptSync& pkt) {
 }
 
 
-struct SubExecRptSyncRsp : public codec::BinaryCodec {
-    std::string pbu;
+struct SubExecRptSyncRsp final : public codec::BinaryCodec {
+    codec::FixedString<8> pbu;
     uint32_t setId;
     uint64_t beginReportIndex;
     uint64_t endReportIndex;
     uint32_t rejReason;
-    std::string text;
+    codec::FixedString<64> text;
+
+    enum class Field : uint8_t {
+        pbu,
+        setId,
+        beginReportIndex,
+        endReportIndex,
+        rejReason,
+        text,
+    };
+
+    static constexpr size_t kWireSize = 96;
 
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, pbu, 8);
-        buf.write_u32(setId);
-        buf.write_u64(beginReportIndex);
-        buf.write_u64(endReportIndex);
-        buf.write_u32(rejReason);
-        codec::write_fixed_string(buf, text, 64);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, pbu, 8);
+        out.write_u32(setId);
+        out.write_u64(beginReportIndex);
+        out.write_u64(endReportIndex);
+        out.write_u32(rejReason);
+        codec::write_fixed_string(out, text, 64);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        pbu = codec::read_fixed_string(buf, 8);
+    void decode(ByteBufView& buf) override {
+        pbu = codec::read_fixed_string<8>(buf);
         setId = buf.read_u32();
         beginReportIndex = buf.read_u64();
         endReportIndex = buf.read_u64();
         rejReason = buf.read_u32();
-        text = codec::read_fixed_string(buf, 64);
+        text = codec::read_fixed_string<64>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::pbu)) pbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::setId)) setId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::beginReportIndex)) beginReportIndex = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::endReportIndex)) endReportIndex = buf.read_u64();
+        else buf.skip_bytes(8);
+        if(mask.has(Field::rejReason)) rejReason = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::text)) text = codec::read_fixed_string<64>(buf);
+        else buf.skip_bytes(64);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const SubExecRptSyncRsp*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(SubExecRptSyncRsp)) return false;
+        const auto* checkType = static_cast<const SubExecRptSyncRsp*>(&other);
         return pbu == checkType->pbu
                && setId == checkType->setId
                && beginReportIndex == checkType->beginReportIndex
@@ -1157,23 +2197,61 @@ inline std::ostream& operator<<(std::ostream& os, const SubExecRptSyncRsp& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded SubExecRptSyncRsp: each accessor decodes one field in place from the
+// wire bytes. Covers the first 96 bytes, the part of the layout with fixed offsets.
+class SubExecRptSyncRspView {
+public:
+    static constexpr size_t kFixedSize = 96;
+
+    explicit SubExecRptSyncRspView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view pbu() const { return codec::fixed_string_view(data_ + 0, 8); }
+    uint32_t setId() const { return DefaultByteOrder::load<uint32_t>(data_ + 8); }
+    uint64_t beginReportIndex() const { return DefaultByteOrder::load<uint64_t>(data_ + 12); }
+    uint64_t endReportIndex() const { return DefaultByteOrder::load<uint64_t>(data_ + 20); }
+    uint32_t rejReason() const { return DefaultByteOrder::load<uint32_t>(data_ + 28); }
+    std::string_view text() const { return codec::fixed_string_view(data_ + 32, 64); }
+
+private:
+    const uint8_t* data_;
+};
+
+
+struct ExecRptSyncRsp final : public codec::BinaryCodec {
+    codec::List<SubExecRptSyncRsp> subExecRptSyncRsp;
 
-struct ExecRptSyncRsp : public codec::BinaryCodec {
-    std::vector<SubExecRptSyncRsp> subExecRptSyncRsp;
+    enum class Field : uint8_t {
+        subExecRptSyncRsp,
+    };
 
     void encode(ByteBuf& buf) const override {
         codec::write_object_List<uint16_t>(buf,subExecRptSyncRsp);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        subExecRptSyncRsp = codec::read_object_List<uint16_t,SubExecRptSyncRsp>(buf);
+    void decode(ByteBufView& buf) override {
+        subExecRptSyncRsp = codec::read_object_List<uint16_t,SubExecRptSyncRsp,codec::List<SubExecRptSyncRsp>>(buf);
+    }
+    
+
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::subExecRptSyncRsp)) subExecRptSyncRsp = codec::read_object_List<uint16_t,SubExecRptSyncRsp,codec::List<SubExecRptSyncRsp>>(buf);
+        else codec::skip_object_List<uint16_t,SubExecRptSyncRsp>(buf);
+    }
+    
+
+    size_t encodedSize() const override {
+        return codec::object_list_size<uint16_t>(subExecRptSyncRsp);
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExecRptSyncRsp*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExecRptSyncRsp)) return false;
+        const auto* checkType = static_cast<const ExecRptSyncRsp*>(&other);
         return subExecRptSyncRsp == checkType->subExecRptSyncRsp;
     }
     
@@ -1192,28 +2270,54 @@ inline std::ostream& operator<<(std::ostream& os, const ExecRptSyncRsp& pkt) {
 }
 
 
-struct ExecRptEndOfStream : public codec::BinaryCodec {
-    std::string pbu;
+struct ExecRptEndOfStream final : public codec::BinaryCodec {
+    codec::FixedString<8> pbu;
     uint32_t setId;
     uint64_t endReportIndex;
 
+    enum class Field : uint8_t {
+        pbu,
+        setId,
+        endReportIndex,
+    };
+
+    static constexpr size_t kWireSize = 20;
+
     void encode(ByteBuf& buf) const override {
-        codec::write_fixed_string(buf, pbu, 8);
-        buf.write_u32(setId);
-        buf.write_u64(endReportIndex);
+        auto out = buf.claim(kWireSize);
+        codec::write_fixed_string(out, pbu, 8);
+        out.write_u32(setId);
+        out.write_u64(endReportIndex);
     }
     
 
-    void decode(ByteBuf& buf) override {
-        pbu = codec::read_fixed_string(buf, 8);
+    void decode(ByteBufView& buf) override {
+        pbu = codec::read_fixed_string<8>(buf);
         setId = buf.read_u32();
         endReportIndex = buf.read_u64();
     }
     
 
+    // Decodes only the fields in `mask` and skips over the others, which keep their previous
+    // values; variable-length fields are still length-checked while skipped.
+    void decode(ByteBufView& buf, codec::FieldMask<Field> mask) {
+        if(mask.has(Field::pbu)) pbu = codec::read_fixed_string<8>(buf);
+        else buf.skip_bytes(8);
+        if(mask.has(Field::setId)) setId = buf.read_u32();
+        else buf.skip_bytes(4);
+        if(mask.has(Field::endReportIndex)) endReportIndex = buf.read_u64();
+        else buf.skip_bytes(8);
+    }
+    
+
+    size_t encodedSize() const override {
+        return kWireSize;
+    }
+    
+
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const ExecRptEndOfStream*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(ExecRptEndOfStream)) return false;
+        const auto* checkType = static_cast<const ExecRptEndOfStream*>(&other);
         return pbu == checkType->pbu
                && setId == checkType->setId
                && endReportIndex == checkType->endReportIndex;
@@ -1237,65 +2341,185 @@ inline std::ostream& operator<<(std::ostream& os, const ExecRptEndOfStream& pkt)
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded ExecRptEndOfStream: each accessor decodes one field in place from the
+// wire bytes. Covers the first 20 bytes, the part of the layout with fixed offsets.
+class ExecRptEndOfStreamView {
+public:
+    static constexpr size_t kFixedSize = 20;
+
+    explicit ExecRptEndOfStreamView(const ByteBufView& buf) : data_(buf.data() + buf.reader_index()) {
+        if(buf.readable_bytes() < kFixedSize) throw std::out_of_range("Not enough data to read");
+    }
+
+    std::string_view pbu() const { return codec::fixed_string_view(data_ + 0, 8); }
+    uint32_t setId() const { return DefaultByteOrder::load<uint32_t>(data_ + 8); }
+    uint64_t endReportIndex() const { return DefaultByteOrder::load<uint64_t>(data_ + 12); }
+
+private:
+    const uint8_t* data_;
+};
+
+// Setters for the fixed-offset fields of an encoded SseBinary frame carrying a ExecRptEndOfStream.
+struct ExecRptEndOfStreamWire {
+    static void setPbu(codec::FramePatcher& frame, std::string_view pbu) { frame.put_fixed_string(frame.spec().headerSize + 0, pbu, 8); }
+    static void setSetId(codec::FramePatcher& frame, uint32_t setId) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 8, setId); }
+    static void setEndReportIndex(codec::FramePatcher& frame, uint64_t endReportIndex) { frame.put<DefaultByteOrder>(frame.spec().headerSize + 12, endReportIndex); }
+};
+
 
 struct SseBinaryTag{};
 using SseBinaryMessageFactory = MessageFactory<uint32_t, codec::BinaryCodec, SseBinaryTag>;
-REGISTER_MESSAGE(SseBinaryMessageFactory, 33, Heartbeat);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 40, Logon);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 41, Logout);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 58, NewOrderSingle);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 61, OrderCancel);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 32, Confirm);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 59, CancelReject);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 103, Report);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 204, OrderReject);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 209, PlatformState);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 208, ExecRptInfo);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 206, ExecRptSync);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 207, ExecRptSyncRsp);
-REGISTER_MESSAGE(SseBinaryMessageFactory, 210, ExecRptEndOfStream);
-
-
-struct SseBinary : public codec::BinaryCodec {
+template <>
+struct GeneratedMessages<SseBinaryTag> {
+    static constexpr bool kEnabled = true;
+
+    static std::unique_ptr<codec::BinaryCodec> create(uint32_t key) {
+        switch(key) {
+            case 33:
+                return std::make_unique<Heartbeat>();
+            case 40:
+                return std::make_unique<Logon>();
+            case 41:
+                return std::make_unique<Logout>();
+            case 58:
+                return std::make_unique<NewOrderSingle>();
+            case 61:
+                return std::make_unique<OrderCancel>();
+            case 32:
+                return std::make_unique<Confirm>();
+            case 59:
+                return std::make_unique<CancelReject>();
+            case 103:
+                return std::make_unique<Report>();
+            case 204:
+                return std::make_unique<OrderReject>();
+            case 209:
+                return std::make_unique<PlatformState>();
+            case 208:
+                return std::make_unique<ExecRptInfo>();
+            case 206:
+                return std::make_unique<ExecRptSync>();
+            case 207:
+                return std::make_unique<ExecRptSyncRsp>();
+            case 210:
+                return std::make_unique<ExecRptEndOfStream>();
+            default:
+                return nullptr;
+        }
+    }
+};
+using SseBinaryBody = codec::InlineMessage<Heartbeat, Logon, Logout, NewOrderSingle, OrderCancel, Confirm, CancelReject, Report, OrderReject, PlatformState, ExecRptInfo, ExecRptSync, ExecRptSyncRsp, ExecRptEndOfStream>;
+
+
+// Header/length/trailer layout of a SseBinary frame, for codec::StreamFramer.
+inline constexpr codec::FrameSpec SseBinaryFrameSpec{16, 12, 4};
+
+// Decode-time checksum verification for SseBinary frames (off unless enabled with setMode()).
+inline ChecksumVerifier<uint32_t> SseBinaryChecksumVerifier;
+
+struct SseBinary final : public codec::BinaryCodec {
     uint32_t msgType;
     uint64_t msgSeqNum;
     uint32_t msgBodyLen;
-    std::unique_ptr<codec::BinaryCodec> body;
+    SseBinaryBody body;
     uint32_t checksum;
 
     void encode(ByteBuf& buf) const override {
-        buf.write_u32(msgType);
-        buf.write_u64(msgSeqNum);
-        auto msgBodyLenPos = buf.writer_index();
-        buf.write_u32(0);
-        auto bodyStart = buf.writer_index();
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("SSE_BIN");
+        ChecksumWriteTap<uint32_t> checksumTap(checksumHandle.get(), buf);
+        auto bodyLen_ = static_cast<uint32_t>(body->encodedSize());
+        buf.ensure_writable(20 + bodyLen_);
+        auto out = buf.claim(16);
+        out.write_u32(msgType);
+        out.write_u64(msgSeqNum);
+        out.write_u32(bodyLen_);
         body->encode(buf);
-        auto bodyEnd = buf.writer_index();
-        auto bodyLen_ = static_cast<unsigned int>(bodyEnd - bodyStart);
-        buf.write_u32_at(msgBodyLenPos, bodyLen_);
-        auto service = ChecksumServiceContext::instance().get<ByteBuf, uint32_t>("SSE_BIN");
-        if(service != nullptr){
-            auto cs = service->calc(buf);
-            buf.write_u32(cs);
+        if(checksumTap.enabled()){
+            buf.write_u32(checksumTap.value());
         } else {
             buf.write_u32(checksum);
         }
     }
     
 
-    void decode(ByteBuf& buf) override {
+    // Like decode(), but a msgType without a body returns false instead of throwing. buf is then
+    // left partway through the message.
+    bool tryDecode(ByteBufView& buf) {
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("SSE_BIN");
+        ChecksumReadTap<uint32_t> checksumTap(SseBinaryChecksumVerifier.sample() ? checksumHandle.get() : nullptr, buf);
         msgType = buf.read_u32();
         msgSeqNum = buf.read_u64();
         msgBodyLen = buf.read_u32();
-        body = SseBinaryMessageFactory::getInstance().create(msgType);
-        body->decode(buf);
-        checksum = buf.read_u32();
+        switch(msgType) {
+            case 33:
+                body.emplace<Heartbeat>().decode(buf);
+                break;
+            case 40:
+                body.emplace<Logon>().decode(buf);
+                break;
+            case 41:
+                body.emplace<Logout>().decode(buf);
+                break;
+            case 58:
+                body.emplace<NewOrderSingle>().decode(buf);
+                break;
+            case 61:
+                body.emplace<OrderCancel>().decode(buf);
+                break;
+            case 32:
+                body.emplace<Confirm>().decode(buf);
+                break;
+            case 59:
+                body.emplace<CancelReject>().decode(buf);
+                break;
+            case 103:
+                body.emplace<Report>().decode(buf);
+                break;
+            case 204:
+                body.emplace<OrderReject>().decode(buf);
+                break;
+            case 209:
+                body.emplace<PlatformState>().decode(buf);
+                break;
+            case 208:
+                body.emplace<ExecRptInfo>().decode(buf);
+                break;
+            case 206:
+                body.emplace<ExecRptSync>().decode(buf);
+                break;
+            case 207:
+                body.emplace<ExecRptSyncRsp>().decode(buf);
+                break;
+            case 210:
+                body.emplace<ExecRptEndOfStream>().decode(buf);
+                break;
+            default:
+                return false;
+        }
+        if(checksumTap.enabled()){
+            const uint32_t actual = checksumTap.value();
+            checksum = buf.read_u32();
+            SseBinaryChecksumVerifier.verify(actual, checksum);
+        } else {
+            checksum = buf.read_u32();
+        }
+        return true;
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        if(!tryDecode(buf)) throw std::runtime_error("No such message type");
+    }
+    
+
+    size_t encodedSize() const override {
+        return 20 + body->encodedSize();
     }
     
 
     bool equals(const BinaryCodec& other) const override {
-        const auto* checkType = dynamic_cast<const SseBinary*>(&other);
-        if(!checkType) return false;
+        if(typeid(other) != typeid(SseBinary)) return false;
+        const auto* checkType = static_cast<const SseBinary*>(&other);
         return msgType == checkType->msgType
                && msgSeqNum == checkType->msgSeqNum
                && msgBodyLen == checkType->msgBodyLen
@@ -1325,4 +2549,131 @@ inline std::ostream& operator<<(std::ostream& os, const SseBinary& pkt) {
     return os << pkt.toString();
 }
 
+// Read-only overlay of an encoded SseBinary frame: header fields, the body bytes and the trailer,
+// without decoding the body. Pair it with the body type's own View to route on a few fields.
+class SseBinaryView {
+public:
+    static constexpr size_t kHeaderSize = 16;
+    static constexpr size_t kTrailerSize = 4;
+
+    explicit SseBinaryView(const ByteBufView& buf)
+        : data_(buf.data() + buf.reader_index()), size_(buf.readable_bytes()) {
+        if(size_ < kHeaderSize || size_ < frameSize()) throw std::out_of_range("Not enough data to read");
+    }
+
+    uint32_t msgType() const { return DefaultByteOrder::load<uint32_t>(data_ + 0); }
+    uint64_t msgSeqNum() const { return DefaultByteOrder::load<uint64_t>(data_ + 4); }
+    uint32_t msgBodyLen() const { return DefaultByteOrder::load<uint32_t>(data_ + 12); }
+    ByteBufView body() const { return ByteBufView(data_ + kHeaderSize, msgBodyLen()); }
+    uint32_t checksum() const { return DefaultByteOrder::load<uint32_t>(data_ + kHeaderSize + msgBodyLen()); }
+    size_t frameSize() const { return kHeaderSize + msgBodyLen() + kTrailerSize; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+};
+
+// Entry point for patching encoded SseBinary frames: patch() wraps a frame, the body's XWire
+// setters change its fields and the checksum trailer follows.
+struct SseBinaryWire {
+    static codec::FramePatcher patch(uint8_t* frame, size_t len) {
+        return codec::FramePatcher(frame, len, SseBinaryFrameSpec, codec::TrailerUpdate::kByteSum);
+    }
+
+    static codec::FramePatcher patch(ByteBuf& buf, size_t frameStart = 0) {
+        return patch(buf.mutable_data() + frameStart, buf.size() - frameStart);
+    }
+
+    // Encodes the frame `prototype` once as the constant part of a send template.
+    static codec::FrameTemplate makeTemplate(const codec::BinaryCodec& prototype) {
+        return codec::FrameTemplate(prototype, SseBinaryFrameSpec, codec::TrailerUpdate::kByteSum);
+    }
+
+    static void setMsgSeqNum(codec::FramePatcher& frame, uint64_t msgSeqNum) { frame.put<DefaultByteOrder>(4, msgSeqNum); }
+};
+
+// SseBinary with the body type fixed at compile time: same wire format, but the body is held
+// by value and its encode/decode/encodedSize calls bind statically, so the whole frame encode
+// can be inlined. Still a codec::BinaryCodec for callers that only have the virtual interface.
+template <typename Body>
+struct SseBinaryFrame final : public codec::BinaryCodec {
+    uint32_t msgType;
+    uint64_t msgSeqNum;
+    uint32_t msgBodyLen;
+    Body body;
+    uint32_t checksum;
+
+    void encode(ByteBuf& buf) const override {
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("SSE_BIN");
+        ChecksumWriteTap<uint32_t> checksumTap(checksumHandle.get(), buf);
+        auto bodyLen_ = static_cast<uint32_t>(body.encodedSize());
+        buf.ensure_writable(20 + bodyLen_);
+        auto out = buf.claim(16);
+        out.write_u32(msgType);
+        out.write_u64(msgSeqNum);
+        out.write_u32(bodyLen_);
+        body.encode(buf);
+        if(checksumTap.enabled()){
+            buf.write_u32(checksumTap.value());
+        } else {
+            buf.write_u32(checksum);
+        }
+    }
+    
+
+    void decode(ByteBufView& buf) override {
+        static thread_local ChecksumHandle<ByteBuf, uint32_t> checksumHandle("SSE_BIN");
+        ChecksumReadTap<uint32_t> checksumTap(SseBinaryChecksumVerifier.sample() ? checksumHandle.get() : nullptr, buf);
+        msgType = buf.read_u32();
+        msgSeqNum = buf.read_u64();
+        msgBodyLen = buf.read_u32();
+        body.decode(buf);
+        if(checksumTap.enabled()){
+            const uint32_t actual = checksumTap.value();
+            checksum = buf.read_u32();
+            SseBinaryChecksumVerifier.verify(actual, checksum);
+        } else {
+            checksum = buf.read_u32();
+        }
+    }
+    
+
+    size_t encodedSize() const override {
+        return 20 + body.encodedSize();
+    }
+    
+
+    bool equals(const BinaryCodec& other) const override {
+        if(typeid(other) != typeid(SseBinaryFrame)) return false;
+        const auto* checkType = static_cast<const SseBinaryFrame*>(&other);
+        return msgType == checkType->msgType
+               && msgSeqNum == checkType->msgSeqNum
+               && msgBodyLen == checkType->msgBodyLen
+               && body.equals(checkType->body)
+               && checksum == checkType->checksum;
+    }
+    
+    std::string toString() const override {
+        std::ostringstream oss;
+        oss << "SseBinary { "
+        << "MsgType: " << std::to_string(msgType)
+        << ", "
+        << "MsgSeqNum: " << std::to_string(msgSeqNum)
+        << ", "
+        << "MsgBodyLen: " << std::to_string(msgBodyLen)
+        << ", "
+        << "Body: " << body.toString()
+        << ", "
+        << "Checksum: " << std::to_string(checksum)
+        << " }";
+        return oss.str();
+    }
+    
+};
+
+template <typename Body>
+inline std::ostream& operator<<(std::ostream& os, const SseBinaryFrame<Body>& pkt) {
+    return os << pkt.toString();
+}
+
 
@@ -0,0 +1,127 @@
+// Copyright 2025 xinchentechnote
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "bytebuf.hpp"
+
+namespace codec {
+
+// ----------------------------
+// FrameSpec
+// ----------------------------
+// Where a protocol's frame length lives: a fixed header of `headerSize` bytes carrying the body
+// length as a little-endian u32 at `lengthOffset`, then the body, then `trailerSize` bytes
+// (the checksum, if any). The generated headers define one per protocol (SzseBinaryFrameSpec, ...).
+struct FrameSpec {
+  size_t headerSize;
+  size_t lengthOffset;
+  size_t trailerSize;
+
+  uint32_t bodyLength(const uint8_t* header) const {
+    return LittleEndian::load<uint32_t>(header + lengthOffset);
+  }
+  size_t frameSize(const uint8_t* header) const {
+    return headerSize + bodyLength(header) + trailerSize;
+  }
+};
+
+// ----------------------------
+// StreamFramer
+// ----------------------------
+// Cuts a TCP byte stream into whole frames. feed() takes read chunks of any size and returns the
+// frames they complete as views: frames that arrived whole point straight into the chunk, and
+// only a frame split across reads is copied, into a reassembly buffer. The views stay valid until
+// the next feed() (and as long as the chunk itself is alive).
+class StreamFramer {
+ public:
+  static constexpr size_t kDefaultMaxFrameSize = 16 * 1024 * 1024;
+
+  explicit StreamFramer(FrameSpec spec, size_t maxFrameSize = kDefaultMaxFrameSize)
+      : spec_(spec), maxFrameSize_(maxFrameSize), pending_(0), assembled_(0) {}
+
+  const std::vector<ByteBufView>& feed(const uint8_t* data, size_t len) {
+    frames_.clear();
+    assembled_.reset();
+    if (pending_.size() > 0) {
+      size_t used = fill_pending(data, len);
+      data += used;
+      len -= used;
+      if (pending_.size() < spec_.headerSize || pending_.size() < pendingFrameSize_) {
+        return frames_;
+      }
+      std::swap(pending_, assembled_);
+      pending_.reset();
+      pendingFrameSize_ = 0;
+      frames_.emplace_back(assembled_.data(), assembled_.size());
+    }
+    while (len >= spec_.headerSize) {
+      size_t frameSize = checked_frame_size(data);
+      if (len < frameSize) break;
+      frames_.emplace_back(data, frameSize);
+      data += frameSize;
+      len -= frameSize;
+    }
+    if (len > 0) fill_pending(data, len);
+    return frames_;
+  }
+
+  // Bytes still missing before the next frame can be returned: the rest of the header while it
+  // is incomplete, then the rest of the frame it announces.
+  size_t needed() const {
+    if (pending_.size() < spec_.headerSize) return spec_.headerSize - pending_.size();
+    return pendingFrameSize_ - pending_.size();
+  }
+
+  // Bytes of a partial frame held between feed() calls.
+  size_t buffered() const { return pending_.size(); }
+
+  const FrameSpec& spec() const { return spec_; }
+
+  void reset() {
+    frames_.clear();
+    pending_.reset();
+    assembled_.reset();
+    pendingFrameSize_ = 0;
+  }
+
+ private:
+  size_t checked_frame_size(const uint8_t* header) const {
+    size_t frameSize = spec_.frameSize(header);
+    if (frameSize > maxFrameSize_) {
+      throw std::runtime_error("Frame length exceeds limit");
+    }
+    return frameSize;
+  }
+
+  // Copies as much of [data, data + len) into the pending frame as it still needs (the header
+  // first, then the rest of the frame once its size is known); returns the bytes taken.
+  size_t fill_pending(const uint8_t* data, size_t len) {
+    size_t used = 0;
+    if (pending_.size() < spec_.headerSize) {
+      size_t take = std::min(len, spec_.headerSize - pending_.size());
+      pending_.write_bytes(data, take);
+      used += take;
+      if (pending_.size() < spec_.headerSize) return used;
+      pendingFrameSize_ = checked_frame_size(pending_.data());
+      pending_.ensure_writable(pendingFrameSize_ - pending_.size());
+    }
+    size_t take = std::min(len - used, pendingFrameSize_ - pending_.size());
+    pending_.write_bytes(data + used, take);
+    return used + take;
+  }
+
+  FrameSpec spec_;
+  size_t maxFrameSize_;
+  ByteBuf pending_;
+  ByteBuf assembled_;
+  size_t pendingFrameSize_ = 0;
+  std::vector<ByteBufView> frames_;
+};
+
+}  // namespace codec
@@ -3,6 +3,16 @@
 #include "include/bjse_binary.hpp"
 #include <gtest/gtest.h>
 
+// Detects a generated XWire setter, to check that selector fields have none.
+template <typename Wire, typename = void>
+struct HasSetApplId : std::false_type {};
+template <typename Wire>
+struct HasSetApplId<Wire, std::void_t<decltype(&Wire::setApplId)>> : std::true_type {};
+template <typename Wire, typename = void>
+struct HasSetMsgType : std::false_type {};
+template <typename Wire>
+struct HasSetMsgType<Wire, std::void_t<decltype(&Wire::setMsgType)>> : std::true_type {};
+
 TEST(LogonTest, EncodeAndDeocde) {
     Logon original;
     original.senderCompId = "xxxxxxxxxxxxxxxxxxxx";
@@ -1232,3 +1242,12 @@ TEST(BjseBinaryTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+
+TEST(BjseBinaryWireTest, NoSelectorSetters) {
+    EXPECT_FALSE(HasSetMsgType<BjseBinaryWire>::value);
+    EXPECT_FALSE(HasSetApplId<NewOrderWire>::value);
+    EXPECT_FALSE(HasSetApplId<OrderCancelRequestWire>::value);
+    EXPECT_FALSE(HasSetApplId<CancelRejectWire>::value);
+    EXPECT_FALSE(HasSetApplId<ExecutionConfirmWire>::value);
+    EXPECT_FALSE(HasSetApplId<ExecutionReportWire>::value);
+}
@@ -3,6 +3,33 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// Counts global allocations, so tests can check that a path stays off the heap.
+static std::atomic<size_t> gAllocations{0};
+
+void* operator new(std::size_t size) {
+  ++gAllocations;
+  if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc();
+}
+void* operator new(std::size_t size, std::align_val_t align) {
+  ++gAllocations;
+  const auto alignment = static_cast<std::size_t>(align);
+  if (void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
 TEST(ByteBufTest, BasicWriteReadU8) {
   ByteBuf buf;
   buf.write_u8(123);
@@ -91,3 +118,189 @@ TEST(ByteBufTest, ReadableWritableBytes) {
   buf.read_u16();
   EXPECT_EQ(buf.readable_bytes(), 2);
 }
+
+TEST(ByteBufViewTest, ReadsExternalMemoryInPlace) {
+  const uint8_t frame[] = {0x01, 0x02, 0x00, 0x78, 0x56, 0x34, 0x12, 'a', 'b'};
+  ByteBufView view(frame, sizeof(frame));
+  EXPECT_EQ(view.read_u8(), 0x01);
+  EXPECT_EQ(view.read_u16(), 0x0002);
+  EXPECT_EQ(view.read_u32(), 0x12345678u);
+  char tail[2];
+  view.read_bytes(tail, 2);
+  EXPECT_EQ(tail[0], 'a');
+  EXPECT_EQ(tail[1], 'b');
+  EXPECT_EQ(view.readable_bytes(), 0);
+  EXPECT_THROW(view.read_u8(), std::out_of_range);
+}
+
+TEST(ByteBufViewTest, ViewOfByteBufStartsAtReaderIndex) {
+  ByteBuf buf;
+  buf.write_u16(7);
+  buf.write_u64(0x1122334455667788);
+  buf.read_u16();
+  ByteBufView view = buf.view();
+  EXPECT_EQ(view.readable_bytes(), 8);
+  EXPECT_EQ(view.read_u64(), 0x1122334455667788);
+  EXPECT_EQ(buf.readable_bytes(), 8);
+}
+
+TEST(ByteBufViewTest, SkipBytes) {
+  const uint8_t frame[] = {1, 2, 3, 4};
+  ByteBufView view(frame, sizeof(frame));
+  view.skip_bytes(3);
+  EXPECT_EQ(view.reader_index(), 3);
+  EXPECT_EQ(view.read_u8(), 4);
+  EXPECT_THROW(view.skip_bytes(1), std::out_of_range);
+}
+
+TEST(ByteBufTest, ByteOrderLayout) {
+  ByteBuf buf;
+  buf.write_be<uint32_t>(0x01020304);
+  buf.write_le<uint32_t>(0x01020304);
+  buf.write_u16(0x0A0B);
+  const std::vector<uint8_t> expected = {1, 2, 3, 4, 4, 3, 2, 1, 0x0B, 0x0A};
+  EXPECT_EQ(std::vector<uint8_t>(buf.data(), buf.data() + buf.size()), expected);
+  EXPECT_EQ(buf.read_be<uint32_t>(), 0x01020304u);
+  EXPECT_EQ(buf.read_le<uint32_t>(), 0x01020304u);
+  EXPECT_EQ((buf.read_as<BigEndian, uint16_t>()), 0x0B0A);
+}
+
+TEST(ByteBufTest, BigEndianFloatAndPatch) {
+  ByteBuf buf;
+  buf.write_as<BigEndian>(1.5);
+  buf.write_as<BigEndian, int16_t>(0);
+  buf.write_as_at<BigEndian, int16_t>(8, -2);
+  EXPECT_EQ(buf.data()[0], 0x3F);
+  EXPECT_EQ(buf.data()[1], 0xF8);
+  EXPECT_EQ(buf.read_be<double>(), 1.5);
+  EXPECT_EQ(buf.read_be<int16_t>(), -2);
+  EXPECT_THROW((buf.write_as_at<BigEndian, int16_t>(9, 0)), std::out_of_range);
+}
+
+TEST(ByteBufTest, ClaimWritesThroughCursor) {
+  ByteBuf buf(4);
+  buf.write_u8(9);
+  auto out = buf.claim(11);
+  EXPECT_GE(buf.capacity(), 12u);
+  out.write_u16_le(0x0102);
+  out.write_bytes("ab", 2);
+  out.fill(' ', 3);
+  out.write_u32(7);
+  EXPECT_EQ(out.remaining(), 0u);
+  EXPECT_EQ(buf.writer_index(), 12u);
+  EXPECT_EQ(buf.read_u8(), 9);
+  EXPECT_EQ(buf.read_u16_le(), 0x0102);
+  char text[5];
+  buf.read_bytes(text, 5);
+  EXPECT_EQ(std::string(text, 5), "ab   ");
+  EXPECT_EQ(buf.read_u32(), 7u);
+}
+
+TEST(ByteBufTest, WriterIndexCountsEveryByte) {
+  ByteBuf buf;
+  buf.write_u8(1);
+  buf.write_bytes("xyz", 3);
+  buf.write_u32(2);
+  EXPECT_EQ(buf.writer_index(), 8u);
+  buf.write_u8_at(0, 5);
+  EXPECT_EQ(buf.read_u8(), 5);
+}
+
+TEST(ByteBufTest, CopyAndMoveKeepContents) {
+  ByteBuf buf(2);
+  for (uint32_t i = 0; i < 100; ++i) buf.write_u32(i);
+  buf.read_u32();
+
+  ByteBuf copy(buf);
+  EXPECT_EQ(copy.readable_bytes(), 396u);
+  EXPECT_EQ(copy.read_u32(), 1u);
+
+  ByteBuf moved(std::move(buf));
+  EXPECT_EQ(moved.read_u32(), 1u);
+  EXPECT_EQ(buf.readable_bytes(), 0u);
+
+  copy = moved;
+  EXPECT_EQ(copy.read_u32(), 2u);
+}
+
+TEST(SmallByteBufTest, StaysInlineUntilFull) {
+  SmallByteBuf<32> buf;
+  EXPECT_TRUE(buf.is_inline());
+  EXPECT_EQ(buf.capacity(), 32u);
+  for (uint32_t i = 0; i < 8; ++i) buf.write_u32(i);
+  EXPECT_TRUE(buf.is_inline());
+  buf.write_u8(0xAB);
+  EXPECT_FALSE(buf.is_inline());
+  for (uint32_t i = 0; i < 8; ++i) EXPECT_EQ(buf.read_u32(), i);
+  EXPECT_EQ(buf.read_u8(), 0xAB);
+}
+
+TEST(SmallByteBufTest, CopyAndMoveBetweenInlineAndHeap) {
+  SmallByteBuf<16> small;
+  small.write_u64(42);
+  ByteBuf& asBase = small;
+  asBase.write_u32(7);
+
+  ByteBuf heap(std::move(small));
+  EXPECT_EQ(heap.read_u64(), 42u);
+  EXPECT_EQ(heap.read_u32(), 7u);
+  EXPECT_EQ(small.readable_bytes(), 0u);
+  EXPECT_TRUE(small.is_inline());
+
+  SmallByteBuf<16> copy(heap);
+  EXPECT_TRUE(copy.is_inline());
+  EXPECT_EQ(copy.readable_bytes(), 0u);
+  EXPECT_EQ(copy.size(), 12u);
+
+  ByteBuf big;
+  for (int i = 0; i < 10; ++i) big.write_u32(i);
+  SmallByteBuf<16> stolen;
+  stolen = SmallByteBuf<16>(big);
+  EXPECT_FALSE(stolen.is_inline());
+  EXPECT_EQ(stolen.size(), 40u);
+}
+
+TEST(SmallByteBufTest, ReuseAfterMoveStaysInline) {
+  static_assert(std::is_nothrow_move_constructible_v<SmallByteBuf<32>>);
+  static_assert(std::is_nothrow_move_assignable_v<SmallByteBuf<32>>);
+  static_assert(!std::is_nothrow_move_constructible_v<ByteBuf>);
+
+  SmallByteBuf<32> spilled;
+  for (uint32_t i = 0; i < 16; ++i) spilled.write_u32(i);
+  ASSERT_FALSE(spilled.is_inline());
+  SmallByteBuf<32> stolen(std::move(spilled));
+  ByteBuf plain(std::move(stolen));
+  EXPECT_EQ(plain.size(), 64u);
+
+  SmallByteBuf<32> small;
+  small.write_u64(42);
+  SmallByteBuf<32> moved;
+  const size_t before = gAllocations.load();
+  moved = std::move(small);
+  for (uint32_t i = 0; i < 8; ++i) spilled.write_u32(i);
+  stolen.write_u64(7);
+  small.write_u64(9);
+  EXPECT_EQ(gAllocations.load(), before);
+
+  EXPECT_TRUE(spilled.is_inline());
+  EXPECT_TRUE(stolen.is_inline());
+  EXPECT_TRUE(small.is_inline());
+  EXPECT_EQ(spilled.capacity(), 32u);
+  EXPECT_EQ(moved.read_u64(), 42u);
+  EXPECT_EQ(stolen.read_u64(), 7u);
+}
+
+TEST(ByteBufTest, StorageComesFromResource) {
+  std::byte block[1024];
+  std::pmr::monotonic_buffer_resource arena(block, sizeof(block),
+                                            std::pmr::null_memory_resource());
+  ByteBuf buf(64, &arena);
+  for (uint32_t i = 0; i < 100; ++i) buf.write_u32(i);
+  EXPECT_EQ(buf.resource(), &arena);
+  EXPECT_GE(buf.data(), reinterpret_cast<const uint8_t*>(block));
+  EXPECT_LT(buf.data(), reinterpret_cast<const uint8_t*>(block) + sizeof(block));
+
+  ByteBuf moved(std::move(buf));
+  EXPECT_EQ(moved.resource(), &arena);
+  EXPECT_EQ(moved.read_u32(), 0u);
+}
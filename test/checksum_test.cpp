@@ -27,6 +27,58 @@ TEST(Crc32ChecksumServiceTest, HandlesEmptyBuffer) {
   EXPECT_EQ(result, 0u);
 }
 
+namespace {
+std::vector<uint8_t> PseudoRandomBytes(size_t len) {
+  std::vector<uint8_t> data(len);
+  uint32_t state = 2463534242u;
+  for (auto& b : data) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    b = static_cast<uint8_t>(state);
+  }
+  return data;
+}
+
+uint16_t Crc16Bitwise(const uint8_t* p, size_t len) {
+  uint16_t crc = 0xFFFF;
+  for (size_t n = 0; n < len; ++n) {
+    crc ^= p[n];
+    for (int i = 0; i < 8; i++) crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+  }
+  return crc;
+}
+}  // namespace
+
+TEST(Crc16ChecksumServiceTest, MatchesBitwiseLoop) {
+  auto data = PseudoRandomBytes(1031);
+  for (size_t len : {0, 1, 7, 8, 9, 16, 63, 64, 100, 1031}) {
+    EXPECT_EQ(crc::crc16_modbus(data.data(), len), Crc16Bitwise(data.data(), len)) << len;
+  }
+  ByteBuf buf;
+  buf.write_bytes(data.data(), data.size());
+  EXPECT_EQ(Crc16ChecksumService().calc(buf), Crc16Bitwise(data.data(), data.size()));
+}
+
+TEST(Crc32ChecksumServiceTest, MatchesZlib) {
+  auto data = PseudoRandomBytes(4096 + 45);
+  for (size_t len : {0, 15, 16, 63, 64, 65, 79, 80, 127, 128, 1000, 4096 + 40}) {
+    for (size_t offset : {0, 3}) {
+      const uint8_t* p = data.data() + offset;
+      uint32_t expected = ::crc32(0, p, len);
+      EXPECT_EQ(crc::crc32(0, p, len), expected) << len;
+      // Continuing from a previous value must also agree with zlib.
+      EXPECT_EQ(crc::crc32(0x12345678u, p, len), ::crc32(0x12345678u, p, len)) << len;
+#if defined(CRC_HAVE_RUNTIME_PCLMUL)
+      if (len >= 64 && crc::detail::has_pclmul()) {
+        size_t chunk = len & ~size_t{15};
+        EXPECT_EQ(~crc::detail::crc32_fold_pclmul(p, chunk, ~0u), ::crc32(0, p, chunk)) << len;
+      }
+#endif
+    }
+  }
+}
+
 TEST(SseBinChecksumServiceTest, HandlesKnownInpur) {
   ByteBuf buf;
   buf.write_bytes(std::vector<uint8_t>{1, 2, 3}.data(), 3);
@@ -43,6 +95,18 @@ TEST(SzseBinChecksumServiceTest, HandlesKnownInpur) {
   EXPECT_EQ(checksum, 6);
 }
 
+TEST(SzseBinChecksumServiceTest, LargeFrameMatchesByteLoop) {
+  ByteBuf buf;
+  int32_t expected = 0;
+  for (size_t i = 0; i < 1000; ++i) {
+    uint8_t b = static_cast<uint8_t>(i * 37 + 11);
+    buf.write_u8(b);
+    expected += b;
+  }
+  EXPECT_EQ(SzseBinChecksumService().calc(buf), expected % 256);
+  EXPECT_EQ(SseBinChecksumService().calc(buf), static_cast<uint32_t>(expected % 256));
+}
+
 TEST(ChecksumServiceContextTest, HandlesKnownInpur) {
   ByteBuf buf;
   buf.write_bytes(std::vector<uint8_t>{1, 2, 3}.data(), 3);
@@ -50,3 +114,149 @@ TEST(ChecksumServiceContextTest, HandlesKnownInpur) {
   uint32_t checksum = svc->calc(buf);
   EXPECT_EQ(checksum, 6);
 }
+
+class ConstantSseChecksumService : public ChecksumService<ByteBuf, uint32_t> {
+ public:
+  std::string algorithm() const override { return "SSE_BIN"; }
+  uint32_t calc(const ByteBuf&) const override { return 42; }
+};
+
+TEST(ChecksumServiceContextTest, HandleFollowsOverride) {
+  ByteBuf buf;
+  buf.write_bytes(std::vector<uint8_t>{1, 2, 3}.data(), 3);
+  auto& ctx = ChecksumServiceContext::instance();
+  ChecksumHandle<ByteBuf, uint32_t> handle("SSE_BIN");
+  ASSERT_NE(handle.get(), nullptr);
+  EXPECT_EQ(handle.get()->calc(buf), 6);
+  EXPECT_EQ(handle.get(), handle.get());
+
+  EXPECT_FALSE(ctx.registerService(std::make_shared<ConstantSseChecksumService>()));
+  uint64_t before = ctx.version();
+  ctx.overrideService(std::make_shared<ConstantSseChecksumService>());
+  EXPECT_GT(ctx.version(), before);
+  EXPECT_EQ(handle.get()->calc(buf), 42);
+
+  ctx.overrideService(std::make_shared<SseBinChecksumService>());
+  EXPECT_EQ(handle.get()->calc(buf), 6);
+}
+
+TEST(ChecksumServiceContextTest, HandleWithWrongSignatureIsNull) {
+  ChecksumHandle<ByteBuf, uint64_t> handle("SSE_BIN");
+  EXPECT_EQ(handle.get(), nullptr);
+  ChecksumHandle<ByteBuf, uint32_t> unknown("NO_SUCH_ALGO");
+  EXPECT_EQ(unknown.get(), nullptr);
+}
+
+TEST(ChecksumAccumulatorTest, SplitUpdatesMatchOneShot) {
+  auto data = PseudoRandomBytes(777);
+  ByteBuf buf;
+  buf.write_bytes(data.data(), data.size());
+  Crc16Accumulator crc16;
+  Crc32Accumulator crc32;
+  SseBinAccumulator sse;
+  SzseBinAccumulator szse;
+  for (size_t pos = 0; pos < data.size(); pos += 100) {
+    size_t len = std::min<size_t>(100, data.size() - pos);
+    crc16.update(data.data() + pos, len);
+    crc32.update(data.data() + pos, len);
+    sse.update(data.data() + pos, len);
+    szse.update(data.data() + pos, len);
+  }
+  EXPECT_EQ(crc16.value(), Crc16ChecksumService().calc(buf));
+  EXPECT_EQ(crc32.value(), Crc32ChecksumService().calc(buf));
+  EXPECT_EQ(sse.value(), SseBinChecksumService().calc(buf));
+  EXPECT_EQ(szse.value(), SzseBinChecksumService().calc(buf));
+}
+
+TEST(ChecksumServiceTest, CalcRangeFallsBackToCalc) {
+  std::vector<uint8_t> data{1, 2, 3};
+  EXPECT_EQ(ConstantSseChecksumService().calcRange(data.data(), data.size()), 42u);
+  EXPECT_EQ(SseBinChecksumService().calcRange(data.data() + 1, 2), 5u);
+}
+
+TEST(ChecksumServiceTest, StreamMatchesCalcRange) {
+  auto data = PseudoRandomBytes(500);
+  auto check = [&](const auto& svc) {
+    uint64_t state = 0;
+    ASSERT_TRUE(svc.beginStream(state));
+    for (size_t pos = 0; pos < data.size(); pos += 64) {
+      svc.updateStream(state, data.data() + pos, std::min<size_t>(64, data.size() - pos));
+    }
+    EXPECT_EQ(svc.finishStream(state), svc.calcRange(data.data(), data.size()));
+  };
+  check(Crc16ChecksumService());
+  check(Crc32ChecksumService());
+  check(SseBinChecksumService());
+  check(SzseBinChecksumService());
+
+  uint64_t state = 0;
+  EXPECT_FALSE(ConstantSseChecksumService().beginStream(state));
+}
+
+TEST(ChecksumWriteTapTest, FeedsTheWrittenBytes) {
+  auto data = PseudoRandomBytes(300);
+  Crc32ChecksumService crc32;
+  ByteBuf buf(16);
+  buf.write_u32(7);  // not part of the frame
+  const size_t frameStart = buf.size();
+  ChecksumWriteTap<uint32_t> tap(&crc32, buf);
+  EXPECT_TRUE(tap.enabled());
+  EXPECT_TRUE(buf.has_write_tap());
+  buf.write_u16(1);
+  auto out = buf.claim(100);
+  out.write_bytes(data.data(), 100);
+  buf.write_bytes(data.data() + 100, 200);
+  buf.write_u8(9);
+  uint32_t streamed = tap.value();
+  EXPECT_FALSE(buf.has_write_tap());
+  EXPECT_EQ(streamed, crc32.calcRange(buf.data() + frameStart, buf.size() - frameStart));
+}
+
+TEST(ChecksumWriteTapTest, FallsBackToCalcRange) {
+  ConstantSseChecksumService constant;
+  ByteBuf buf;
+  ChecksumWriteTap<uint32_t> tap(&constant, buf);
+  EXPECT_FALSE(buf.has_write_tap());
+  buf.write_u32(1);
+  EXPECT_EQ(tap.value(), 42u);
+
+  ChecksumWriteTap<uint32_t> none(nullptr, buf);
+  EXPECT_FALSE(none.enabled());
+  EXPECT_FALSE(buf.has_write_tap());
+}
+
+TEST(ChecksumReadTapTest, FeedsTheReadAndSkippedBytes) {
+  auto data = PseudoRandomBytes(300);
+  Crc32ChecksumService crc32;
+  ByteBufView view(data.data(), data.size());
+  view.skip_bytes(5);  // not part of the frame
+  {
+    ChecksumReadTap<uint32_t> tap(&crc32, view);
+    EXPECT_TRUE(view.has_read_tap());
+    view.read_u16();
+    view.read_span(70);
+    view.skip_bytes(100);
+    for (int i = 0; i < 20; ++i) view.read_u8();
+    EXPECT_EQ(tap.value(), crc32.calcRange(data.data() + 5, view.reader_index() - 5));
+    EXPECT_FALSE(view.has_read_tap());
+  }
+
+  ConstantSseChecksumService constant;
+  ChecksumReadTap<uint32_t> fallback(&constant, view);
+  EXPECT_FALSE(view.has_read_tap());
+  view.read_u32();
+  EXPECT_EQ(fallback.value(), 42u);
+}
+
+TEST(ChecksumReadTapTest, DetachesWhenTheDecodeThrows) {
+  std::vector<uint8_t> data(100, 1);
+  SseBinChecksumService sse;
+  ByteBufView view(data.data(), data.size());
+  try {
+    ChecksumReadTap<uint32_t> tap(&sse, view);
+    view.skip_bytes(80);
+    view.read_span(40);
+  } catch (const std::out_of_range&) {
+  }
+  EXPECT_FALSE(view.has_read_tap());
+}
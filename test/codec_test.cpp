@@ -36,6 +36,32 @@ TEST(CodecTest, FixedStringTruncation) {
   EXPECT_EQ(output, "12345");
 }
 
+TEST(CodecTest, PutAndGetFixedStringInline) {
+  static_assert(std::is_trivially_copyable_v<codec::FixedString<10>>);
+  ByteBuf buf;
+  codec::FixedString<10> clOrdId = "42";
+  codec::write_fixed_string(buf, clOrdId, 10, '0', true);
+  codec::write_fixed_string(buf, codec::FixedString<8>("600000"), 8);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(buf.data()), buf.size()),
+            "0000000042600000  ");
+
+  auto decodedClOrdId = codec::read_fixed_string<10>(buf, '0', true);
+  auto decodedSecurityId = codec::read_fixed_string<8>(buf);
+  EXPECT_EQ(decodedClOrdId, clOrdId);
+  EXPECT_EQ(decodedSecurityId, "600000");
+  EXPECT_EQ(decodedSecurityId.size(), 6);
+}
+
+TEST(CodecTest, FixedStringTruncatesToCapacity) {
+  codec::FixedString<5> s = std::string("1234567890");
+  EXPECT_EQ(s, "12345");
+  EXPECT_EQ(s.str(), std::string("12345"));
+
+  std::ostringstream oss;
+  oss << s;
+  EXPECT_EQ(oss.str(), "12345");
+}
+
 TEST(CodecTest, PutAndGetStringListLE) {
   ByteBuf buf;
   std::vector<std::string> input = {"one", "two", "three"};
@@ -49,6 +75,56 @@ TEST(CodecTest, PutAndGetStringListLE) {
   }
 }
 
+TEST(CodecTest, ReadFromByteBufView) {
+  ByteBuf buf;
+  codec::write_fixed_string(buf, "abc", 6);
+  codec::write_string<uint8_t>(buf, "hello");
+  std::vector<uint8_t> frame(buf.data(), buf.data() + buf.size());
+
+  ByteBufView view(frame.data(), frame.size());
+  EXPECT_EQ(codec::read_fixed_string(view, 6), "abc");
+  EXPECT_EQ(codec::read_string<uint8_t>(view), "hello");
+  EXPECT_EQ(view.readable_bytes(), 0);
+}
+
+TEST(CodecTest, BasicTypeListBulkByteOrder) {
+  ByteBuf buf;
+  codec::write_basic_type_as<BigEndian, uint16_t, uint32_t>(buf, {0x01020304, 0x0A0B0C0D});
+  codec::write_basic_type_le<uint16_t, uint16_t>(buf, {0x0102});
+  std::vector<uint8_t> expected = {0x00, 0x02, 0x01, 0x02, 0x03, 0x04, 0x0A, 0x0B, 0x0C, 0x0D,
+                                   0x01, 0x00, 0x02, 0x01};
+  EXPECT_EQ(std::vector<uint8_t>(buf.data(), buf.data() + buf.size()), expected);
+}
+
+template <typename K>
+void ExpectBasicTypeListRoundTrip() {
+  for (size_t n : {0, 1, 3, 7, 8, 15, 16, 33, 100}) {
+    std::vector<K> input(n);
+    for (size_t i = 0; i < n; ++i) input[i] = static_cast<K>(i * 0x0102030405060708ULL + i);
+    ByteBuf buf;
+    codec::write_basic_type_as<BigEndian, uint32_t, K>(buf, input);
+    codec::write_basic_type<uint16_t, K>(buf, input);
+    EXPECT_EQ((codec::read_basic_type_as<BigEndian, uint32_t, K>(buf)), input) << "n=" << n;
+    EXPECT_EQ((codec::read_basic_type<uint16_t, K>(buf)), input) << "n=" << n;
+    EXPECT_EQ(buf.readable_bytes(), 0);
+  }
+}
+
+TEST(CodecTest, BasicTypeListRoundTrip) {
+  ExpectBasicTypeListRoundTrip<int8_t>();
+  ExpectBasicTypeListRoundTrip<uint16_t>();
+  ExpectBasicTypeListRoundTrip<int32_t>();
+  ExpectBasicTypeListRoundTrip<uint64_t>();
+  ExpectBasicTypeListRoundTrip<double>();
+}
+
+TEST(CodecTest, PackKey) {
+  static_assert(codec::pack_key("010") == 0x303130);
+  static_assert(codec::pack_key("417") != codec::pack_key("471"));
+  EXPECT_EQ(codec::pack_key(codec::FixedString<3>("417")), codec::pack_key("417"));
+  EXPECT_NE(codec::pack_key(codec::FixedString<3>("41")), codec::pack_key("417"));
+}
+
 TEST(JoinVectorTest, IntVector) {
   std::vector<int> nums = {1, 2, 3};
   EXPECT_EQ("[1, 2, 3]", codec::join_vector(nums));
@@ -0,0 +1,93 @@
+// Copyright 2025 xinchentechnote
+#include "include/frame_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "include/szse_binary.hpp"
+
+namespace {
+
+constexpr uint32_t kOrderCancelMsgType = 190007;
+
+std::vector<SzseBinaryFrame<OrderCancelRequest>> MakeCancels(size_t count) {
+  std::vector<SzseBinaryFrame<OrderCancelRequest>> cancels(count);
+  for (size_t i = 0; i < count; ++i) {
+    auto& frame = cancels[i];
+    frame.msgType = kOrderCancelMsgType;
+    frame.body.applId = "010";
+    frame.body.submittingPbuid = "010000";
+    frame.body.securityId = "000001";
+    frame.body.securityIdsource = "102";
+    frame.body.ownerType = 1;
+    frame.body.transactTime = 20250101093000000 + static_cast<int64_t>(i);
+    frame.body.clOrdId = "C" + std::to_string(i);
+    frame.body.origClOrdId = "O" + std::to_string(i);
+    frame.body.side = "1";
+    frame.body.orderQty = 100 * static_cast<int64_t>(i + 1);
+  }
+  return cancels;
+}
+
+}  // namespace
+
+TEST(FrameBatchTest, MatchesFrameByFrameEncode) {
+  auto cancels = MakeCancels(5);
+  codec::FrameBatch batch;
+  batch.encode(cancels);
+
+  ByteBuf expected;
+  std::vector<size_t> expectedOffsets;
+  for (const auto& frame : cancels) {
+    expectedOffsets.push_back(expected.size());
+    frame.encode(expected);
+  }
+  ASSERT_EQ(batch.size(), cancels.size());
+  EXPECT_EQ(batch.offsets(), expectedOffsets);
+  ASSERT_EQ(batch.bytes(), expected.size());
+  EXPECT_EQ(0, std::memcmp(batch.data(), expected.data(), expected.size()));
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    ByteBufView view = batch.frame(i);
+    SzseBinaryFrame<OrderCancelRequest> decoded;
+    decoded.decode(view);
+    EXPECT_EQ(view.readable_bytes(), 0u);
+    EXPECT_EQ(decoded.body.clOrdId, cancels[i].body.clOrdId);
+    EXPECT_EQ(decoded.checksum, accumulate<SzseBinAccumulator>(batch.frame(i).data(),
+                                                               batch.frame(i).size() - 4));
+  }
+  EXPECT_THROW(batch.frame(batch.size()), std::out_of_range);
+}
+
+TEST(FrameBatchTest, AcceptsPointersAndMixedFrames) {
+  std::vector<std::unique_ptr<SzseBinary>> frames;
+  for (int i = 0; i < 3; ++i) {
+    auto frame = std::make_unique<SzseBinary>();
+    frame->msgType = 3;
+    frame->body = std::make_unique<Heartbeat>();
+    frames.push_back(std::move(frame));
+  }
+  codec::FrameBatch batch;
+  batch.encode(frames);
+  batch.add(MakeCancels(1)[0]);
+
+  ASSERT_EQ(batch.size(), 4u);
+  EXPECT_EQ(batch.offsets()[1], 12u);
+  EXPECT_EQ(batch.frame(3).size(), batch.bytes() - batch.offsets()[3]);
+}
+
+TEST(FrameBatchTest, ClearKeepsCapacity) {
+  auto cancels = MakeCancels(100);
+  codec::FrameBatch batch(64);
+  batch.encode(cancels);
+  const size_t capacity = batch.buffer().capacity();
+  const size_t bytes = batch.bytes();
+
+  batch.clear();
+  EXPECT_TRUE(batch.empty());
+  batch.encode(cancels);
+  EXPECT_EQ(batch.bytes(), bytes);
+  EXPECT_EQ(batch.buffer().capacity(), capacity);
+}
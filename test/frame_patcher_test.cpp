@@ -0,0 +1,111 @@
+// Copyright 2025 xinchentechnote
+#include "include/frame_patcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include "include/sse_binary.hpp"
+
+namespace {
+
+SseBinaryFrame<NewOrderSingle> MakeOrder() {
+  SseBinaryFrame<NewOrderSingle> frame;
+  frame.msgType = 58;
+  frame.msgSeqNum = 1;
+  auto& order = frame.body;
+  order.bizId = 300060;
+  order.bizPbu = "13000";
+  order.clOrdId = "0000000001";
+  order.securityId = "600000";
+  order.account = "A123456789";
+  order.ownerType = 1;
+  order.side = "1";
+  order.price = 100000;
+  order.orderQty = 1000;
+  order.ordType = "2";
+  order.timeInForce = "0";
+  order.transactTime = 20250101093000000;
+  order.creditTag = "XY";
+  order.clearingFirm = "13000";
+  order.branchId = "0001";
+  order.userInfo = "user";
+  return frame;
+}
+
+}  // namespace
+
+TEST(FramePatcherTest, PatchedFrameMatchesReencodedFrame) {
+  auto frame = MakeOrder();
+  ByteBuf buf;
+  frame.encode(buf);
+
+  auto patch = SseBinaryWire::patch(buf);
+  SseBinaryWire::setMsgSeqNum(patch, 42);
+  NewOrderSingleWire::setClOrdId(patch, "0000000002");
+  NewOrderSingleWire::setPrice(patch, 123400);
+  NewOrderSingleWire::setTransactTime(patch, 20250101093000123);
+  NewOrderSingleWire::setUserInfo(patch, "retransmit");
+
+  frame.msgSeqNum = 42;
+  frame.body.clOrdId = "0000000002";
+  frame.body.price = 123400;
+  frame.body.transactTime = 20250101093000123;
+  frame.body.userInfo = "retransmit";
+  ByteBuf expected;
+  frame.encode(expected);
+
+  ASSERT_EQ(buf.size(), expected.size());
+  EXPECT_EQ(0, std::memcmp(buf.data(), expected.data(), buf.size()));
+}
+
+TEST(FramePatcherTest, RejectsLengthAndTrailer) {
+  auto frame = MakeOrder();
+  ByteBuf buf;
+  frame.encode(buf);
+
+  auto patch = SseBinaryWire::patch(buf);
+  uint32_t len = 0;
+  EXPECT_THROW(patch.put<LittleEndian>(SseBinaryFrameSpec.lengthOffset, len), std::out_of_range);
+  EXPECT_THROW(patch.put<LittleEndian>(patch.size() - 4, len), std::out_of_range);
+  EXPECT_THROW(SseBinaryWire::patch(buf.mutable_data(), buf.size() - 1), std::out_of_range);
+}
+
+TEST(FramePatcherTest, ByteSumPatchWrapsModulo256) {
+  std::vector<uint8_t> bytes(64);
+  for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = static_cast<uint8_t>(i * 37);
+  uint32_t checksum = accumulate<SseBinAccumulator>(bytes.data(), bytes.size());
+
+  uint64_t before = simd::byte_sum(bytes.data() + 10, 8);
+  for (size_t i = 10; i < 18; ++i) bytes[i] = 0xFF;
+  uint64_t after = simd::byte_sum(bytes.data() + 10, 8);
+
+  uint32_t patched = byte_sum_checksum_patch(checksum, before, after);
+  EXPECT_EQ(patched, accumulate<SseBinAccumulator>(bytes.data(), bytes.size()));
+  EXPECT_EQ(byte_sum_checksum_patch(patched, after, before), checksum);
+}
+
+TEST(FrameTemplateTest, StampedOrdersMatchFullEncode) {
+  auto prototype = MakeOrder();
+  codec::FrameTemplate tmpl = SseBinaryWire::makeTemplate(prototype);
+
+  ByteBuf sendBuf;
+  for (uint64_t seq = 2; seq < 5; ++seq) {
+    sendBuf.reset();
+    codec::FramePatcher order = tmpl.stamp(sendBuf);
+    SseBinaryWire::setMsgSeqNum(order, seq);
+    NewOrderSingleWire::setClOrdId(order, "ORD" + std::to_string(seq));
+    NewOrderSingleWire::setPrice(order, 100000 + static_cast<int64_t>(seq));
+    NewOrderSingleWire::setOrderQty(order, 100 * static_cast<int64_t>(seq));
+
+    auto expected = MakeOrder();
+    expected.msgSeqNum = seq;
+    expected.body.clOrdId = "ORD" + std::to_string(seq);
+    expected.body.price = 100000 + static_cast<int64_t>(seq);
+    expected.body.orderQty = 100 * static_cast<int64_t>(seq);
+    ByteBuf encoded;
+    expected.encode(encoded);
+
+    ASSERT_EQ(sendBuf.size(), encoded.size());
+    EXPECT_EQ(0, std::memcmp(sendBuf.data(), encoded.data(), encoded.size()));
+  }
+  EXPECT_EQ(tmpl.size(), sendBuf.size());
+}
@@ -48,6 +48,37 @@ TEST(NewOrderTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+TEST(NewOrderTest, MaskedDecode) {
+    NewOrder original;
+    original.uniqueOrderId = "uid-1";
+    original.clOrdId = "cl-1";
+    original.securityId = "600000";
+    original.side = "1";
+    original.price = 1234;
+    original.orderQty = 100;
+    original.ordType = "2";
+    original.account = "acct-1";
+    
+    ByteBuf buf;
+    original.encode(buf);
+    NewOrder decoded;
+    decoded.securityId = "unchanged";
+    decoded.orderQty = 7;
+    decoded.decode(buf, {NewOrder::Field::clOrdId, NewOrder::Field::price, NewOrder::Field::account});
+
+    EXPECT_EQ(decoded.clOrdId, original.clOrdId);
+    EXPECT_EQ(decoded.price, original.price);
+    EXPECT_EQ(decoded.account, original.account);
+    EXPECT_EQ(decoded.securityId, "unchanged");
+    EXPECT_EQ(decoded.orderQty, 7u);
+    EXPECT_EQ(buf.readable_bytes(), 0u);
+
+    ByteBufView truncated(buf.data(), buf.size() - 1);
+    EXPECT_THROW(decoded.decode(truncated, {NewOrder::Field::price}), std::out_of_range);
+    ByteBufView shortString(buf.data(), 6);
+    EXPECT_THROW(decoded.decode(shortString, {NewOrder::Field::price}), std::out_of_range);
+}
+
 TEST(OrderConfirmTest, EncodeAndDeocde) {
     OrderConfirm original;
     original.uniqueOrderId = "hello";
@@ -82,6 +113,36 @@ TEST(ExecutionReportTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+TEST(ExecutionReportTest, MaskedDecode) {
+    ExecutionReport original;
+    original.uniqueOrderId = "uid-1";
+    original.clOrdId = "cl-1";
+    original.ordCnfmId = "cnfm-1";
+    original.lastPx = 1234;
+    original.lastQty = 100;
+    original.ordStatus = "2";
+    
+    ByteBuf buf;
+    original.encode(buf);
+    ExecutionReport decoded;
+    decoded.uniqueOrderId = "unchanged";
+    decoded.lastPx = 7;
+    decoded.decode(buf, {ExecutionReport::Field::ordCnfmId, ExecutionReport::Field::lastQty,
+                         ExecutionReport::Field::ordStatus});
+
+    EXPECT_EQ(decoded.ordCnfmId, original.ordCnfmId);
+    EXPECT_EQ(decoded.lastQty, original.lastQty);
+    EXPECT_EQ(decoded.ordStatus, original.ordStatus);
+    EXPECT_EQ(decoded.uniqueOrderId, "unchanged");
+    EXPECT_EQ(decoded.lastPx, 7u);
+    EXPECT_EQ(buf.readable_bytes(), 0u);
+
+    ByteBufView truncated(buf.data(), buf.size() - 1);
+    EXPECT_THROW(decoded.decode(truncated, {ExecutionReport::Field::lastQty}), std::out_of_range);
+    ByteBufView shortString(buf.data(), 6);
+    EXPECT_THROW(decoded.decode(shortString, {ExecutionReport::Field::lastQty}), std::out_of_range);
+}
+
 TEST(OrderCancelTest, EncodeAndDeocde) {
     OrderCancel original;
     original.uniqueOrderId = "hello";
@@ -0,0 +1,67 @@
+// Copyright 2025 xinchentechnote
+#include "include/ring_bytebuf.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "include/szse_binary.hpp"
+
+TEST(RingByteBufTest, CapacityIsWholePages) {
+  RingByteBuf ring(100);
+  EXPECT_EQ(ring.capacity() % static_cast<size_t>(sysconf(_SC_PAGESIZE)), 0u);
+  EXPECT_GE(ring.capacity(), 100u);
+  EXPECT_EQ(ring.writable_bytes(), ring.capacity());
+  EXPECT_EQ(ring.readable_bytes(), 0u);
+}
+
+TEST(RingByteBufTest, DecodesFramesAcrossTheWrapPoint) {
+  RingByteBuf ring(4096);
+  ByteBuf frame;
+  SzseBinary original;
+  original.msgType = 1;
+  auto body = std::make_unique<Logon>();
+  body->senderCompId = "ring";
+  original.body = std::move(body);
+  original.encode(frame);
+
+  // Push far more data than the ring holds; every frame must still decode in one piece.
+  const size_t rounds = 20 * ring.capacity() / frame.size();
+  for (size_t i = 0; i < rounds; ++i) {
+    ASSERT_GE(ring.writable_bytes(), frame.size());
+    std::memcpy(ring.write_ptr(), frame.data(), frame.size());
+    ring.commit(frame.size());
+
+    SzseBinary decoded;
+    decoded.decode(ring);
+    ASSERT_EQ(decoded.body.get_if<Logon>()->senderCompId, "ring") << i;
+    ring.discard_read_bytes();
+    EXPECT_EQ(ring.readable_bytes(), 0u);
+  }
+}
+
+TEST(RingByteBufTest, DiscardKeepsUnreadBytes) {
+  RingByteBuf ring(4096);
+  std::vector<uint8_t> chunk(3000);
+  for (size_t i = 0; i < chunk.size(); ++i) chunk[i] = static_cast<uint8_t>(i);
+  ring.write_bytes(chunk.data(), chunk.size());
+  ring.skip_bytes(2000);
+  ring.discard_read_bytes();
+  EXPECT_EQ(ring.readable_bytes(), 1000u);
+  EXPECT_EQ(ring.writable_bytes(), ring.capacity() - 1000);
+
+  // This write runs past the end of the storage and must come back contiguous.
+  ring.write_bytes(chunk.data(), chunk.size());
+  EXPECT_EQ(std::memcmp(ring.read_span(1000), chunk.data() + 2000, 1000), 0);
+  EXPECT_EQ(std::memcmp(ring.read_span(3000), chunk.data(), 3000), 0);
+}
+
+TEST(RingByteBufTest, RejectsWritesBeyondCapacity) {
+  RingByteBuf ring(4096);
+  std::vector<uint8_t> big(ring.capacity() + 1);
+  EXPECT_THROW(ring.write_bytes(big.data(), big.size()), std::out_of_range);
+  ring.write_bytes(big.data(), ring.capacity());
+  EXPECT_EQ(ring.writable_bytes(), 0u);
+  EXPECT_THROW(ring.commit(1), std::out_of_range);
+}
@@ -0,0 +1,158 @@
+// Copyright 2025 xinchentechnote
+// Built with CODEC_DECODE_ARENA, so the generated list fields are arena-aware.
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include "include/root_packet.hpp"
+
+// Counts global allocations, so tests can check that a decode stays off the heap.
+static std::atomic<size_t> gAllocations{0};
+
+void* operator new(std::size_t size) {
+  ++gAllocations;
+  if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc();
+}
+void* operator new(std::size_t size, std::align_val_t align) {
+  ++gAllocations;
+  const auto alignment = static_cast<std::size_t>(align);
+  if (void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+// Forwards to `upstream` and counts what it hands out.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  explicit CountingResource(
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+      : upstream_(upstream) {}
+
+  size_t allocations = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t align) override {
+    ++allocations;
+    return upstream_->allocate(bytes, align);
+  }
+  void do_deallocate(void* p, size_t bytes, size_t align) override {
+    upstream_->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  std::pmr::memory_resource* upstream_;
+};
+}  // namespace
+
+TEST(RootPacketArenaTest, ListFieldsAreArenaVectors) {
+  static_assert(std::is_same_v<decltype(BasicPacket::fieldI32List), codec::ArenaVector<int32_t>>);
+  static_assert(std::is_same_v<decltype(StringPacket::fieldDynamicStringList),
+                               codec::ArenaVector<codec::ArenaString>>);
+}
+
+TEST(RootPacketArenaTest, ListsDecodeIntoArena) {
+  auto packet = std::make_unique<BasicPacket>();
+  packet->fieldI32List = {1, 2, 3};
+  packet->fieldF64List = {3.3, 4.4};
+  packet->fieldCharList = {"a", "b"};
+  RootPacket original;
+  original.msgType = 1;
+  original.payload = std::move(packet);
+  ByteBuf buf;
+  original.encode(buf);
+
+  codec::DecodeArena arena(4096);
+  RootPacket decoded;
+  {
+    codec::ArenaScope scope(arena);
+    ByteBufView view(buf.data(), buf.size());
+    decoded.decode(view);
+  }
+  const auto* body = decoded.payload.get_if<BasicPacket>();
+  ASSERT_NE(body, nullptr);
+  EXPECT_EQ(body->fieldI32List.get_allocator().resource(), arena.resource());
+  EXPECT_EQ(body->fieldF64List.get_allocator().resource(), arena.resource());
+  EXPECT_TRUE(original.payload->equals(*decoded.payload));
+
+  // A copy made outside the scope no longer points into the arena.
+  BasicPacket kept = *body;
+  EXPECT_EQ(kept.fieldI32List.get_allocator().resource(), std::pmr::new_delete_resource());
+  EXPECT_EQ(kept.fieldI32List, body->fieldI32List);
+
+  decoded.payload.reset();
+  arena.release();
+  EXPECT_EQ(kept.fieldCharList[1], "b");
+}
+
+TEST(RootPacketArenaTest, ArenaScopeRoutesEveryListAllocation) {
+  auto packet = std::make_unique<BasicPacket>();
+  packet->fieldU8List = {1, 2};
+  packet->fieldU16List = {3};
+  packet->fieldI64List = {4, 5};
+  RootPacket original;
+  original.msgType = 1;
+  original.payload = std::move(packet);
+  ByteBuf buf;
+  original.encode(buf);
+
+  CountingResource counting;
+  {
+    codec::ArenaScope scope(&counting);
+    ByteBufView view(buf.data(), buf.size());
+    RootPacket decoded;
+    decoded.decode(view);
+  }
+  EXPECT_EQ(counting.allocations, 3u);
+  EXPECT_EQ(codec::current_resource(), std::pmr::new_delete_resource());
+}
+
+TEST(RootPacketArenaTest, StringListsStayOffTheGlobalHeap) {
+  const std::string longA = "a string too long for the small-string buffer";
+  const std::string longB = "another string that has to allocate its storage";
+  auto packet = std::make_unique<StringPacket>();
+  packet->fieldDynamicStringList = {longA.c_str(), longB.c_str()};
+  packet->fieldFixedString10List = {"abc"};
+  RootPacket original;
+  original.msgType = 2;
+  original.payload = std::move(packet);
+  ByteBuf buf;
+  original.encode(buf);
+
+  // The counting resource itself draws from a stack block, so any global allocation during the
+  // decode would have to come from somewhere other than the arena.
+  alignas(std::max_align_t) std::byte block[4096];
+  std::pmr::monotonic_buffer_resource pool(block, sizeof(block), std::pmr::null_memory_resource());
+  CountingResource counting(&pool);
+  RootPacket decoded;
+  const size_t before = gAllocations.load();
+  {
+    codec::ArenaScope scope(&counting);
+    ByteBufView view(buf.data(), buf.size());
+    decoded.decode(view);
+  }
+  EXPECT_EQ(gAllocations.load(), before);
+  // Two list buffers plus the two strings that do not fit inline.
+  EXPECT_EQ(counting.allocations, 4u);
+
+  const auto* body = decoded.payload.get_if<StringPacket>();
+  ASSERT_NE(body, nullptr);
+  ASSERT_EQ(body->fieldDynamicStringList.size(), 2u);
+  EXPECT_EQ(body->fieldDynamicStringList[0], longA.c_str());
+  EXPECT_EQ(body->fieldDynamicStringList[1].get_allocator().resource(), &counting);
+  ASSERT_EQ(body->fieldFixedString10List.size(), 1u);
+  EXPECT_EQ(body->fieldFixedString10List[0], "abc");
+}
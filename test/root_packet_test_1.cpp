@@ -38,3 +38,361 @@ TEST(BasicPacketTest, ToStringOutput) {
   EXPECT_NE(str.find("fieldI8List: [1, 2, 3]"), std::string::npos);
   EXPECT_NE(str.find("fieldCharList: [\"a\", \"b\", \"c\"]"), std::string::npos);
 }
+
+TEST(RootPacketTest, DecodeFromByteBufView) {
+  auto payload = std::make_unique<SubPacket>();
+  payload->fieldU32 = 42;
+  payload->fieldI16List = {1, -2, 3};
+  auto nested = std::make_unique<NestedPacket>();
+  nested->subPacket = *payload;
+  nested->subPacketList = {*payload, *payload};
+  nested->inerPacket.fieldU32 = 7;
+
+  RootPacket original;
+  original.msgType = 3;
+  original.payload = std::move(nested);
+
+  ByteBuf buf;
+  original.encode(buf);
+  // Simulate a frame sitting in a recv buffer that we do not own.
+  std::vector<uint8_t> recv(buf.data(), buf.data() + buf.size());
+
+  ByteBufView view(recv.data(), recv.size());
+  RootPacket decoded;
+  decoded.decode(view);
+  EXPECT_EQ(view.readable_bytes(), 0);
+  EXPECT_EQ(decoded.msgType, 3);
+  EXPECT_TRUE(original.payload->equals(*decoded.payload));
+}
+
+TEST(RootPacketTest, EncodedSizeMatchesBytesWritten) {
+  auto strings = std::make_unique<StringPacket>();
+  strings->fieldDynamicString = "dynamic";
+  strings->fieldDynamicStringList = {"a", "bc", ""};
+  strings->fieldFixedString10List = {"x", "y"};
+  EXPECT_EQ(strings->encodedSize(), 21 + (2 + 7) + 2 + (2 + 3 * 2 + 3) + 2 + 2 + (2 + 2 * 10) + 2);
+
+  RootPacket original;
+  original.msgType = 2;
+  original.payload = std::move(strings);
+
+  ByteBuf buf;
+  original.encode(buf);
+  EXPECT_EQ(original.encodedSize(), buf.size());
+
+  RootPacket decoded;
+  decoded.decode(buf);
+  EXPECT_EQ(decoded.payloadLen, original.payload->encodedSize());
+  EXPECT_EQ(EmptyPacket::kWireSize, 0);
+}
+
+TEST(RootPacketTest, StaticFrameMatchesVirtualFrame) {
+  SubPacket sub;
+  sub.fieldU32 = 9;
+  sub.fieldI16List = {4, 5};
+
+  RootPacketFrame<NestedPacket> typed;
+  typed.msgType = 3;
+  typed.payload.subPacket = sub;
+  typed.payload.subPacketList = {sub, sub, sub};
+  typed.payload.inerPacket.fieldU32 = 1;
+
+  RootPacket dynamic;
+  dynamic.msgType = 3;
+  dynamic.payload = std::make_unique<NestedPacket>(typed.payload);
+
+  ByteBuf typedBuf;
+  typed.encode(typedBuf);
+  ByteBuf dynamicBuf;
+  dynamic.encode(dynamicBuf);
+  ASSERT_EQ(typedBuf.size(), dynamicBuf.size());
+  EXPECT_EQ(std::memcmp(typedBuf.data(), dynamicBuf.data(), typedBuf.size()), 0);
+
+  RootPacketFrame<NestedPacket> decoded;
+  decoded.decode(typedBuf);
+  EXPECT_TRUE(decoded.payload.equals(typed.payload));
+  EXPECT_EQ(decoded.payload.subPacketList.size(), 3);
+  EXPECT_FALSE(decoded.equals(dynamic));
+}
+
+TEST(RootPacketTest, PayloadDecodesInline) {
+  RootPacket original;
+  original.msgType = 3;
+  auto nested = std::make_unique<NestedPacket>();
+  nested->inerPacket.fieldU32 = 11;
+  original.payload = std::move(nested);
+  ByteBuf buf;
+  original.encode(buf);
+
+  RootPacket decoded;
+  decoded.decode(buf);
+  ASSERT_TRUE(decoded.payload);
+  const NestedPacket* payload = decoded.payload.get_if<NestedPacket>();
+  ASSERT_NE(payload, nullptr);
+  EXPECT_EQ(payload->inerPacket.fieldU32, 11);
+  EXPECT_EQ(decoded.payload.get(), payload);
+
+  size_t visitedSize = decoded.payload.visit([](const auto& msg) -> size_t {
+    if constexpr (std::is_same_v<std::decay_t<decltype(msg)>, std::monostate>) {
+      return 0;
+    } else {
+      return msg.encodedSize();
+    }
+  });
+  EXPECT_EQ(visitedSize, original.payload->encodedSize());
+
+  RootPacket copy = decoded;
+  EXPECT_TRUE(copy.equals(decoded));
+  EXPECT_NE(copy.payload.get(), decoded.payload.get());
+}
+
+TEST(RootPacketTest, TryDecodeUnknownType) {
+  RootPacket original;
+  original.msgType = 4;
+  original.payload = std::make_unique<EmptyPacket>();
+  ByteBuf buf;
+  original.encode(buf);
+
+  RootPacket decoded;
+  ByteBufView known(buf.data(), buf.size());
+  EXPECT_TRUE(decoded.tryDecode(known));
+  EXPECT_NE(decoded.payload.get_if<EmptyPacket>(), nullptr);
+
+  buf.mutable_data()[0] = 99;
+  ByteBufView unknown(buf.data(), buf.size());
+  EXPECT_FALSE(decoded.tryDecode(unknown));
+  ByteBufView rethrown(buf.data(), buf.size());
+  EXPECT_THROW(decoded.decode(rethrown), std::runtime_error);
+  EXPECT_EQ(RootPacketMessageFactory::getInstance().tryCreate(99), nullptr);
+}
+
+TEST(RootPacketTest, FactoryResolvesGeneratedTypes) {
+  auto& factory = RootPacketMessageFactory::getInstance();
+  EXPECT_NE(dynamic_cast<NestedPacket*>(factory.create(3).get()), nullptr);
+  EXPECT_EQ(factory.tryCreate(99), nullptr);
+  EXPECT_THROW(factory.create(99), std::runtime_error);
+
+  factory.registerMessage<StringPacket>(99);
+  factory.registerMessage<BasicPacket>(3);
+  EXPECT_NE(dynamic_cast<StringPacket*>(factory.tryCreate(99).get()), nullptr);
+  EXPECT_NE(dynamic_cast<BasicPacket*>(factory.create(3).get()), nullptr);
+  factory.removeMessage(3);
+  factory.removeMessage(99);
+  EXPECT_NE(dynamic_cast<NestedPacket*>(factory.create(3).get()), nullptr);
+  EXPECT_EQ(factory.tryCreate(99), nullptr);
+}
+
+TEST(RootPacketTest, ChecksumCoversOnlyItsOwnFrame) {
+  RootPacket first;
+  first.msgType = 4;
+  first.payload = std::make_unique<EmptyPacket>();
+  RootPacket second;
+  second.msgType = 2;
+  auto strings = std::make_unique<StringPacket>();
+  strings->fieldDynamicString = "batched";
+  second.payload = std::move(strings);
+
+  ByteBuf batch;
+  first.encode(batch);
+  const size_t secondStart = batch.size();
+  second.encode(batch);
+
+  ByteBuf alone;
+  second.encode(alone);
+  ASSERT_EQ(alone.size(), batch.size() - secondStart);
+  EXPECT_EQ(std::memcmp(alone.data(), batch.data() + secondStart, alone.size()), 0);
+
+  RootPacket decoded;
+  decoded.decode(batch);
+  decoded.decode(batch);
+  EXPECT_EQ(decoded.checksum, accumulate<Crc32Accumulator>(alone.data(), alone.size() - 4));
+}
+
+TEST(RootPacketTest, DecodeVerifiesChecksumByPolicy) {
+  RootPacket original;
+  original.msgType = 2;
+  auto strings = std::make_unique<StringPacket>();
+  strings->fieldDynamicString = "verify";
+  original.payload = std::move(strings);
+  ByteBuf good;
+  original.encode(good);
+  std::vector<uint8_t> bad(good.data(), good.data() + good.size());
+  bad[8] ^= 0x01;
+
+  auto& verifier = RootPacketChecksumVerifier;
+  verifier.resetCounters();
+  auto decodeOnce = [](const uint8_t* data, size_t len) {
+    ByteBufView view(data, len);
+    RootPacket decoded;
+    decoded.decode(view);
+  };
+
+  decodeOnce(good.data(), good.size());
+  EXPECT_EQ(verifier.checked(), 0u);
+
+  verifier.setMode(ChecksumVerifyMode::kAlways);
+  decodeOnce(good.data(), good.size());
+  EXPECT_NO_THROW(decodeOnce(bad.data(), bad.size()));
+  EXPECT_EQ(verifier.checked(), 2u);
+  EXPECT_EQ(verifier.mismatches(), 1u);
+
+  verifier.resetCounters();
+  verifier.setMode(ChecksumVerifyMode::kSampled, 3);
+  for (int i = 0; i < 6; ++i) decodeOnce(good.data(), good.size());
+  EXPECT_EQ(verifier.checked(), 2u);
+  EXPECT_EQ(verifier.mismatches(), 0u);
+
+  verifier.setMode(ChecksumVerifyMode::kOff);
+  verifier.resetCounters();
+}
+
+TEST(RootPacketTest, VerifiesLongFramesInsideABatch) {
+  RootPacket first;
+  first.msgType = 4;
+  first.payload = std::make_unique<EmptyPacket>();
+  RootPacket second;
+  second.msgType = 2;
+  auto strings = std::make_unique<StringPacket>();
+  strings->fieldDynamicString = std::string(300, 'x');
+  strings->fieldDynamicStringList = {std::string(90, 'y'), "z"};
+  second.payload = std::move(strings);
+
+  ByteBuf batch;
+  first.encode(batch);
+  const size_t secondStart = batch.size();
+  second.encode(batch);
+  second.encode(batch);
+  batch.mutable_data()[batch.size() - 40] ^= 0x01;
+
+  auto& verifier = RootPacketChecksumVerifier;
+  verifier.resetCounters();
+  verifier.setMode(ChecksumVerifyMode::kAlways);
+  RootPacket decoded;
+  for (int i = 0; i < 3; ++i) decoded.decode(batch);
+  EXPECT_EQ(verifier.checked(), 3u);
+  EXPECT_EQ(verifier.mismatches(), 1u);
+  EXPECT_GT(batch.size() - secondStart, 2 * ByteTap::kChunk);
+
+  verifier.setMode(ChecksumVerifyMode::kOff);
+  verifier.resetCounters();
+}
+
+TEST(RootPacketTest, EncodesIntoInlineBuffer) {
+  RootPacket original;
+  original.msgType = 4;
+  original.payload = std::make_unique<EmptyPacket>();
+  SmallByteBuf<64> buf;
+  original.encode(buf);
+  EXPECT_TRUE(buf.is_inline());
+  EXPECT_EQ(buf.size(), original.encodedSize());
+
+  RootPacket decoded;
+  decoded.decode(buf);
+  EXPECT_TRUE(original.payload->equals(*decoded.payload));
+}
+
+TEST(RootPacketTest, ListFieldsAreStdVectors) {
+  static_assert(std::is_same_v<decltype(BasicPacket::fieldI32List), std::vector<int32_t>>);
+  static_assert(std::is_same_v<decltype(StringPacket::fieldDynamicStringList),
+                               std::vector<std::string>>);
+  BasicPacket packet;
+  packet.fieldCharList = {"a", "b"};
+  std::vector<std::string> chars = packet.fieldCharList;
+  EXPECT_EQ(chars.size(), 2u);
+}
+
+TEST(RootPacketTest, ViewReadsFieldsInPlace) {
+  auto basic = std::make_unique<BasicPacket>();
+  basic->fieldI8 = -1;
+  basic->fieldI16 = -12345;
+  basic->fieldI64 = -1234567890123LL;
+  basic->fieldChar = "7";
+  basic->fieldU32 = 4294967295U;
+  basic->fieldF64 = 2.718281828459;
+  basic->fieldU16List = {60000};
+
+  RootPacket original;
+  original.msgType = 1;
+  original.payload = std::move(basic);
+  ByteBuf buf;
+  original.encode(buf);
+
+  RootPacketView frame(buf);
+  EXPECT_EQ(frame.msgType(), 1);
+  EXPECT_EQ(frame.frameSize(), buf.readable_bytes());
+  EXPECT_EQ(frame.payloadLen(), frame.payload().readable_bytes());
+
+  RootPacket decoded;
+  decoded.decode(buf);
+  EXPECT_EQ(frame.checksum(), decoded.checksum);
+
+  BasicPacketView view(frame.payload());
+  EXPECT_EQ(view.fieldI8(), -1);
+  EXPECT_EQ(view.fieldI16(), -12345);
+  EXPECT_EQ(view.fieldI64(), -1234567890123LL);
+  EXPECT_EQ(view.fieldChar(), "7");
+  EXPECT_EQ(view.fieldU32(), 4294967295U);
+  EXPECT_DOUBLE_EQ(view.fieldF64(), 2.718281828459);
+
+  ByteBufView truncated(buf.data(), buf.size() - 1);
+  EXPECT_THROW(RootPacketView{truncated}, std::out_of_range);
+  ByteBufView shortBody(buf.data() + RootPacketView::kHeaderSize, BasicPacketView::kFixedSize - 1);
+  EXPECT_THROW(BasicPacketView{shortBody}, std::out_of_range);
+}
+
+TEST(RootPacketTest, MaskedDecodeSkipsUnselectedFields) {
+  BasicPacket original;
+  original.fieldI8 = -1;
+  original.fieldI32 = -12345678;
+  original.fieldChar = "7";
+  original.fieldU64 = 18446744073709551615ULL;
+  original.fieldF64 = 2.718281828459;
+  original.fieldI16List = {100, 200};
+  original.fieldCharList = {"a", "b", "c"};
+  original.fieldU32List = {123456};
+  ByteBuf buf;
+  original.encode(buf);
+
+  BasicPacket decoded;
+  decoded.fieldI8 = 0;
+  decoded.fieldU64 = 0;
+  decoded.decode(buf, codec::FieldMask<BasicPacket::Field>{BasicPacket::Field::fieldI32,
+                                                           BasicPacket::Field::fieldF64,
+                                                           BasicPacket::Field::fieldU32List});
+  EXPECT_EQ(buf.readable_bytes(), 0);
+  EXPECT_EQ(decoded.fieldI32, -12345678);
+  EXPECT_DOUBLE_EQ(decoded.fieldF64, 2.718281828459);
+  EXPECT_EQ(decoded.fieldU32List, original.fieldU32List);
+  EXPECT_EQ(decoded.fieldI8, 0);
+  EXPECT_EQ(decoded.fieldU64, 0);
+  EXPECT_TRUE(decoded.fieldI16List.empty());
+  EXPECT_TRUE(decoded.fieldCharList.empty());
+
+  ByteBufView again(buf.data(), buf.size());
+  BasicPacket full;
+  full.decode(again, codec::FieldMask<BasicPacket::Field>::all());
+  EXPECT_TRUE(original == full);
+}
+
+TEST(RootPacketTest, MaskedDecodeStillChecksSkippedLengths) {
+  SubPacket sub;
+  sub.fieldU32 = 42;
+  sub.fieldI16List = {1, -2, 3};
+  NestedPacket original;
+  original.subPacket = sub;
+  original.subPacketList = {sub, sub};
+  original.inerPacket.fieldU32 = 7;
+  ByteBuf buf;
+  original.encode(buf);
+
+  NestedPacket decoded;
+  decoded.decode(buf, codec::FieldMask<NestedPacket::Field>{NestedPacket::Field::inerPacket});
+  EXPECT_EQ(buf.readable_bytes(), 0);
+  EXPECT_EQ(decoded.inerPacket.fieldU32, 7);
+  EXPECT_TRUE(decoded.subPacketList.empty());
+
+  // Cut the frame inside the skipped list: the skip must notice, not read past the end.
+  ByteBufView truncated(buf.data(), buf.size() - 6);
+  EXPECT_THROW(decoded.decode(truncated, codec::FieldMask<NestedPacket::Field>()),
+               std::out_of_range);
+}
@@ -0,0 +1,108 @@
+// Copyright 2025 xinchentechnote
+#include "include/simd.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(SimdTest, FillMatchesMemset) {
+  for (size_t len = 0; len <= 80; ++len) {
+    std::vector<uint8_t> expected(len + 2, 0xAA);
+    std::vector<uint8_t> actual(len + 2, 0xAA);
+    std::memset(expected.data() + 1, '0', len);
+    simd::fill(actual.data() + 1, '0', len);
+    EXPECT_EQ(actual, expected) << "len=" << len;
+  }
+}
+
+TEST(SimdTest, TrimScansMatchStringView) {
+  for (size_t len = 0; len <= 80; ++len) {
+    for (size_t pad = 0; pad <= len; ++pad) {
+      // Left padded with '0', interior zeros must not be trimmed.
+      std::string left(pad, '0');
+      left += std::string(len - pad, '7');
+      if (len - pad > 2) left[pad + 1] = '0';
+      std::string_view lv(left);
+      size_t first = lv.find_first_not_of('0');
+      EXPECT_EQ(simd::find_first_not_of(lv.data(), lv.size(), '0'),
+                first == std::string_view::npos ? len : first)
+          << "len=" << len << " pad=" << pad;
+
+      // Right padded with ' ', interior spaces must not be trimmed.
+      std::string right(len - pad, 'x');
+      if (len - pad > 2) right[len - pad - 2] = ' ';
+      right += std::string(pad, ' ');
+      std::string_view rv(right);
+      size_t last = rv.find_last_not_of(' ');
+      EXPECT_EQ(simd::find_last_not_of(rv.data(), rv.size(), ' '),
+                last == std::string_view::npos ? 0 : last + 1)
+          << "len=" << len << " pad=" << pad;
+    }
+  }
+}
+
+TEST(SimdTest, ByteSumMatchesScalar) {
+  std::vector<uint8_t> data(4096 + 77);
+  uint32_t state = 12345;
+  for (auto& b : data) {
+    state = state * 1103515245 + 12345;
+    b = static_cast<uint8_t>(state >> 16);
+  }
+  for (size_t len : {0, 1, 15, 16, 31, 32, 63, 64, 65, 127, 1000, 4096 + 77}) {
+    for (size_t offset : {0, 1, 7}) {
+      if (offset + len > data.size()) continue;
+      const uint8_t* p = data.data() + offset;
+      uint64_t expected = simd::detail::byte_sum_scalar(p, len);
+      EXPECT_EQ(simd::byte_sum(p, len), expected) << "len=" << len;
+#if defined(__SSE2__)
+      EXPECT_EQ(simd::detail::byte_sum_sse2(p, len), expected) << "len=" << len;
+#endif
+#if defined(SIMD_HAVE_RUNTIME_AVX2)
+      if (__builtin_cpu_supports("avx2")) {
+        EXPECT_EQ(simd::detail::byte_sum_avx2(p, len), expected) << "len=" << len;
+      }
+#endif
+    }
+  }
+}
+
+template <size_t Width>
+void ExpectByteswapMatchesScalar(const std::vector<uint8_t>& data) {
+  for (size_t count : {0, 1, 3, 7, 8, 9, 15, 16, 17, 33, 100}) {
+    if (count * Width + 1 > data.size()) continue;
+    const uint8_t* src = data.data() + 1;
+    std::vector<uint8_t> expected(count * Width);
+    for (size_t i = 0; i < count; ++i) {
+      simd::detail::bswap_one<Width>(expected.data() + i * Width, src + i * Width);
+    }
+    std::vector<uint8_t> actual(count * Width);
+    simd::byteswap_copy<Width>(actual.data(), src, count);
+    EXPECT_EQ(actual, expected) << "width=" << Width << " count=" << count;
+#if defined(SIMD_HAVE_RUNTIME_PSHUFB)
+    const size_t bytes = count * Width;
+    if (__builtin_cpu_supports("ssse3")) {
+      std::vector<uint8_t> out(bytes);
+      size_t done = simd::detail::byteswap_ssse3<Width>(out.data(), src, bytes);
+      EXPECT_EQ(done, bytes / 16 * 16);
+      EXPECT_TRUE(std::equal(out.begin(), out.begin() + done, expected.begin()));
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      std::vector<uint8_t> out(bytes);
+      size_t done = simd::detail::byteswap_avx2<Width>(out.data(), src, bytes);
+      EXPECT_EQ(done, bytes / 16 * 16);
+      EXPECT_TRUE(std::equal(out.begin(), out.begin() + done, expected.begin()));
+    }
+#endif
+  }
+}
+
+TEST(SimdTest, ByteswapCopyMatchesScalar) {
+  std::vector<uint8_t> data(1024);
+  for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>(i * 37 + 11);
+  ExpectByteswapMatchesScalar<2>(data);
+  ExpectByteswapMatchesScalar<4>(data);
+  ExpectByteswapMatchesScalar<8>(data);
+}
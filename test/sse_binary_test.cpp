@@ -213,6 +213,70 @@ TEST(ReportTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+TEST(ReportTest, View) {
+    Report original;
+    original.pbu = "12345";
+    original.setId = 41;
+    original.reportIndex = 81234567890;
+    original.bizId = 42;
+    original.execType = "F";
+    original.bizPbu = "54321";
+    original.clOrdId = "CL0001";
+    original.securityId = "600000";
+    original.account = "A123456789";
+    original.ownerType = 3;
+    original.orderEntryTime = 20250102093000;
+    original.lastPx = -125;
+    original.lastQty = 300;
+    original.grossTradeAmt = 37500;
+    original.side = "1";
+    original.orderQty = 1000;
+    original.leavesQty = 700;
+    original.ordStatus = "1";
+    original.creditTag = "XY";
+    original.clearingFirm = "CF01";
+    original.branchId = "BR02";
+    original.trdCnfmId = "T0000001";
+    original.ordCnfmId = "O0000001";
+    original.tradeDate = 20250102;
+    original.transactTime = 20250102093001;
+    original.userInfo = "user info";
+    
+    ByteBuf buf;
+    original.encode(buf);
+    ReportView view(buf);
+    Report decoded;
+    decoded.decode(buf);
+
+    EXPECT_EQ(view.pbu(), decoded.pbu);
+    EXPECT_EQ(view.setId(), decoded.setId);
+    EXPECT_EQ(view.reportIndex(), decoded.reportIndex);
+    EXPECT_EQ(view.bizId(), decoded.bizId);
+    EXPECT_EQ(view.execType(), decoded.execType);
+    EXPECT_EQ(view.bizPbu(), decoded.bizPbu);
+    EXPECT_EQ(view.clOrdId(), decoded.clOrdId);
+    EXPECT_EQ(view.securityId(), decoded.securityId);
+    EXPECT_EQ(view.account(), decoded.account);
+    EXPECT_EQ(view.ownerType(), decoded.ownerType);
+    EXPECT_EQ(view.orderEntryTime(), decoded.orderEntryTime);
+    EXPECT_EQ(view.lastPx(), decoded.lastPx);
+    EXPECT_EQ(view.lastQty(), decoded.lastQty);
+    EXPECT_EQ(view.grossTradeAmt(), decoded.grossTradeAmt);
+    EXPECT_EQ(view.side(), decoded.side);
+    EXPECT_EQ(view.orderQty(), decoded.orderQty);
+    EXPECT_EQ(view.leavesQty(), decoded.leavesQty);
+    EXPECT_EQ(view.ordStatus(), decoded.ordStatus);
+    EXPECT_EQ(view.creditTag(), decoded.creditTag);
+    EXPECT_EQ(view.clearingFirm(), decoded.clearingFirm);
+    EXPECT_EQ(view.branchId(), decoded.branchId);
+    EXPECT_EQ(view.trdCnfmId(), decoded.trdCnfmId);
+    EXPECT_EQ(view.ordCnfmId(), decoded.ordCnfmId);
+    EXPECT_EQ(view.tradeDate(), decoded.tradeDate);
+    EXPECT_EQ(view.transactTime(), decoded.transactTime);
+    EXPECT_EQ(view.userInfo(), decoded.userInfo);
+    EXPECT_TRUE(original == decoded);
+}
+
 TEST(OrderRejectTest, EncodeAndDeocde) {
     OrderReject original;
     original.bizId = 4;
@@ -0,0 +1,95 @@
+// Copyright 2025 xinchentechnote
+#include "include/stream_framer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "include/szse_binary.hpp"
+
+namespace {
+
+ByteBuf EncodeHeartbeats(size_t count) {
+  ByteBuf stream;
+  for (size_t i = 0; i < count; ++i) {
+    SzseBinary frame;
+    frame.msgType = 3;
+    frame.body = std::make_unique<Heartbeat>();
+    frame.encode(stream);
+
+    SzseBinary logon;
+    logon.msgType = 1;
+    auto body = std::make_unique<Logon>();
+    body->senderCompId = "sender";
+    body->heartBtint = static_cast<int32_t>(i);
+    logon.body = std::move(body);
+    logon.encode(stream);
+  }
+  return stream;
+}
+
+}  // namespace
+
+TEST(StreamFramerTest, WholeChunkYieldsFramesInPlace) {
+  ByteBuf stream = EncodeHeartbeats(3);
+  codec::StreamFramer framer(SzseBinaryFrameSpec);
+  const auto& frames = framer.feed(stream.data(), stream.size());
+  ASSERT_EQ(frames.size(), 6u);
+  EXPECT_EQ(frames[0].data(), stream.data());
+  EXPECT_EQ(frames[0].size(), 12u);
+  EXPECT_EQ(frames[1].size(), 12u + Logon::kWireSize);
+  EXPECT_EQ(framer.buffered(), 0u);
+  EXPECT_EQ(framer.needed(), SzseBinaryFrameSpec.headerSize);
+
+  ByteBufView view = frames[3];
+  SzseBinary decoded;
+  decoded.decode(view);
+  EXPECT_EQ(view.readable_bytes(), 0u);
+  EXPECT_EQ(decoded.msgType, 1u);
+  EXPECT_EQ(decoded.body.get_if<Logon>()->heartBtint, 1);
+}
+
+TEST(StreamFramerTest, ReassemblesAcrossArbitraryChunks) {
+  ByteBuf stream = EncodeHeartbeats(4);
+  for (size_t chunk : {1, 3, 7, 12, 50, 101}) {
+    codec::StreamFramer framer(SzseBinaryFrameSpec);
+    std::vector<std::vector<uint8_t>> frames;
+    for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+      size_t len = std::min(chunk, stream.size() - pos);
+      for (const auto& f : framer.feed(stream.data() + pos, len)) {
+        frames.emplace_back(f.data(), f.data() + f.size());
+      }
+    }
+    ASSERT_EQ(frames.size(), 8u) << chunk;
+    size_t offset = 0;
+    for (const auto& f : frames) {
+      EXPECT_EQ(std::memcmp(f.data(), stream.data() + offset, f.size()), 0) << chunk;
+      offset += f.size();
+    }
+    EXPECT_EQ(framer.buffered(), 0u);
+  }
+}
+
+TEST(StreamFramerTest, ReportsBytesNeeded) {
+  ByteBuf stream = EncodeHeartbeats(1);
+  codec::StreamFramer framer(SzseBinaryFrameSpec);
+  EXPECT_TRUE(framer.feed(stream.data(), 5).empty());
+  EXPECT_EQ(framer.needed(), 3u);
+  // Header of the first frame is complete; its 4-byte checksum is still missing.
+  EXPECT_TRUE(framer.feed(stream.data() + 5, 5).empty());
+  EXPECT_EQ(framer.needed(), 2u);
+  const auto& frames = framer.feed(stream.data() + 10, 20);
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(frames[0].size(), 12u);
+  EXPECT_EQ(framer.buffered(), 18u);
+  EXPECT_EQ(framer.needed(), 12u + Logon::kWireSize - 18u);
+}
+
+TEST(StreamFramerTest, RejectsOversizedFrames) {
+  ByteBuf header;
+  header.write_u32(1);
+  header.write_u32(1u << 30);
+  codec::StreamFramer framer(SzseBinaryFrameSpec);
+  EXPECT_THROW(framer.feed(header.data(), header.size()), std::runtime_error);
+}
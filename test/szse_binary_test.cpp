@@ -3,6 +3,16 @@
 #include "include/szse_binary.hpp"
 #include <gtest/gtest.h>
 
+// Detects a generated XWire setter, to check that selector fields have none.
+template <typename Wire, typename = void>
+struct HasSetApplId : std::false_type {};
+template <typename Wire>
+struct HasSetApplId<Wire, std::void_t<decltype(&Wire::setApplId)>> : std::true_type {};
+template <typename Wire, typename = void>
+struct HasSetMsgType : std::false_type {};
+template <typename Wire>
+struct HasSetMsgType<Wire, std::void_t<decltype(&Wire::setMsgType)>> : std::true_type {};
+
 TEST(SzseBinaryTest, EncodeAndDeocde) {
     auto body = std::make_unique<Logon>();
     body->senderCompId = "xxxxxxxxxxxxxxxxxxxx";
@@ -27,6 +37,105 @@ TEST(SzseBinaryTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+TEST(SzseBinaryTest, BodyVariant) {
+    SzseBinary original;
+    original.msgType = 100101;
+    auto& order = original.body.emplace<NewOrder>();
+    order.submittingPbuid = "S00001";
+    order.securityId = "000001";
+    order.securityIdsource = "102";
+    order.ownerType = 1;
+    order.clearingFirm = "C1";
+    order.transactTime = 20250102093000;
+    order.userInfo = "user";
+    order.clOrdId = "CL0001";
+    order.accountId = "0123456789";
+    order.branchId = "B01";
+    order.orderRestrictions = "R";
+    order.side = "1";
+    order.ordType = "2";
+    order.orderQty = 100;
+    order.price = 1234;
+    order.applId = "010";
+    auto& extend = order.applExtend.emplace<Extend100101>();
+    extend.stopPx = 1200;
+    extend.minQty = 10;
+    extend.maxPriceLevels = 2;
+    extend.timeInForce = "0";
+    extend.cashMargin = "1";
+    
+    ByteBuf buf;
+    original.encode(buf);
+    SzseBinary decoded;
+    decoded.body.emplace<Heartbeat>();
+    decoded.decode(buf);
+    original.bodyLength = decoded.bodyLength;
+    original.checksum = decoded.checksum;
+
+    EXPECT_EQ(original.encodedSize(), buf.size());
+    ASSERT_NE(decoded.body.get_if<NewOrder>(), nullptr);
+    EXPECT_EQ(decoded.body.get_if<Heartbeat>(), nullptr);
+    const auto* decodedExtend = decoded.body.get_if<NewOrder>()->applExtend.get_if<Extend100101>();
+    ASSERT_NE(decodedExtend, nullptr);
+    EXPECT_EQ(decodedExtend->stopPx, 1200);
+    EXPECT_TRUE(original == decoded);
+}
+
+TEST(SzseBinaryTest, TryDecode) {
+    SzseBinary original;
+    original.msgType = 100101;
+    auto& order = original.body.emplace<NewOrder>();
+    order.applId = "010";
+    order.applExtend.emplace<Extend100101>();
+    
+    ByteBuf buf;
+    original.encode(buf);
+    SzseBinary decoded;
+    ByteBufView known(buf.data(), buf.size());
+    EXPECT_TRUE(decoded.tryDecode(known));
+
+    ByteBuf unknownApplId;
+    order.applId = "999";
+    original.encode(unknownApplId);
+    EXPECT_FALSE(decoded.tryDecode(unknownApplId));
+
+    ByteBuf unknownMsgType;
+    original.msgType = 999999;
+    original.encode(unknownMsgType);
+    EXPECT_FALSE(decoded.tryDecode(unknownMsgType));
+    ByteBufView rethrown(unknownMsgType.data(), unknownMsgType.size());
+    EXPECT_THROW(decoded.decode(rethrown), std::runtime_error);
+}
+
+TEST(NewOrderTest, MaskedTryDecode) {
+    NewOrder original;
+    original.applId = "010";
+    original.applExtend.emplace<Extend100101>();
+    
+    ByteBuf buf;
+    original.encode(buf);
+    NewOrder decoded;
+    EXPECT_TRUE(decoded.tryDecode(buf, {NewOrder::Field::clOrdId}));
+
+    ByteBuf unknown;
+    original.applId = "999";
+    original.encode(unknown);
+    EXPECT_FALSE(decoded.tryDecode(unknown, {NewOrder::Field::clOrdId}));
+    ByteBufView rethrown(unknown.data(), unknown.size());
+    EXPECT_THROW(decoded.decode(rethrown, {NewOrder::Field::clOrdId}), std::runtime_error);
+}
+
+TEST(NewOrderTest, ApplExtendFactory) {
+    auto& factory = NewOrderMessageFactory::getInstance();
+    EXPECT_NE(dynamic_cast<Extend100101*>(factory.create("010").get()), nullptr);
+    EXPECT_NE(dynamic_cast<Extend100501*>(factory.create("052").get()), nullptr);
+    EXPECT_NE(dynamic_cast<Extend104128*>(factory.create("417").get()), nullptr);
+    EXPECT_EQ(factory.tryCreate("999"), nullptr);
+    EXPECT_EQ(factory.tryCreate("01"), nullptr);
+    EXPECT_THROW(factory.create("0100"), std::runtime_error);
+    EXPECT_NE(dynamic_cast<Extend200115*>(ExecutionReportMessageFactory::getInstance().create("010").get()), nullptr);
+}
+
 TEST(LogonTest, EncodeAndDeocde) {
     Logon original;
     original.senderCompId = "xxxxxxxxxxxxxxxxxxxx";
@@ -102,6 +211,39 @@ TEST(NewOrderTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+TEST(NewOrderTest, EncodedSize) {
+    auto applExtend = std::make_unique<Extend100101>();
+    applExtend->stopPx = 8;
+    applExtend->minQty = 8;
+    applExtend->maxPriceLevels = 2;
+    applExtend->timeInForce = "x";
+    applExtend->cashMargin = "x";
+    
+    NewOrder original;
+    original.submittingPbuid = "xxxxxx";
+    original.securityId = "xxxxxxxx";
+    original.securityIdsource = "xxxx";
+    original.ownerType = 2;
+    original.clearingFirm = "xx";
+    original.transactTime = 8;
+    original.userInfo = "xxxxxxxx";
+    original.clOrdId = "xxxxxxxxxx";
+    original.accountId = "xxxxxxxxxxxx";
+    original.branchId = "xxxx";
+    original.orderRestrictions = "xxxx";
+    original.side = "x";
+    original.ordType = "x";
+    original.orderQty = 8;
+    original.price = 8;
+    original.applId = "010";
+    original.applExtend = std::move(applExtend);
+    
+    ByteBuf buf;
+    original.encode(buf);
+
+    EXPECT_EQ(original.encodedSize(), buf.size());
+}
+
 TEST(Extend100101Test, EncodeAndDeocde) {
     Extend100101 original;
     original.stopPx = 8;
@@ -798,6 +940,70 @@ TEST(ExecutionReportTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+TEST(ExecutionReportTest, View) {
+    auto applExtend = std::make_unique<Extend200115>();
+    applExtend->cashMargin = "1";
+    
+    ExecutionReport original;
+    original.partitionNo = 7;
+    original.reportIndex = 81234567890;
+    original.reportingPbuid = "R00001";
+    original.submittingPbuid = "S00002";
+    original.securityId = "000001";
+    original.securityIdsource = "102";
+    original.ownerType = 1;
+    original.clearingFirm = "C1";
+    original.transactTime = 20250102093001;
+    original.userInfo = "user";
+    original.orderId = "ORD0000000000001";
+    original.clOrdId = "CL0001";
+    original.quoteMsgId = "Q01";
+    original.execId = "EXEC000000000001";
+    original.execType = "F";
+    original.ordStatus = "2";
+    original.lastPx = -125;
+    original.lastQty = 300;
+    original.leavesQty = 0;
+    original.cumQty = 1000;
+    original.side = "2";
+    original.accountId = "0123456789";
+    original.branchId = "B01";
+    original.applId = "010";
+    original.applExtend = std::move(applExtend);
+    
+    ByteBuf buf;
+    original.encode(buf);
+    ExecutionReportView view(buf);
+    ExecutionReport decoded;
+    decoded.decode(buf);
+
+    EXPECT_EQ(view.partitionNo(), decoded.partitionNo);
+    EXPECT_EQ(view.reportIndex(), decoded.reportIndex);
+    EXPECT_EQ(view.applId(), decoded.applId);
+    EXPECT_EQ(view.reportingPbuid(), decoded.reportingPbuid);
+    EXPECT_EQ(view.submittingPbuid(), decoded.submittingPbuid);
+    EXPECT_EQ(view.securityId(), decoded.securityId);
+    EXPECT_EQ(view.securityIdsource(), decoded.securityIdsource);
+    EXPECT_EQ(view.ownerType(), decoded.ownerType);
+    EXPECT_EQ(view.clearingFirm(), decoded.clearingFirm);
+    EXPECT_EQ(view.transactTime(), decoded.transactTime);
+    EXPECT_EQ(view.userInfo(), decoded.userInfo);
+    EXPECT_EQ(view.orderId(), decoded.orderId);
+    EXPECT_EQ(view.clOrdId(), decoded.clOrdId);
+    EXPECT_EQ(view.quoteMsgId(), decoded.quoteMsgId);
+    EXPECT_EQ(view.execId(), decoded.execId);
+    EXPECT_EQ(view.execType(), decoded.execType);
+    EXPECT_EQ(view.ordStatus(), decoded.ordStatus);
+    EXPECT_EQ(view.lastPx(), decoded.lastPx);
+    EXPECT_EQ(view.lastQty(), decoded.lastQty);
+    EXPECT_EQ(view.leavesQty(), decoded.leavesQty);
+    EXPECT_EQ(view.cumQty(), decoded.cumQty);
+    EXPECT_EQ(view.side(), decoded.side);
+    EXPECT_EQ(view.accountId(), decoded.accountId);
+    EXPECT_EQ(view.branchId(), decoded.branchId);
+    EXPECT_TRUE(original == decoded);
+}
+
 TEST(Extend200115Test, EncodeAndDeocde) {
     Extend200115 original;
     original.cashMargin = "x";
@@ -1121,6 +1327,20 @@ TEST(PlatformInfoTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+TEST(PlatformInfoTest, EncodedSize) {
+    PlatformPartition platformPartition;
+    platformPartition.partitionNo = 4;
+    
+    PlatformInfo original;
+    original.platformId = 2;
+    original.platformPartition = {platformPartition, platformPartition, platformPartition};
+    
+    ByteBuf buf;
+    original.encode(buf);
+
+    EXPECT_EQ(original.encodedSize(), buf.size());
+}
+
 TEST(PlatformPartitionTest, EncodeAndDeocde) {
     PlatformPartition original;
     original.partitionNo = 4;
@@ -1151,3 +1371,13 @@ TEST(TradingSessionStatusTest, EncodeAndDeocde) {
     EXPECT_TRUE(original == decoded);
 }
 
+
+TEST(SzseBinaryWireTest, NoSelectorSetters) {
+    EXPECT_FALSE(HasSetMsgType<SzseBinaryWire>::value);
+    EXPECT_FALSE(HasSetApplId<NewOrderWire>::value);
+    EXPECT_FALSE(HasSetApplId<ExecutionConfirmWire>::value);
+    EXPECT_FALSE(HasSetApplId<ExecutionReportWire>::value);
+    EXPECT_FALSE(HasSetApplId<OrderCancelRequestWire>::value);
+    EXPECT_FALSE(HasSetApplId<CancelRejectWire>::value);
+    EXPECT_FALSE(HasSetApplId<BusinessRejectWire>::value);
+}